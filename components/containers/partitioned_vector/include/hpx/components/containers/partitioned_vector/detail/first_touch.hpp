@@ -0,0 +1,87 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/partitioned_vector/detail/first_touch.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/execution/executors/static_chunk_size.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
+#include <hpx/threading_base/thread_data.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+/// \cond NOINTERNAL
+
+namespace hpx { namespace server { namespace detail {
+
+    // Partitions smaller than this number of memory pages are not worth
+    // being touched in parallel.
+    inline constexpr std::size_t first_touch_min_pages = 16;
+
+    // Reserve the storage for 'size' elements and touch its memory pages
+    // from all worker threads of the current thread pool (statically
+    // chunked) before the elements are constructed. Under a first-touch page
+    // placement policy this places the pages of a partition onto the NUMA
+    // domains of the cores that will later operate on them, instead of
+    // placing all of them onto the domain of the constructing thread.
+    template <typename T>
+    void first_touch(std::vector<T>& data, std::size_t size)
+    {
+        std::size_t const page_size = hpx::threads::get_memory_page_size();
+        std::size_t const bytes = size * sizeof(T);
+        if (page_size == 0 || bytes < first_touch_min_pages * page_size ||
+            hpx::threads::get_self_ptr() == nullptr ||
+            hpx::get_os_thread_count() == 1)
+        {
+            return;
+        }
+
+        data.reserve(size);
+
+        char* base = reinterpret_cast<char*>(data.data());
+        std::size_t const pages = (bytes + page_size - 1) / page_size;
+
+        hpx::experimental::for_loop(
+            hpx::execution::par.with(hpx::execution::static_chunk_size()),
+            std::size_t(0), pages, [base, page_size](std::size_t page) {
+                *static_cast<char volatile*>(base + page * page_size) = 0;
+            });
+    }
+
+    // Create the data of a partition holding 'size' elements constructed
+    // from 'ts...'. Partitions using a std::vector with the default
+    // allocator are touched in parallel first, all other containers are
+    // expected to place their memory through their allocator (see
+    // hpx::compute::host::block_allocator).
+    template <typename Data, typename T, typename... Ts>
+    Data create_partition_data(std::size_t size, Ts const&... ts)
+    {
+        if constexpr (std::is_same_v<Data, std::vector<T>> &&
+            !std::is_same_v<T, bool>)
+        {
+            Data data;
+            first_touch(data, size);
+            data.resize(size, ts...);
+            return data;
+        }
+        else
+        {
+            return Data(size, ts...);
+        }
+    }
+}}}    // namespace hpx::server::detail
+
+/// \endcond
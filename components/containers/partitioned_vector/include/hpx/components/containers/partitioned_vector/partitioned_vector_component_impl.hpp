@@ -21,6 +21,7 @@
 #include <hpx/runtime_components/component_factory.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/partitioned_vector/detail/first_touch.hpp>
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_decl.hpp>
 
 #include <cstddef>
@@ -42,7 +43,8 @@ namespace hpx { namespace server {
     template <typename T, typename Data>
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector(size_type partition_size)
-      : partitioned_vector_partition_(partition_size)
+      : partitioned_vector_partition_(
+            detail::create_partition_data<data_type, T>(partition_size))
     {
     }
 
@@ -50,7 +52,8 @@ namespace hpx { namespace server {
     HPX_PARTITIONED_VECTOR_SPECIALIZATION_EXPORT
     partitioned_vector<T, Data>::partitioned_vector(
         size_type partition_size, T const& val)
-      : partitioned_vector_partition_(partition_size, val)
+      : partitioned_vector_partition_(
+            detail::create_partition_data<data_type, T>(partition_size, val))
     {
     }
 
@@ -20,6 +20,7 @@
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/iterator_support/iterator_adaptor.hpp>
 #include <hpx/iterator_support/iterator_facade.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
 #include <hpx/naming_base/id_type.hpp>
 
 #include <hpx/components/containers/partitioned_vector/partitioned_vector_component_decl.hpp>
@@ -1255,4 +1256,22 @@ namespace hpx { namespace traits {
     {
         using type = T;
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The local raw iterators refer to the storage of a single partition,
+    // they are contiguous whenever the wrapped iterator is. This enables the
+    // pointer based fast paths of the local algorithms.
+    template <typename T, typename Data, typename BaseIter>
+    struct is_contiguous_iterator<
+        segmented::local_raw_vector_iterator<T, Data, BaseIter>, false>
+      : is_contiguous_iterator<BaseIter>
+    {
+    };
+
+    template <typename T, typename Data, typename BaseIter>
+    struct is_contiguous_iterator<
+        segmented::const_local_raw_vector_iterator<T, Data, BaseIter>, false>
+      : is_contiguous_iterator<BaseIter>
+    {
+    };
 }}    // namespace hpx::traits
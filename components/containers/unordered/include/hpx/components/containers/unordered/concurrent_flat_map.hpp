@@ -0,0 +1,752 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/concurrent_flat_map.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/datastructures/optional.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/topology/cpu_mask.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The slots of a flat_hash_table are organized in groups. Each slot has a
+    // control byte which marks it as empty, as deleted (a tombstone), or
+    // holds 7 bits of the hash of the key stored in the slot. All control
+    // bytes of a group are matched at once using word-wide bit operations,
+    // only the slots whose control byte matches need their keys compared.
+    struct flat_map_group
+    {
+        static constexpr std::size_t width = 8;
+
+        static constexpr std::int8_t empty = -128;    // 0b10000000
+        static constexpr std::int8_t deleted = -2;    // 0b11111110
+
+        explicit flat_map_group(std::int8_t const* ctrl) noexcept
+          : ctrl_(0)
+        {
+            for (std::size_t i = 0; i != width; ++i)
+            {
+                ctrl_ |= std::uint64_t(std::uint8_t(ctrl[i])) << (8 * i);
+            }
+        }
+
+        // The masks returned below have the high bit set in each byte
+        // corresponding to a matching slot.
+
+        // This may report false positives for occupied slots, which is
+        // harmless as the keys are compared afterwards anyways.
+        std::uint64_t match(std::uint8_t h2) const noexcept
+        {
+            std::uint64_t const x = ctrl_ ^ (lsbs * h2);
+            return (x - lsbs) & ~x & msbs;
+        }
+
+        std::uint64_t match_empty() const noexcept
+        {
+            return ctrl_ & ~(ctrl_ << 6) & msbs;
+        }
+
+        std::uint64_t match_empty_or_deleted() const noexcept
+        {
+            return ctrl_ & ~(ctrl_ << 7) & msbs;
+        }
+
+        // return the index of the first slot in the given mask
+        static std::size_t first(std::uint64_t mask) noexcept
+        {
+            HPX_ASSERT(mask != 0);
+
+            std::size_t i = 0;
+            while ((mask & 0x80) == 0)
+            {
+                mask >>= 8;
+                ++i;
+            }
+            return i;
+        }
+
+        static constexpr std::uint64_t lsbs = 0x0101010101010101ull;
+        static constexpr std::uint64_t msbs = 0x8080808080808080ull;
+
+        std::uint64_t ctrl_;
+    };
+
+    // Mix the bits of the given hash value, std::hash is the identity for
+    // integral types on most platforms.
+    inline std::uint64_t flat_map_mix(std::uint64_t h) noexcept
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        return h;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Open addressing hash table storing the key/value pairs inline. All
+    // operations take the (mixed) hash of the key, which allows to compute it
+    // only once for the containing concurrent_flat_map.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class flat_hash_table
+    {
+    public:
+        using value_type = std::pair<Key, T>;
+        using group = flat_map_group;
+
+    private:
+        union slot
+        {
+            slot() noexcept {}
+            ~slot() {}
+
+            value_type value_;
+        };
+
+    public:
+        flat_hash_table() = default;
+
+        // No memory is allocated before the first element is inserted, the
+        // table is then allocated with room for the given number of elements.
+        flat_hash_table(Hash const& hash, KeyEqual const& equal,
+            std::size_t initial_count = 0)
+          : hasher_(hash)
+          , equal_(equal)
+          , initial_capacity_(capacity_for(initial_count))
+        {
+        }
+
+        flat_hash_table(flat_hash_table const& rhs)
+          : hasher_(rhs.hasher_)
+          , equal_(rhs.equal_)
+          , initial_capacity_(rhs.initial_capacity_)
+        {
+            if (rhs.size_ != 0)
+            {
+                allocate(rhs.capacity_);
+                rhs.for_each_slot([&](std::size_t i) {
+                    new (&slots_[i].value_) value_type(rhs.slots_[i].value_);
+                    ctrl_[i] = rhs.ctrl_[i];
+                    ++size_;
+                });
+            }
+        }
+
+        flat_hash_table(flat_hash_table&& rhs) noexcept
+          : hasher_(HPX_MOVE(rhs.hasher_))
+          , equal_(HPX_MOVE(rhs.equal_))
+        {
+            swap(rhs);
+        }
+
+        flat_hash_table& operator=(flat_hash_table const& rhs)
+        {
+            if (this != &rhs)
+            {
+                flat_hash_table tmp(rhs);
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        flat_hash_table& operator=(flat_hash_table&& rhs) noexcept
+        {
+            if (this != &rhs)
+            {
+                flat_hash_table tmp(HPX_MOVE(rhs));
+                swap(tmp);
+            }
+            return *this;
+        }
+
+        ~flat_hash_table()
+        {
+            clear();
+        }
+
+        void swap(flat_hash_table& rhs) noexcept
+        {
+            std::swap(hasher_, rhs.hasher_);
+            std::swap(equal_, rhs.equal_);
+            std::swap(ctrl_, rhs.ctrl_);
+            std::swap(slots_, rhs.slots_);
+            std::swap(capacity_, rhs.capacity_);
+            std::swap(size_, rhs.size_);
+            std::swap(deleted_, rhs.deleted_);
+            std::swap(initial_capacity_, rhs.initial_capacity_);
+        }
+
+        std::uint64_t hash(Key const& key) const
+        {
+            return flat_map_mix(static_cast<std::uint64_t>(hasher_(key)));
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        T* find(Key const& key, std::uint64_t hash) noexcept
+        {
+            std::size_t const i = find_index(key, hash);
+            return i != npos ? &slots_[i].value_.second : nullptr;
+        }
+
+        T const* find(Key const& key, std::uint64_t hash) const noexcept
+        {
+            std::size_t const i = find_index(key, hash);
+            return i != npos ? &slots_[i].value_.second : nullptr;
+        }
+
+        template <typename T_>
+        void insert_or_assign(Key const& key, std::uint64_t hash, T_&& val)
+        {
+            if (T* p = find(key, hash))
+            {
+                *p = HPX_FORWARD(T_, val);
+                return;
+            }
+
+            if (capacity_ == 0)
+            {
+                rehash(initial_capacity_);
+            }
+            else if (size_ + deleted_ >= max_load())
+            {
+                // drop the tombstones, grow only if the table is filled
+                // by more than half
+                rehash(size_ >= max_load() / 2 ? 2 * capacity_ : capacity_);
+            }
+
+            std::size_t const i = find_insert_index(hash);
+            new (&slots_[i].value_) value_type(key, HPX_FORWARD(T_, val));
+
+            if (ctrl_[i] == group::deleted)
+            {
+                --deleted_;
+            }
+            ctrl_[i] = h2(hash);
+            ++size_;
+        }
+
+        bool erase(Key const& key, std::uint64_t hash)
+        {
+            std::size_t const i = find_index(key, hash);
+            if (i == npos)
+            {
+                return false;
+            }
+            erase_index(i);
+            return true;
+        }
+
+        // move out the value of the given key and erase the element
+        hpx::optional<T> extract(Key const& key, std::uint64_t hash)
+        {
+            std::size_t const i = find_index(key, hash);
+            if (i == npos)
+            {
+                return hpx::optional<T>();
+            }
+            hpx::optional<T> val(HPX_MOVE(slots_[i].value_.second));
+            erase_index(i);
+            return val;
+        }
+
+        void reserve(std::size_t count)
+        {
+            std::size_t const capacity = capacity_for(count);
+            if (capacity > capacity_)
+            {
+                rehash(capacity);
+            }
+        }
+
+        void clear() noexcept
+        {
+            for_each_slot(
+                [&](std::size_t i) { slots_[i].value_.~value_type(); });
+
+            ctrl_.reset();
+            slots_.reset();
+            capacity_ = 0;
+            size_ = 0;
+            deleted_ = 0;
+        }
+
+        // invoke f(key, value) for all elements
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for_each_slot([&](std::size_t i) {
+                f(slots_[i].value_.first, slots_[i].value_.second);
+            });
+        }
+
+    private:
+        static constexpr std::size_t npos = std::size_t(-1);
+
+        static std::int8_t h2(std::uint64_t hash) noexcept
+        {
+            return static_cast<std::int8_t>(hash & 0x7f);
+        }
+
+        std::size_t max_load() const noexcept
+        {
+            return capacity_ - capacity_ / 8;
+        }
+
+        // the capacity needed to store the given number of elements
+        static std::size_t capacity_for(std::size_t count) noexcept
+        {
+            std::size_t capacity = group::width;
+            while (capacity * 7 / 8 < count)
+            {
+                capacity *= 2;
+            }
+            return capacity;
+        }
+
+        // The groups are probed using a triangular sequence, which visits
+        // each group once as the number of groups is a power of two.
+        template <typename F>
+        std::size_t probe(std::uint64_t hash, F&& f) const noexcept
+        {
+            std::size_t const mask = capacity_ / group::width - 1;
+            std::size_t g = static_cast<std::size_t>(hash >> 7) & mask;
+            for (std::size_t step = 1; /**/; ++step)
+            {
+                std::size_t const base = g * group::width;
+                std::size_t const i = f(base, group(&ctrl_[base]));
+                if (i != npos)
+                {
+                    return i;
+                }
+                HPX_ASSERT(step <= mask + 1);
+                g = (g + step) & mask;
+            }
+        }
+
+        std::size_t find_index(Key const& key, std::uint64_t hash) const
+            noexcept
+        {
+            if (size_ == 0)
+            {
+                return npos;
+            }
+
+            bool found = false;
+            std::size_t const i =
+                probe(hash, [&](std::size_t base, group const& g) {
+                    for (std::uint64_t m = g.match(h2(hash)); m != 0;
+                         m &= m - 1)
+                    {
+                        std::size_t const idx = base + group::first(m);
+                        if (equal_(slots_[idx].value_.first, key))
+                        {
+                            found = true;
+                            return idx;
+                        }
+                    }
+
+                    // a group with an empty slot ends the probe sequence
+                    return g.match_empty() != 0 ? base : npos;
+                });
+            return found ? i : npos;
+        }
+
+        std::size_t find_insert_index(std::uint64_t hash) const noexcept
+        {
+            return probe(hash, [](std::size_t base, group const& g) {
+                std::uint64_t const m = g.match_empty_or_deleted();
+                return m != 0 ? base + group::first(m) : npos;
+            });
+        }
+
+        void erase_index(std::size_t i) noexcept
+        {
+            slots_[i].value_.~value_type();
+            --size_;
+
+            // no probe sequence can have passed a group with an empty slot,
+            // no tombstone is needed in this case
+            std::size_t const base = i - i % group::width;
+            if (group(&ctrl_[base]).match_empty() != 0)
+            {
+                ctrl_[i] = group::empty;
+            }
+            else
+            {
+                ctrl_[i] = group::deleted;
+                ++deleted_;
+            }
+        }
+
+        template <typename F>
+        void for_each_slot(F&& f) const
+        {
+            for (std::size_t i = 0; i != capacity_; ++i)
+            {
+                if (ctrl_[i] >= 0)
+                {
+                    f(i);
+                }
+            }
+        }
+
+        void allocate(std::size_t capacity)
+        {
+            HPX_ASSERT(capacity % group::width == 0);
+            HPX_ASSERT((capacity & (capacity - 1)) == 0);
+
+            ctrl_.reset(new std::int8_t[capacity]);
+            std::fill(ctrl_.get(), ctrl_.get() + capacity, group::empty);
+            slots_.reset(new slot[capacity]);
+            capacity_ = capacity;
+        }
+
+        void rehash(std::size_t capacity)
+        {
+            capacity = (std::max)(capacity, group::width);
+
+            flat_hash_table tmp(hasher_, equal_);
+            tmp.allocate(capacity);
+
+            for_each_slot([&](std::size_t i) {
+                value_type& value = slots_[i].value_;
+                std::uint64_t const hash = this->hash(value.first);
+
+                std::size_t const j = tmp.find_insert_index(hash);
+                new (&tmp.slots_[j].value_) value_type(HPX_MOVE(value));
+                tmp.ctrl_[j] = h2(hash);
+                ++tmp.size_;
+            });
+
+            swap(tmp);
+        }
+
+        Hash hasher_;
+        KeyEqual equal_;
+
+        std::unique_ptr<std::int8_t[]> ctrl_;
+        std::unique_ptr<slot[]> slots_;
+        std::size_t capacity_ = 0;
+        std::size_t size_ = 0;
+        std::size_t deleted_ = 0;
+        std::size_t initial_capacity_ = group::width;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A hash map which can be concurrently accessed by many threads. The
+    // elements are distributed over a set of flat_hash_tables (stripes) based
+    // on the hash of their keys, each of the stripes is protected by its own
+    // spinlock.
+    template <typename Key, typename T, typename Hash, typename KeyEqual>
+    class concurrent_flat_map
+    {
+    public:
+        using table_type = flat_hash_table<Key, T, Hash, KeyEqual>;
+        using size_type = std::size_t;
+
+    private:
+        using mutex_type = hpx::spinlock;
+
+        struct stripe
+        {
+            mutable mutex_type mtx_;
+            table_type table_;
+        };
+
+        using stripes_type = std::vector<hpx::util::cache_aligned_data<stripe>>;
+
+        static std::size_t default_num_stripes()
+        {
+            std::size_t const count =
+                4 * (std::max)(hpx::threads::hardware_concurrency(), 1u);
+
+            std::size_t num_stripes = 1;
+            while (num_stripes < count)
+            {
+                num_stripes *= 2;
+            }
+            return num_stripes;
+        }
+
+    public:
+        explicit concurrent_flat_map(size_type bucket_count = 0,
+            Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+          : table_(hash, equal)
+          , stripes_(default_num_stripes())
+        {
+            // the stripes allocate their tables only once they are used
+            for (auto& s : stripes_)
+            {
+                s.data_.table_ =
+                    table_type(hash, equal, bucket_count / stripes_.size());
+            }
+        }
+
+        concurrent_flat_map(concurrent_flat_map const& rhs)
+          : table_(rhs.table_)
+          , stripes_(rhs.stripes_.size())
+        {
+            for (std::size_t i = 0; i != stripes_.size(); ++i)
+            {
+                stripe const& s = rhs.stripes_[i].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+                stripes_[i].data_.table_ = s.table_;
+            }
+        }
+
+        concurrent_flat_map(concurrent_flat_map&& rhs) = default;
+
+        concurrent_flat_map& operator=(concurrent_flat_map const& rhs)
+        {
+            if (this != &rhs)
+            {
+                concurrent_flat_map tmp(rhs);
+                *this = HPX_MOVE(tmp);
+            }
+            return *this;
+        }
+
+        concurrent_flat_map& operator=(concurrent_flat_map&& rhs) = default;
+
+        ///////////////////////////////////////////////////////////////////////
+        // return a copy of the value of the given key, if any
+        hpx::optional<T> get(Key const& key) const
+        {
+            std::uint64_t const hash = table_.hash(key);
+            stripe const& s = get_stripe(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            T const* p = s.table_.find(key, hash);
+            if (p == nullptr)
+            {
+                return hpx::optional<T>();
+            }
+            return hpx::optional<T>(*p);
+        }
+
+        // move out the value of the given key, if any, and erase the element
+        hpx::optional<T> extract(Key const& key)
+        {
+            std::uint64_t const hash = table_.hash(key);
+            stripe& s = get_stripe(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.table_.extract(key, hash);
+        }
+
+        template <typename T_>
+        void insert_or_assign(Key const& key, T_&& val)
+        {
+            std::uint64_t const hash = table_.hash(key);
+            stripe& s = get_stripe(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            s.table_.insert_or_assign(key, hash, HPX_FORWARD(T_, val));
+        }
+
+        size_type erase(Key const& key)
+        {
+            std::uint64_t const hash = table_.hash(key);
+            stripe& s = get_stripe(hash);
+
+            std::lock_guard<mutex_type> l(s.mtx_);
+            return s.table_.erase(key, hash) ? 1 : 0;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // The bulk operations acquire the lock of each of the involved
+        // stripes only once.
+
+        // Return copies of the values of the given keys (in the order of
+        // the keys), nothing if any of the keys was not found.
+        hpx::optional<std::vector<T>> get_values(
+            std::vector<Key> const& keys) const
+        {
+            std::vector<hpx::optional<T>> found(keys.size());
+            bool found_all = true;
+            for_each_stripe(keys,
+                [&](table_type const& table, std::size_t i,
+                    std::uint64_t hash) {
+                    T const* p = table.find(keys[i], hash);
+                    if (p != nullptr)
+                    {
+                        found[i].emplace(*p);
+                    }
+                    else
+                    {
+                        found_all = false;
+                    }
+                });
+
+            if (!found_all)
+            {
+                return hpx::optional<std::vector<T>>();
+            }
+
+            std::vector<T> values;
+            values.reserve(keys.size());
+            for (hpx::optional<T>& val : found)
+            {
+                values.push_back(HPX_MOVE(*val));
+            }
+            return hpx::optional<std::vector<T>>(HPX_MOVE(values));
+        }
+
+        void set_values(
+            std::vector<Key> const& keys, std::vector<T> const& values)
+        {
+            HPX_ASSERT(keys.size() == values.size());
+
+            for_each_stripe(keys,
+                [&](table_type& table, std::size_t i, std::uint64_t hash) {
+                    table.insert_or_assign(keys[i], hash, values[i]);
+                });
+        }
+
+        // make room for the given number of additional elements, assuming
+        // they are evenly spread over the stripes
+        void reserve_additional(size_type count)
+        {
+            size_type const per_stripe =
+                (count + stripes_.size() - 1) / stripes_.size();
+            for (auto& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                s.data_.table_.reserve(s.data_.table_.size() + per_stripe);
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        size_type size() const
+        {
+            size_type size = 0;
+            for (auto const& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                size += s.data_.table_.size();
+            }
+            return size;
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        void clear()
+        {
+            for (auto& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                s.data_.table_.clear();
+            }
+        }
+
+        // Invoke f(key, value) for all elements. Each stripe is locked while
+        // its elements are visited, f must not access this map.
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (auto const& s : stripes_)
+            {
+                std::lock_guard<mutex_type> l(s.data_.mtx_);
+                s.data_.table_.for_each(f);
+            }
+        }
+
+    private:
+        // use the upper bits of the hash, the tables use the lower ones
+        std::size_t stripe_index(std::uint64_t hash) const noexcept
+        {
+            return static_cast<std::size_t>(hash >> 40) &
+                (stripes_.size() - 1);
+        }
+
+        stripe& get_stripe(std::uint64_t hash) noexcept
+        {
+            return stripes_[stripe_index(hash)].data_;
+        }
+
+        stripe const& get_stripe(std::uint64_t hash) const noexcept
+        {
+            return stripes_[stripe_index(hash)].data_;
+        }
+
+        // Invoke f(table, i, hash) for each of the given keys, ordered by
+        // stripe.
+        template <typename Map, typename F>
+        static void for_each_stripe_impl(
+            Map& map, std::vector<Key> const& keys, F&& f)
+        {
+            std::size_t const num_stripes = map.stripes_.size();
+
+            std::vector<std::uint64_t> hashes(keys.size());
+            std::vector<std::size_t> begins(num_stripes + 1, 0);
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                hashes[i] = map.table_.hash(keys[i]);
+                ++begins[map.stripe_index(hashes[i]) + 1];
+            }
+            std::partial_sum(begins.begin(), begins.end(), begins.begin());
+
+            std::vector<std::size_t> order(keys.size());
+            std::vector<std::size_t> next(begins.begin(), begins.end() - 1);
+            for (std::size_t i = 0; i != keys.size(); ++i)
+            {
+                order[next[map.stripe_index(hashes[i])]++] = i;
+            }
+
+            for (std::size_t s = 0; s != num_stripes; ++s)
+            {
+                if (begins[s] == begins[s + 1])
+                {
+                    continue;
+                }
+
+                auto& data = map.stripes_[s].data_;
+                std::lock_guard<mutex_type> l(data.mtx_);
+                for (std::size_t j = begins[s]; j != begins[s + 1]; ++j)
+                {
+                    f(data.table_, order[j], hashes[order[j]]);
+                }
+            }
+        }
+
+        template <typename F>
+        void for_each_stripe(std::vector<Key> const& keys, F&& f)
+        {
+            for_each_stripe_impl(*this, keys, HPX_FORWARD(F, f));
+        }
+
+        template <typename F>
+        void for_each_stripe(std::vector<Key> const& keys, F&& f) const
+        {
+            for_each_stripe_impl(*this, keys, HPX_FORWARD(F, f));
+        }
+
+        // empty table used for hashing only
+        table_type table_;
+        stripes_type stripes_;
+    };
+}}    // namespace hpx::detail
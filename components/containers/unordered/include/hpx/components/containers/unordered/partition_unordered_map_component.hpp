@@ -28,7 +28,7 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/server/component.hpp>
 #include <hpx/components_base/server/component_base.hpp>
-#include <hpx/components_base/server/locking_hook.hpp>
+#include <hpx/datastructures/optional.hpp>
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/cat.hpp>
@@ -37,7 +37,10 @@
 #include <hpx/runtime_components/component_factory.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <hpx/components/containers/unordered/concurrent_flat_map.hpp>
+
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <tuple>
@@ -49,26 +52,29 @@ namespace hpx { namespace server {
     /// \brief This is the basic wrapper class for stl unordered_map.
     ///
     /// This contain the implementation of the partition_unordered_map's
-    /// component functionality.
+    /// component functionality. The elements are stored in a
+    /// concurrent_flat_map, which allows for the actions (and the local
+    /// fast paths of the client) to concurrently access the partition.
     template <typename Key, typename T, typename Hash = std::hash<Key>,
         typename KeyEqual = std::equal_to<Key>>
     class partition_unordered_map
-      : public components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+      : public hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
     {
     public:
+        // the data of a partition is transferred as a std::unordered_map
         typedef std::unordered_map<Key, T, Hash, KeyEqual> data_type;
+        typedef hpx::detail::concurrent_flat_map<Key, T, Hash, KeyEqual>
+            storage_type;
 
         typedef typename data_type::size_type size_type;
-        typedef typename data_type::iterator iterator_type;
-        typedef typename data_type::const_iterator const_iterator_type;
 
-        typedef components::locking_hook<hpx::components::component_base<
-            partition_unordered_map<Key, T, Hash, KeyEqual>>>
+        typedef hpx::components::component_base<
+            partition_unordered_map<Key, T, Hash, KeyEqual>>
             base_type;
 
     private:
-        data_type partition_unordered_map_;
+        storage_type partition_unordered_map_;
 
     public:
         ///////////////////////////////////////////////////////////////////////
@@ -127,38 +133,19 @@ namespace hpx { namespace server {
         /// Duplicate the copy method for action naming
         data_type get_copied_data() const
         {
-            return partition_unordered_map_;
+            data_type data;
+            partition_unordered_map_.for_each(
+                [&](Key const& key, T const& val) { data.emplace(key, val); });
+            return data;
         }
         void set_copied_data(data_type&& d)
         {
-            partition_unordered_map_ = HPX_MOVE(d);
-        }
-
-        ///////////////////////////////////////////////////////////////////////
-        iterator_type begin()
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type begin() const
-        {
-            return partition_unordered_map_.begin();
-        }
-        const_iterator_type cbegin() const
-        {
-            return partition_unordered_map_.cbegin();
-        }
-
-        iterator_type end()
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type end() const
-        {
-            return partition_unordered_map_.end();
-        }
-        const_iterator_type cend() const
-        {
-            return partition_unordered_map_.cend();
+            partition_unordered_map_.clear();
+            for (auto& v : d)
+            {
+                partition_unordered_map_.insert_or_assign(
+                    v.first, HPX_MOVE(v.second));
+            }
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -171,21 +158,7 @@ namespace hpx { namespace server {
             return partition_unordered_map_.size();
         }
 
-        /// Returns the maximum possible number of elements
-        size_type max_size() const
-        {
-            return partition_unordered_map_.max_size();
-        }
-
-        /// Returns the number of elements that the container has currently
-        /// allocated space for.
-        size_type capacity() const
-        {
-            return partition_unordered_map_.capacity();
-        }
-
-        /// Checks if the container has no elements, i.e. whether
-        /// begin() == end().
+        /// Checks if the container has no elements
         bool empty() const
         {
             return partition_unordered_map_.empty();
@@ -195,77 +168,49 @@ namespace hpx { namespace server {
         // Element access API's
         ///////////////////////////////////////////////////////////////////////
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the element with the given \a key in the
+        /// partition_unordered_map container.
         ///
-        /// \param pos Position of the element in the partition_unordered_map
+        /// \param key   Key of the element in the partition_unordered_map
+        /// \param erase Erase the element after retrieving its value
         ///
-        /// \return Return the value of the element at position represented
-        ///         by \a pos.
+        /// \return Return the value of the element with the given \a key.
         ///
-        struct erase_on_exit
-        {
-            erase_on_exit(data_type& m, typename data_type::iterator& it)
-              : m_(m)
-              , it_(it)
-            {
-            }
-            ~erase_on_exit()
-            {
-                m_.erase(it_);
-            }
-
-            data_type& m_;
-            typename data_type::iterator& it_;
-        };
-
         T get_value(Key const& key, bool erase)
         {
-            typename data_type::iterator it =
-                partition_unordered_map_.find(key);
-            if (it == partition_unordered_map_.end())
+            hpx::optional<T> result = erase ?
+                partition_unordered_map_.extract(key) :
+                partition_unordered_map_.get(key);
+            if (!result)
             {
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "partition_unordered_map::get_value",
                     "unable to find requested key in this partition of the "
                     "unordered_map");
             }
-
-            if (!erase)
-                return it->second;
-
-            erase_on_exit t(partition_unordered_map_, it);
-            return it->second;
+            return HPX_MOVE(*result);
         }
 
-        /// Return the element at the position \a pos in the partition_unordered_map
-        /// container.
+        /// Return the elements with the given \a keys in the
+        /// partition_unordered_map container.
         ///
-        /// \param pos Positions of the elements in the partition_unordered_map
+        /// \param keys Keys of the elements in the partition_unordered_map
         ///
-        /// \return Return the values of the elements at position represented
-        ///         by \a pos.
+        /// \return Return the values of the elements with the given
+        ///         \a keys.
         ///
         std::vector<T> get_values(std::vector<Key> const& keys)
         {
-            std::vector<T> result;
-            result.reserve(keys.size());
-
-            for (std::size_t i = 0; i != keys.size(); ++i)
+            hpx::optional<std::vector<T>> result =
+                partition_unordered_map_.get_values(keys);
+            if (!result)
             {
-                typename data_type::iterator it =
-                    partition_unordered_map_.find(keys[i]);
-                if (it == partition_unordered_map_.end())
-                {
-                    HPX_THROW_EXCEPTION(bad_parameter,
-                        "partition_unordered_map::get_values",
-                        "unable to find requested key in this partition of the "
-                        "unordered_map");
-                    break;
-                }
-                result.push_back(it->second);
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "partition_unordered_map::get_values",
+                    "unable to find requested key in this partition of the "
+                    "unordered_map");
             }
-            return result;
+            return HPX_MOVE(*result);
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -281,7 +226,7 @@ namespace hpx { namespace server {
         ///
         void set_value(Key const& pos, T const& val)
         {
-            partition_unordered_map_[pos] = val;
+            partition_unordered_map_.insert_or_assign(pos, val);
         }
 
         /// Copy the value of \a val for the elements at positions \a pos in
@@ -294,10 +239,7 @@ namespace hpx { namespace server {
         void set_values(std::vector<Key> const& keys, std::vector<T> const& val)
         {
             HPX_ASSERT(keys.size() == val.size());
-            HPX_ASSERT(keys.size() <= partition_unordered_map_.size());
-
-            for (std::size_t i = 0; i != keys.size(); ++i)
-                partition_unordered_map_[keys[i]] = val[i];
+            partition_unordered_map_.set_values(keys, val);
         }
 
         /// Remove all elements from the vector leaving the
@@ -314,6 +256,12 @@ namespace hpx { namespace server {
             return partition_unordered_map_.erase(key);
         }
 
+        /// Make room for \a count additional elements
+        void reserve_additional(size_type count)
+        {
+            partition_unordered_map_.reserve_additional(count);
+        }
+
         /// Macros to define HPX component actions for all exported functions.
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, size)
 
@@ -324,6 +272,8 @@ namespace hpx { namespace server {
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, set_values)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(partition_unordered_map, erase)
+        HPX_DEFINE_COMPONENT_DIRECT_ACTION(
+            partition_unordered_map, reserve_additional)
 
         HPX_DEFINE_COMPONENT_DIRECT_ACTION(
             partition_unordered_map, get_copied_data)
@@ -376,6 +326,10 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,           \
         HPX_PP_CAT(__unordered_map_erase_action_, name))                       \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(                                                            \
+            partition_unordered_map, __LINE__)::reserve_additional_action,     \
+        HPX_PP_CAT(__unordered_map_reserve_additional_action_, name))          \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action, \
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name))             \
@@ -433,6 +387,10 @@ namespace hpx { namespace server {
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::erase_action,           \
         HPX_PP_CAT(__unordered_map_erase_action_, name))                       \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(                                                            \
+            partition_unordered_map, __LINE__)::reserve_additional_action,     \
+        HPX_PP_CAT(__unordered_map_reserve_additional_action_, name))          \
     HPX_REGISTER_ACTION(                                                       \
         HPX_PP_CAT(partition_unordered_map, __LINE__)::get_copied_data_action, \
         HPX_PP_CAT(__unordered_map_get_copied_data_action_, name))             \
@@ -676,6 +634,20 @@ namespace hpx {
                 this->get_id(), key);
         }
 
+        /// Make room for \a count additional elements in the
+        /// partition_unordered_map component.
+        ///
+        /// \param count  The number of elements to make room for
+        ///
+        /// \return This returns the hpx::future of type void
+        ///
+        future<void> reserve_additional(std::size_t count)
+        {
+            HPX_ASSERT(this->get_id());
+            return hpx::async<typename server_type::reserve_additional_action>(
+                this->get_id(), count);
+        }
+
         /// Get/set all the data of this partition
         future<typename server_type::data_type> get_data() const
         {
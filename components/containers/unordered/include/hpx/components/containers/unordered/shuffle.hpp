@@ -0,0 +1,381 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/components/unordered/shuffle.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/parallel/algorithms/for_loop.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_parts.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_local/get_os_thread_count.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/components/containers/unordered/partition_unordered_map_component.hpp>
+#include <hpx/components/containers/unordered/unordered_map.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // shuffle
+    namespace detail {
+        /// \cond NOINTERNAL
+
+        // the number of chunks sent by a part which may be in flight at any
+        // point in time
+        constexpr std::size_t max_shuffle_chunks_in_flight = 8;
+
+        // Copy the elements of a single (local) part of the source range to
+        // the partitions of the destination unordered_map owning their keys.
+        // The parts act as the sites of a communicator.
+        template <typename Key, typename T, typename Hash, typename KeyEqual>
+        struct unordered_map_shuffle
+          : public algorithm<unordered_map_shuffle<Key, T, Hash, KeyEqual>>
+        {
+            using server_type =
+                hpx::server::partition_unordered_map<Key, T, Hash, KeyEqual>;
+            using client_type =
+                hpx::partition_unordered_map<Key, T, Hash, KeyEqual>;
+
+            constexpr unordered_map_shuffle() noexcept
+              : unordered_map_shuffle::algorithm("unordered_map_shuffle")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename KeyFn>
+            static hpx::util::unused_type sequential(ExPolicy&& policy,
+                Iter first, Iter last, KeyFn&& key_fn,
+                std::vector<hpx::id_type> const& dests, Hash const& hash,
+                std::size_t chunk_size, std::size_t this_part,
+                std::size_t num_parts, std::string const& basename)
+            {
+                std::size_t const num_dests = dests.size();
+                auto get_dest = [&](T const& val) -> std::size_t {
+                    return hash(HPX_INVOKE(key_fn, val)) % num_dests;
+                };
+
+                // count the elements for each of the destination partitions,
+                // the chunks of the input are counted concurrently
+                std::size_t const size = std::distance(first, last);
+                std::size_t const num_chunks =
+                    (std::min)(size, hpx::get_os_thread_count());
+
+                std::vector<std::vector<std::size_t>> chunk_counts(
+                    num_chunks, std::vector<std::size_t>(num_dests, 0));
+
+                hpx::experimental::for_loop(policy, std::size_t(0),
+                    num_chunks, [&](std::size_t c) {
+                        Iter it = std::next(first, (c * size) / num_chunks);
+                        Iter end =
+                            std::next(first, ((c + 1) * size) / num_chunks);
+
+                        std::vector<std::size_t>& counts = chunk_counts[c];
+                        for (/**/; it != end; ++it)
+                        {
+                            ++counts[get_dest(*it)];
+                        }
+                    });
+
+                // part j announces the number of incoming elements to the
+                // destination partitions j, j + num_parts, ...
+                std::vector<std::vector<std::size_t>> counts(num_parts);
+                for (std::size_t d = 0; d != num_dests; ++d)
+                {
+                    std::size_t count = 0;
+                    for (auto const& c : chunk_counts)
+                    {
+                        count += c[d];
+                    }
+                    counts[d % num_parts].push_back(count);
+                }
+
+                if (num_parts != 1)
+                {
+                    using namespace hpx::collectives;
+
+                    communicator comm = create_communicator(basename.c_str(),
+                        num_sites_arg(num_parts), this_site_arg(this_part));
+
+                    counts = all_to_all(comm, HPX_MOVE(counts),
+                        this_site_arg(this_part), generation_arg(1))
+                                 .get();
+                }
+
+                std::vector<hpx::future<void>> reserved;
+                for (std::size_t d = this_part, i = 0; d < num_dests;
+                     d += num_parts, ++i)
+                {
+                    std::size_t incoming = 0;
+                    for (auto const& c : counts)
+                    {
+                        incoming += c[i];
+                    }
+                    if (incoming != 0)
+                    {
+                        reserved.push_back(
+                            client_type(dests[d]).reserve_additional(incoming));
+                    }
+                }
+
+                // stream the elements to their destination partitions in
+                // chunks, limiting the number of chunks in flight
+                std::vector<std::vector<Key>> keys(num_dests);
+                std::vector<std::vector<T>> values(num_dests);
+                std::deque<hpx::future<void>> in_flight;
+
+                auto send = [&](std::size_t d) {
+                    if (in_flight.size() == max_shuffle_chunks_in_flight)
+                    {
+                        in_flight.front().get();
+                        in_flight.pop_front();
+                    }
+                    in_flight.push_back(
+                        hpx::async<typename server_type::set_values_action>(
+                            dests[d], HPX_MOVE(keys[d]), HPX_MOVE(values[d])));
+
+                    keys[d].clear();
+                    values[d].clear();
+                };
+
+                for (/**/; first != last; ++first)
+                {
+                    Key key = HPX_INVOKE(key_fn, *first);
+                    std::size_t const d = hash(key) % num_dests;
+
+                    keys[d].push_back(HPX_MOVE(key));
+                    values[d].push_back(*first);
+                    if (keys[d].size() == chunk_size)
+                    {
+                        send(d);
+                    }
+                }
+
+                for (std::size_t d = 0; d != num_dests; ++d)
+                {
+                    if (!keys[d].empty())
+                    {
+                        send(d);
+                    }
+                }
+
+                for (auto& f : reserved)
+                {
+                    f.get();
+                }
+                for (auto& f : in_flight)
+                {
+                    f.get();
+                }
+
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename Iter, typename KeyFn>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, Iter first, Iter last, KeyFn&& key_fn,
+                std::vector<hpx::id_type> const& dests, Hash const& hash,
+                std::size_t chunk_size, std::size_t this_part,
+                std::size_t num_parts, std::string const& basename)
+            {
+                sequential(HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(KeyFn, key_fn), dests, hash, chunk_size,
+                    this_part, num_parts, basename);
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+        };
+
+        // each shuffle needs its own communicator
+        inline std::string get_shuffle_basename()
+        {
+            static std::atomic<std::size_t> count(0);
+            return "/hpx/unordered_map/shuffle/" +
+                std::to_string(hpx::get_locality_id()) + "/" +
+                std::to_string(++count);
+        }
+
+        template <typename ExPolicy, typename SegIter, typename Key,
+            typename T, typename Hash, typename KeyEqual, typename KeyFn>
+        typename util::detail::algorithm_result<ExPolicy>::type
+        shuffle_to_unordered_map(ExPolicy&& policy, SegIter first,
+            SegIter last, hpx::unordered_map<Key, T, Hash, KeyEqual>& dest,
+            KeyFn&& key_fn, std::size_t chunk_size)
+        {
+            using result = util::detail::algorithm_result<ExPolicy>;
+            using local_iterator_type = typename hpx::traits::
+                segmented_iterator_traits<SegIter>::local_iterator;
+
+            using value_type =
+                typename std::iterator_traits<SegIter>::value_type;
+
+            static_assert(std::is_same_v<value_type, T>,
+                "the value type of the source range must match the mapped "
+                "type of the destination");
+
+            auto sync_policy =
+                hpx::execution::experimental::to_non_task(policy);
+            using sync_policy_type = decltype(sync_policy);
+            using is_seq = hpx::is_sequenced_execution_policy<sync_policy_type>;
+
+            if (chunk_size == 0)
+            {
+                HPX_THROW_EXCEPTION(hpx::bad_parameter,
+                    "hpx::experimental::shuffle",
+                    "the chunk size must be larger than zero");
+            }
+
+            std::vector<hpx::id_type> ids;
+            std::vector<std::pair<local_iterator_type, local_iterator_type>>
+                parts;
+
+            for_each_segment_part(first, last,
+                [&](hpx::id_type const& id, local_iterator_type beg,
+                    local_iterator_type end) {
+                    ids.push_back(id);
+                    parts.emplace_back(beg, end);
+                });
+
+            if (parts.empty())
+            {
+                return result::get();
+            }
+
+            std::vector<hpx::id_type> dests = dest.get_partition_ids();
+            Hash hash = dest.hash_function();
+            std::string const basename = get_shuffle_basename();
+
+            // all parts have to take part in the exchange concurrently, even
+            // for sequential execution
+            std::vector<hpx::future<void>> shuffled;
+            shuffled.reserve(parts.size());
+            for (std::size_t i = 0; i != parts.size(); ++i)
+            {
+                shuffled.push_back(dispatch_async(ids[i],
+                    unordered_map_shuffle<Key, T, Hash, KeyEqual>(),
+                    sync_policy, is_seq(), parts[i].first, parts[i].second,
+                    key_fn, dests, hash, chunk_size, i, parts.size(),
+                    basename));
+            }
+
+            return result::get(hpx::dataflow(
+                [](std::vector<hpx::future<void>>&& r) {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        sync_policy_type>::call(r, errors);
+                },
+                HPX_MOVE(shuffled)));
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace experimental {
+
+    /// The default number of elements sent to a destination partition at
+    /// once by \a shuffle.
+    constexpr std::size_t default_shuffle_chunk_size = 4096;
+
+    /// Copies the elements in the range [first, last) to the partitions of the
+    /// unordered_map \a dest owning their keys, where the key of an element
+    /// is given by \a key_fn. An element is stored with its key, replacing
+    /// any element with the same key.
+    ///
+    /// Each part of the source range counts the elements for each of the
+    /// destination partitions, and the counts are exchanged between the
+    /// parts (using all_to_all) to make room in the destination partitions.
+    /// The elements are then sent directly from the locality owning a
+    /// source part to the destination partitions in chunks of at most
+    /// \a chunk_size elements, with a limited number of chunks in flight.
+    /// The memory needed for this is bounded by the number of destination
+    /// partitions times the chunk size, for each source part.
+    ///
+    /// \note The key function and the hash function of the unordered_map
+    ///       have to be serializable, they are used on the localities
+    ///       owning the segments of the source range.
+    ///
+    /// \param policy     The execution policy used for counting the
+    ///                   elements of each part of the source range
+    /// \param first      Refers to the beginning of the source range
+    /// \param last       Refers to the end of the source range
+    /// \param dest       The unordered_map receiving the elements
+    /// \param key_fn     Returns the key for a given element
+    /// \param chunk_size The maximal number of elements sent at once
+    ///
+    /// \returns  The \a shuffle algorithm returns a \a hpx::future<void> if
+    ///           the execution policy is of type \a sequenced_task_policy or
+    ///           \a parallel_task_policy and returns \a void otherwise.
+    ///
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename Key, typename T,
+        typename Hash, typename KeyEqual, typename KeyFn,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename parallel::util::detail::algorithm_result<ExPolicy>::type shuffle(
+        ExPolicy&& policy, SegIter first, SegIter last,
+        hpx::unordered_map<Key, T, Hash, KeyEqual>& dest, KeyFn&& key_fn,
+        std::size_t chunk_size = default_shuffle_chunk_size)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::v1::detail::shuffle_to_unordered_map(
+            HPX_FORWARD(ExPolicy, policy), first, last, dest,
+            HPX_FORWARD(KeyFn, key_fn), chunk_size);
+    }
+
+    // clang-format off
+    template <typename SegIter, typename Key, typename T, typename Hash,
+        typename KeyEqual, typename KeyFn,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    void shuffle(SegIter first, SegIter last,
+        hpx::unordered_map<Key, T, Hash, KeyEqual>& dest, KeyFn&& key_fn,
+        std::size_t chunk_size = default_shuffle_chunk_size)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        hpx::parallel::v1::detail::shuffle_to_unordered_map(
+            hpx::execution::seq, first, last, dest, HPX_FORWARD(KeyFn, key_fn),
+            chunk_size);
+    }
+}}    // namespace hpx::experimental
@@ -12,6 +12,7 @@
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_combinators/wait_all.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
 #include <hpx/components/client_base.hpp>
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -159,6 +160,11 @@ namespace hpx {
                 return hasher_(key);
             }
 
+            Hash get() const
+            {
+                return hasher_;
+            }
+
             Hash hasher_;
         };
 
@@ -174,6 +180,11 @@ namespace hpx {
             {
                 return Hash()(key);
             }
+
+            Hash get() const
+            {
+                return Hash();
+            }
         };
 
         ///////////////////////////////////////////////////////////////////////
@@ -366,15 +377,30 @@ namespace hpx {
             return this->hasher_(key) % partitions_.size();
         }
 
-        std::vector<hpx::id_type> get_partition_ids() const
+        // Group the given keys by partition, parts receives the sequence
+        // numbers of the involved partitions and positions the positions
+        // of the keys for each of those.
+        std::vector<std::vector<Key>> get_partition_keys(
+            std::vector<Key> const& keys, std::vector<std::size_t>& parts,
+            std::vector<std::vector<std::size_t>>& positions) const
         {
-            std::vector<hpx::id_type> ids;
-            ids.reserve(partitions_.size());
-            for (partition_data const& pd : partitions_)
+            std::vector<std::size_t> index(partitions_.size(), std::size_t(-1));
+            std::vector<std::vector<Key>> part_keys;
+
+            for (std::size_t i = 0; i != keys.size(); ++i)
             {
-                ids.push_back(pd.get_id());
+                std::size_t const part = get_partition(keys[i]);
+                if (index[part] == std::size_t(-1))
+                {
+                    index[part] = parts.size();
+                    parts.push_back(part);
+                    part_keys.emplace_back();
+                    positions.emplace_back();
+                }
+                part_keys[index[part]].push_back(keys[i]);
+                positions[index[part]].push_back(i);
             }
-            return ids;
+            return part_keys;
         }
 
         ///////////////////////////////////////////////////////////////////////
@@ -800,6 +826,188 @@ namespace hpx {
                 .set_value(pos, HPX_FORWARD(T_, val));
         }
 
+        /// Returns the elements with the given \a keys in the unordered_map
+        /// container. The keys are sent to their partitions in one batch
+        /// per partition.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the values of the elements in the order of the
+        ///         given \a keys.
+        ///
+        std::vector<T> get_values(
+            launch::sync_policy, std::vector<Key> const& keys) const
+        {
+            return get_values(keys).get();
+        }
+
+        /// Asynchronously returns the elements with the given \a keys from
+        /// the given partition in the unordered_map container.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        ///
+        /// \return Returns the hpx::future to the values of the elements
+        ///         with the given \a keys.
+        ///
+        future<std::vector<T>> get_values(
+            size_type part, std::vector<Key> const& keys) const
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                return make_ready_future(
+                    part_data.local_data_->get_values(keys));
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .get_values(keys);
+        }
+
+        /// Asynchronously returns the elements with the given \a keys in the
+        /// unordered_map container. The keys are sent to their partitions
+        /// in one batch per partition.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        ///
+        /// \return Returns the hpx::future to the values of the elements in
+        ///         the order of the given \a keys.
+        ///
+        future<std::vector<T>> get_values(std::vector<Key> const& keys) const
+        {
+            std::vector<std::size_t> parts;
+            std::vector<std::vector<std::size_t>> positions;
+            std::vector<std::vector<Key>> part_keys =
+                get_partition_keys(keys, parts, positions);
+
+            std::vector<future<std::vector<T>>> part_values;
+            part_values.reserve(parts.size());
+            for (std::size_t i = 0; i != parts.size(); ++i)
+            {
+                part_values.push_back(get_values(parts[i], part_keys[i]));
+            }
+
+            // scatter the values received from the partitions back into the
+            // order of the keys
+            return dataflow(
+                launch::sync,
+                [size = keys.size(), positions = HPX_MOVE(positions)](
+                    std::vector<future<std::vector<T>>>&& part_values) {
+                    std::vector<std::vector<T>> parts;
+                    parts.reserve(part_values.size());
+
+                    // the partition and the position in it of each value
+                    std::vector<std::pair<std::size_t, std::size_t>> sources(
+                        size);
+                    for (std::size_t i = 0; i != part_values.size(); ++i)
+                    {
+                        parts.push_back(part_values[i].get());
+                        HPX_ASSERT(parts[i].size() == positions[i].size());
+
+                        for (std::size_t j = 0; j != parts[i].size(); ++j)
+                        {
+                            sources[positions[i][j]] = std::make_pair(i, j);
+                        }
+                    }
+
+                    std::vector<T> values;
+                    values.reserve(size);
+                    for (auto const& source : sources)
+                    {
+                        values.push_back(
+                            HPX_MOVE(parts[source.first][source.second]));
+                    }
+                    return values;
+                },
+                HPX_MOVE(part_values));
+        }
+
+        /// Copy the values \a vals to the elements with the given \a keys in
+        /// the unordered_map container. The keys and values are sent to
+        /// their partitions in one batch per partition.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        void set_values(launch::sync_policy, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            set_values(keys, vals).get();
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given \a keys in the partition \a part.
+        ///
+        /// \param part  Sequence number of the partition
+        /// \param keys  Keys of the elements in the partition
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(size_type part, std::vector<Key> const& keys,
+            std::vector<T> const& vals)
+        {
+            HPX_ASSERT(part < partitions_.size());
+
+            partition_data const& part_data = partitions_[part];
+            if (part_data.local_data_)
+            {
+                part_data.local_data_->set_values(keys, vals);
+                return make_ready_future();
+            }
+
+            return partition_unordered_map_client(part_data.partition_)
+                .set_values(keys, vals);
+        }
+
+        /// Asynchronously copy the values \a vals to the elements with the
+        /// given \a keys in the unordered_map container. The keys and values
+        /// are sent to their partitions in one batch per partition.
+        ///
+        /// \param keys  Keys of the elements in the unordered_map
+        /// \param vals  The values to be copied
+        ///
+        /// \return This returns the hpx::future of type void which gets ready
+        ///         once the operation is finished.
+        ///
+        future<void> set_values(
+            std::vector<Key> const& keys, std::vector<T> const& vals)
+        {
+            HPX_ASSERT(keys.size() == vals.size());
+
+            std::vector<std::size_t> parts;
+            std::vector<std::vector<std::size_t>> positions;
+            std::vector<std::vector<Key>> part_keys =
+                get_partition_keys(keys, parts, positions);
+
+            std::vector<future<void>> part_results;
+            part_results.reserve(parts.size());
+            for (std::size_t i = 0; i != parts.size(); ++i)
+            {
+                std::vector<T> part_vals;
+                part_vals.reserve(positions[i].size());
+                for (std::size_t pos : positions[i])
+                {
+                    part_vals.push_back(vals[pos]);
+                }
+                part_results.push_back(
+                    set_values(parts[i], part_keys[i], part_vals));
+            }
+
+            return dataflow(
+                launch::sync,
+                [](std::vector<future<void>>&& part_results) {
+                    for (future<void>& f : part_results)
+                    {
+                        f.get();    // rethrow exceptions
+                    }
+                },
+                HPX_MOVE(part_results));
+        }
+
         /// Asynchronously compute the size of the unordered_map.
         ///
         /// \return Return the number of elements in the unordered_map
@@ -829,6 +1037,26 @@ namespace hpx {
             return size_async().get();
         }
 
+        /// Return the hash function used to map the keys to the partitions
+        Hash hash_function() const
+        {
+            return this->hasher_.get();
+        }
+
+        /// Return the ids of the partitions of the unordered_map, the key
+        /// \a key is stored in the partition hash_function()(key) %
+        /// get_num_partitions().
+        std::vector<hpx::id_type> get_partition_ids() const
+        {
+            std::vector<hpx::id_type> ids;
+            ids.reserve(partitions_.size());
+            for (partition_data const& pd : partitions_)
+            {
+                ids.push_back(pd.get_id());
+            }
+            return ids;
+        }
+
         /// Erase all values with the given key from the partition_unordered_map
         /// container.
         ///
@@ -0,0 +1,107 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the throughput of shuffling the elements of a partitioned_vector
+// into an unordered_map. Run this on 1..N localities to see how the shuffle
+// scales.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/unordered_map.hpp>
+
+#include <hpx/components/containers/unordered/shuffle.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The partitioned_vector types to be used are defined in partitioned_vector
+// module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+HPX_REGISTER_UNORDERED_MAP(int, int)
+
+struct identity_key
+{
+    int operator()(int val) const
+    {
+        return val;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    std::size_t const size = vm["vector_size"].as<std::size_t>();
+    std::size_t const chunk_size = vm["chunk_size"].as<std::size_t>();
+    std::size_t const iterations = vm["iterations"].as<std::size_t>();
+    std::size_t const parts = vm["partitions_per_locality"].as<std::size_t>();
+
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+    std::size_t const num_parts = parts * localities.size();
+
+    hpx::partitioned_vector<int> v(
+        size, hpx::container_layout(num_parts, localities));
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v[i] = static_cast<int>(i);
+    }
+
+    double elapsed = 0.0;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        hpx::unordered_map<int, int> m(
+            hpx::container_layout(num_parts, localities));
+
+        hpx::chrono::high_resolution_timer t;
+        hpx::experimental::shuffle(hpx::execution::par, v.begin(), v.end(), m,
+            identity_key(), chunk_size);
+        elapsed += t.elapsed();
+    }
+
+    double const per_iteration = elapsed / static_cast<double>(iterations);
+    std::cout << "shuffle: " << localities.size() << " localities, "
+              << num_parts << " partitions, " << size << " elements, chunk "
+              << chunk_size << ": " << per_iteration << " s, "
+              << static_cast<double>(size) / per_iteration / 1e6
+              << " M elements/s\n";
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    // clang-format off
+    desc_commandline.add_options()
+        ("vector_size",
+            hpx::program_options::value<std::size_t>()->default_value(1000000),
+            "number of elements to shuffle (default: 1000000)")
+        ("chunk_size",
+            hpx::program_options::value<std::size_t>()->default_value(
+                hpx::experimental::default_shuffle_chunk_size),
+            "number of elements sent at once (default: 4096)")
+        ("partitions_per_locality",
+            hpx::program_options::value<std::size_t>()->default_value(4),
+            "number of partitions per locality (default: 4)")
+        ("iterations",
+            hpx::program_options::value<std::size_t>()->default_value(5),
+            "number of times to repeat the shuffle (default: 5)");
+    // clang-format on
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
@@ -6,6 +6,7 @@
 
 #include <hpx/config.hpp>
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/future.hpp>
 #include <hpx/hpx_main.hpp>
 #include <hpx/include/runtime.hpp>
 #include <hpx/include/traits.hpp>
@@ -79,6 +80,146 @@ void fill_unordered_map(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m,
     HPX_TEST_EQ(m.size(), count);
 }
 
+template <typename Key, typename Value, typename Hash, typename KeyEqual>
+void bulk_tests(hpx::unordered_map<Key, Value, Hash, KeyEqual>& m)
+{
+    std::size_t const size = m.size();
+
+    std::vector<std::string> keys;
+    std::vector<Value> values;
+    for (std::size_t i = 0; i != 500; ++i)
+    {
+        keys.push_back("bulk" + std::to_string(i));
+        values.push_back(Value(i));
+    }
+
+    m.set_values(hpx::launch::sync, keys, values);
+    HPX_TEST_EQ(m.size(), size + keys.size());
+
+    std::reverse(keys.begin(), keys.end());
+    std::reverse(values.begin(), values.end());
+
+    std::vector<Value> result = m.get_values(hpx::launch::sync, keys);
+    HPX_TEST(result == values);
+
+    // concurrent access to the partitions
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t t = 0; t != 8; ++t)
+    {
+        tasks.push_back(hpx::async([&m, t]() {
+            for (std::size_t i = 0; i != 100; ++i)
+            {
+                std::string key = "task" + std::to_string(t * 100 + i);
+                m.set_value(hpx::launch::sync, key, Value(i));
+                HPX_TEST_EQ(m.get_value(hpx::launch::sync, key), Value(i));
+            }
+        }));
+    }
+    hpx::wait_all(tasks);
+    HPX_TEST_EQ(m.size(), size + keys.size() + 800);
+
+    for (std::string const& key : keys)
+    {
+        m.get_value(hpx::launch::sync, key, true);
+    }
+    HPX_TEST_EQ(m.size(), size + 800);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void flat_map_tests()
+{
+    hpx::detail::concurrent_flat_map<int, int, std::hash<int>,
+        std::equal_to<int>>
+        m;
+
+    // insert and erase many elements to exercise the tombstones and the
+    // rehashing of the tables
+    for (int round = 0; round != 4; ++round)
+    {
+        for (int i = 0; i != 10000; ++i)
+        {
+            m.insert_or_assign(i, i + round);
+        }
+        HPX_TEST_EQ(m.size(), std::size_t(10000));
+
+        for (int i = 0; i != 10000; i += 2)
+        {
+            HPX_TEST_EQ(m.erase(i), std::size_t(1));
+        }
+        HPX_TEST_EQ(m.size(), std::size_t(5000));
+
+        for (int i = 0; i != 10000; ++i)
+        {
+            hpx::optional<int> val = m.get(i);
+            HPX_TEST_EQ(val.has_value(), i % 2 != 0);
+            if (i % 2 != 0)
+            {
+                HPX_TEST_EQ(*val, i + round);
+            }
+        }
+    }
+
+    std::vector<int> keys = {1, 3, 5, 7};
+    hpx::optional<std::vector<int>> values = m.get_values(keys);
+    HPX_TEST(values.has_value());
+    HPX_TEST(*values == (std::vector<int>{4, 6, 8, 10}));
+
+    keys.push_back(2);
+    HPX_TEST(!m.get_values(keys).has_value());
+
+    std::size_t count = 0;
+    m.for_each([&](int key, int val) {
+        HPX_TEST_EQ(key + 3, val);
+        ++count;
+    });
+    HPX_TEST_EQ(count, std::size_t(5000));
+
+    hpx::optional<int> val = m.extract(1);
+    HPX_TEST(val.has_value() && *val == 4);
+    HPX_TEST(!m.extract(1).has_value());
+
+    m.clear();
+    HPX_TEST(m.empty());
+}
+
+// the values stored in the map do not need to be default constructible
+struct no_default_value
+{
+    explicit no_default_value(int v)
+      : v_(v)
+    {
+    }
+
+    int v_;
+};
+
+void flat_map_no_default_tests()
+{
+    hpx::detail::concurrent_flat_map<int, no_default_value, std::hash<int>,
+        std::equal_to<int>>
+        m(1000);
+
+    std::vector<int> keys;
+    std::vector<no_default_value> values;
+    for (int i = 0; i != 100; ++i)
+    {
+        keys.push_back(99 - i);
+        values.emplace_back(i);
+    }
+    m.set_values(keys, values);
+
+    HPX_TEST_EQ(m.get(99)->v_, 0);
+    HPX_TEST_EQ(m.extract(98)->v_, 1);
+
+    keys.erase(keys.begin(), keys.begin() + 2);
+    hpx::optional<std::vector<no_default_value>> result = m.get_values(keys);
+    HPX_TEST(result.has_value());
+    for (std::size_t i = 0; i != keys.size(); ++i)
+    {
+        HPX_TEST_EQ((*result)[i].v_, 99 - keys[i]);
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 template <typename Key, typename Value, typename DistPolicy>
 void trivial_tests(DistPolicy const& policy)
@@ -90,6 +231,8 @@ void trivial_tests(DistPolicy const& policy)
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        bulk_tests(m);
     }
 
     // bucket_count, hash
@@ -100,6 +243,8 @@ void trivial_tests(DistPolicy const& policy)
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        bulk_tests(m);
     }
 
     // bucket_count, hash, key_equal
@@ -109,6 +254,8 @@ void trivial_tests(DistPolicy const& policy)
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        bulk_tests(m);
     }
 }
 
@@ -122,6 +269,8 @@ void trivial_tests()
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        bulk_tests(m);
     }
 
     // bucket_count
@@ -131,6 +280,8 @@ void trivial_tests()
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        bulk_tests(m);
     }
 
     // bucket_count, hash
@@ -140,6 +291,8 @@ void trivial_tests()
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        bulk_tests(m);
     }
 
     // bucket_count, hash, key_equal
@@ -150,11 +303,16 @@ void trivial_tests()
 
         fill_unordered_map(m, 107, Value(42));
         test_global_iteration(m, Value(42));
+
+        bulk_tests(m);
     }
 }
 
 int main()
 {
+    flat_map_tests();
+    flat_map_no_default_tests();
+
     trivial_tests<std::string, double>();
 
     std::vector<hpx::id_type> localities = hpx::find_all_localities();
@@ -0,0 +1,128 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/unordered_map.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <hpx/components/containers/unordered/shuffle.hpp>
+
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The partitioned_vector types to be used are defined in partitioned_vector
+// module.
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+HPX_REGISTER_UNORDERED_MAP(int, int)
+
+///////////////////////////////////////////////////////////////////////////////
+struct negate_key
+{
+    int operator()(int val) const
+    {
+        return -val;
+    }
+};
+
+struct identity_key
+{
+    int operator()(int val) const
+    {
+        return val;
+    }
+};
+
+template <typename ExPolicy, typename DistPolicy1, typename DistPolicy2>
+void shuffle_test(ExPolicy const& policy, std::size_t size,
+    DistPolicy1 const& src_layout, DistPolicy2 const& dest_layout,
+    std::size_t chunk_size)
+{
+    hpx::partitioned_vector<int> v(size, src_layout);
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        v[i] = static_cast<int>(i);
+    }
+
+    hpx::unordered_map<int, int> m(dest_layout);
+    hpx::experimental::shuffle(
+        policy, v.begin(), v.end(), m, negate_key(), chunk_size);
+    HPX_TEST_EQ(m.size(), size);
+
+    std::vector<int> keys;
+    std::vector<int> expected;
+    for (std::size_t i = 0; i != size; ++i)
+    {
+        keys.push_back(-static_cast<int>(i));
+        expected.push_back(static_cast<int>(i));
+    }
+    HPX_TEST(m.get_values(hpx::launch::sync, keys) == expected);
+
+    // each element lives on the partition its key maps to
+    std::vector<hpx::id_type> ids = m.get_partition_ids();
+    HPX_TEST_EQ(ids.size(), m.get_num_partitions());
+
+    for (std::size_t i = 0; i != size; i += 17)
+    {
+        int key = -static_cast<int>(i);
+        std::size_t part = m.hash_function()(key) % ids.size();
+
+        using partition_type = hpx::partition_unordered_map<int, int>;
+        int val = partition_type(ids[part]).get_value(
+            hpx::launch::sync, key, false);
+        HPX_TEST_EQ(val, static_cast<int>(i));
+    }
+}
+
+template <typename DistPolicy1, typename DistPolicy2>
+void shuffle_tests(DistPolicy1 const& src_layout,
+    DistPolicy2 const& dest_layout, std::size_t size)
+{
+    using namespace hpx::execution;
+
+    for (std::size_t chunk_size : {std::size_t(1), std::size_t(7),
+             hpx::experimental::default_shuffle_chunk_size})
+    {
+        shuffle_test(seq, size, src_layout, dest_layout, chunk_size);
+        shuffle_test(par, size, src_layout, dest_layout, chunk_size);
+    }
+
+    // asynchronous execution
+    hpx::partitioned_vector<int> v(size, 42, src_layout);
+    hpx::unordered_map<int, int> m(dest_layout);
+    hpx::experimental::shuffle(par(task), v.begin(), v.end(), m, identity_key())
+        .get();
+    HPX_TEST_EQ(m.size(), std::size_t(size != 0 ? 1 : 0));
+
+    // without execution policy
+    hpx::unordered_map<int, int> m2(dest_layout);
+    hpx::experimental::shuffle(v.begin(), v.end(), m2, negate_key());
+    HPX_TEST_EQ(m2.size(), std::size_t(size != 0 ? 1 : 0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    for (std::size_t size : {0, 1, 1000})
+    {
+        shuffle_tests(hpx::container_layout, hpx::container_layout, size);
+        shuffle_tests(hpx::container_layout(3), hpx::container_layout(5),
+            size);
+        shuffle_tests(hpx::container_layout(3, localities),
+            hpx::container_layout(localities), size);
+        shuffle_tests(hpx::container_layout(localities),
+            hpx::container_layout(7, localities), size);
+    }
+
+    return 0;
+}
+#endif
@@ -49,6 +49,8 @@ namespace hpx::plugins::parcel {
             get_counter_type average_time_between_parcels;
             get_counter_values_creator_type
                 time_between_parcels_histogram_creator;
+            get_counter_type batch_size;
+            get_counter_type flush_interval;
             std::int64_t min_boundary, max_boundary, num_buckets;
         };
 
@@ -64,7 +66,8 @@ namespace hpx::plugins::parcel {
             get_counter_type time_between_parcels,
             get_counter_type average_time_between_parcels,
             get_counter_values_creator_type
-                time_between_parcels_histogram_creator);
+                time_between_parcels_histogram_creator,
+            get_counter_type batch_size, get_counter_type flush_interval);
 
         get_counter_type get_parcels_counter(std::string const& name) const;
         get_counter_type get_messages_counter(std::string const& name) const;
@@ -72,6 +75,9 @@ namespace hpx::plugins::parcel {
             std::string const& name) const;
         get_counter_type get_average_time_between_parcels_counter(
             std::string const& name) const;
+        get_counter_type get_batch_size_counter(std::string const& name) const;
+        get_counter_type get_flush_interval_counter(
+            std::string const& name) const;
         get_counter_values_type get_time_between_parcels_histogram_counter(
             std::string const& name, std::int64_t min_boundary,
             std::int64_t max_boundary, std::int64_t num_buckets);
@@ -164,6 +164,11 @@ namespace hpx::plugins::parcel::detail {
             return max_messages_;
         }
 
+        void set_capacity(std::size_t max_messages)
+        {
+            max_messages_ = max_messages;
+        }
+
     private:
         parcelset::locality dest_;
         std::vector<parcelset::parcel> messages_;
@@ -56,6 +56,8 @@ namespace hpx::plugins::parcel {
         std::int64_t get_messages_count(bool reset);
         std::int64_t get_parcels_per_message_count(bool reset);
         std::int64_t get_average_time_between_parcels(bool reset);
+        std::int64_t get_batch_size(bool reset);
+        std::int64_t get_flush_interval(bool reset);
         std::vector<std::int64_t> get_time_between_parcels_histogram(
             bool reset);
         void get_time_between_parcels_histogram_creator(
@@ -74,12 +76,26 @@ namespace hpx::plugins::parcel {
 
         void update_num_messages();
         void update_interval();
+        void update_max_latency();
+
+        // adapt the batch size and flush interval to the current parcel rate
+        void adapt_locked(std::int64_t time_since_last_parcel);
 
     private:
         mutable mutex_type mtx_;
         parcelset::parcelport* pp_;
         std::size_t num_coalesced_parcels_;
         std::size_t interval_;
+
+        // adaptive coalescing: maximal latency added to a parcel (in
+        // microseconds, zero if disabled), current number of parcels per
+        // message and current flush interval (in microseconds), and the
+        // moving average of the time between parcels (in nanoseconds)
+        std::size_t max_latency_;
+        std::size_t batch_size_;
+        std::size_t flush_interval_;
+        double average_time_between_parcels_;
+
         detail::message_buffer buffer_;
         util::pool_timer timer_;
         bool stopped_;
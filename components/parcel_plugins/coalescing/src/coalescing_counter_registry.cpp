@@ -33,7 +33,8 @@ namespace hpx::plugins::parcel {
         get_counter_type num_parcels, get_counter_type num_messages,
         get_counter_type num_parcels_per_message,
         get_counter_type average_time_between_parcels,
-        get_counter_values_creator_type time_between_parcels_histogram_creator)
+        get_counter_values_creator_type time_between_parcels_histogram_creator,
+        get_counter_type batch_size, get_counter_type flush_interval)
     {
         if (name.empty())
         {
@@ -49,7 +50,8 @@ namespace hpx::plugins::parcel {
         {
             counter_functions data = {num_parcels, num_messages,
                 num_parcels_per_message, average_time_between_parcels,
-                time_between_parcels_histogram_creator, 0, 0, 1};
+                time_between_parcels_histogram_creator, batch_size,
+                flush_interval, 0, 0, 1};
 
             map_.emplace(name, HPX_MOVE(data));
         }
@@ -63,6 +65,8 @@ namespace hpx::plugins::parcel {
                 average_time_between_parcels;
             (*it).second.time_between_parcels_histogram_creator =
                 time_between_parcels_histogram_creator;
+            (*it).second.batch_size = batch_size;
+            (*it).second.flush_interval = flush_interval;
 
             if ((*it).second.min_boundary != (*it).second.max_boundary)
             {
@@ -79,6 +83,8 @@ namespace hpx::plugins::parcel {
             (void) (*it).second.num_parcels_per_message;
             (void) (*it).second.average_time_between_parcels;
             (void) (*it).second.time_between_parcels_histogram_creator;
+            (void) (*it).second.batch_size;
+            (void) (*it).second.flush_interval;
         }
     }
 
@@ -174,6 +180,42 @@ namespace hpx::plugins::parcel {
         return (*it).second.average_time_between_parcels;
     }
 
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_batch_size_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_batch_size_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.batch_size;
+    }
+
+    coalescing_counter_registry::get_counter_type
+    coalescing_counter_registry::get_flush_interval_counter(
+        std::string const& name) const
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+
+        map_type::const_iterator it = map_.find(name);
+        if (it == map_.end())
+        {
+            l.unlock();
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "coalescing_counter_registry::get_flush_interval_counter",
+                "unknown action type");
+            return get_counter_type();
+        }
+        return (*it).second.flush_interval;
+    }
+
     coalescing_counter_registry::get_counter_values_type
     coalescing_counter_registry::get_time_between_parcels_histogram_counter(
         std::string const& name, std::int64_t min_boundary,
@@ -23,6 +23,7 @@
 
 #include <boost/accumulators/accumulators.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
@@ -41,6 +42,7 @@ namespace hpx::traits {
     //      ...
     //      num_messages = 50
     //      interval = 100
+    //      max_latency = 0
     //
     template <>
     struct plugin_config_data<hpx::plugins::parcel::coalescing_message_handler>
@@ -49,6 +51,7 @@ namespace hpx::traits {
         {
             return "num_messages = 50\n"
                    "interval = 100\n"
+                   "max_latency = 0\n"
                    "allow_background_flush = 1";
         }
     };
@@ -77,6 +80,15 @@ namespace hpx::plugins::parcel {
                 "hpx.plugins.coalescing_message_handler.interval", interval));
         }
 
+        // A non-zero maximal latency (in microseconds) enables the adaptive
+        // coalescing mode
+        std::size_t get_max_latency(std::size_t max_latency)
+        {
+            return hpx::util::from_string<std::size_t>(hpx::get_config_entry(
+                "hpx.plugins.coalescing_message_handler.max_latency",
+                max_latency));
+        }
+
         bool get_background_flush()
         {
             std::string value = hpx::get_config_entry(
@@ -91,12 +103,76 @@ namespace hpx::plugins::parcel {
         std::lock_guard<mutex_type> l(mtx_);
         num_coalesced_parcels_ =
             detail::get_num_messages(num_coalesced_parcels_);
+        if (max_latency_ == 0)
+        {
+            batch_size_ = num_coalesced_parcels_;
+        }
     }
 
     void coalescing_message_handler::update_interval()
     {
         std::lock_guard<mutex_type> l(mtx_);
         interval_ = detail::get_interval(interval_);
+        if (max_latency_ == 0)
+        {
+            flush_interval_ = interval_;
+        }
+    }
+
+    void coalescing_message_handler::update_max_latency()
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        max_latency_ = detail::get_max_latency(max_latency_);
+        if (max_latency_ == 0)
+        {
+            // back to static coalescing
+            batch_size_ = num_coalesced_parcels_;
+            flush_interval_ = interval_;
+        }
+    }
+
+    void coalescing_message_handler::adapt_locked(
+        std::int64_t time_since_last_parcel)
+    {
+        HPX_ASSERT(max_latency_ != 0);
+
+        // exponentially weighted moving average of the time between parcels,
+        // this quickly follows changes in the parcel rate
+        constexpr double weight = 0.125;
+        if (average_time_between_parcels_ == 0.0)
+        {
+            average_time_between_parcels_ = double(time_since_last_parcel);
+        }
+        else
+        {
+            average_time_between_parcels_ += weight *
+                (double(time_since_last_parcel) -
+                    average_time_between_parcels_);
+        }
+
+        // send as many parcels per message as are expected to arrive while
+        // the first parcel of the message is waiting (but not more than
+        // configured)
+        double const max_latency = double(max_latency_) * 1000.0;    // [ns]
+        std::size_t batch_size = num_coalesced_parcels_;
+        if (average_time_between_parcels_ > 0.0)
+        {
+            double const expected =
+                max_latency / average_time_between_parcels_ + 1.0;
+            if (expected < double(batch_size))
+            {
+                batch_size = std::size_t(expected);
+            }
+        }
+        batch_size_ = (std::max)(std::size_t(1), batch_size);
+
+        // flush the message once it is expected to be complete, but never
+        // later than allowed by the latency target
+        double const fill_time =
+            (std::min)(max_latency,
+                average_time_between_parcels_ * double(batch_size_)) /
+            1000.0;    // [us]
+        flush_interval_ = (std::max)(std::size_t(1), std::size_t(fill_time));
     }
 
     coalescing_message_handler::coalescing_message_handler(
@@ -105,6 +181,10 @@ namespace hpx::plugins::parcel {
       : pp_(pp)
       , num_coalesced_parcels_(detail::get_num_messages(num))
       , interval_(detail::get_interval(interval))
+      , max_latency_(detail::get_max_latency(0))
+      , batch_size_(num_coalesced_parcels_)
+      , flush_interval_(max_latency_ != 0 ? max_latency_ : interval_)
+      , average_time_between_parcels_(0.0)
       , buffer_(num_coalesced_parcels_)
       , timer_(hpx::bind_back(&coalescing_message_handler::timer_flush, this),
             hpx::bind_back(&coalescing_message_handler::flush_terminate, this),
@@ -139,7 +219,10 @@ namespace hpx::plugins::parcel {
                 this),
             hpx::bind_front(&coalescing_message_handler::
                                 get_time_between_parcels_histogram_creator,
-                this));
+                this),
+            hpx::bind_front(&coalescing_message_handler::get_batch_size, this),
+            hpx::bind_front(
+                &coalescing_message_handler::get_flush_interval, this));
 
         // register parameter update callbacks
         set_config_entry_callback(
@@ -148,6 +231,9 @@ namespace hpx::plugins::parcel {
         set_config_entry_callback(
             "hpx.plugins.coalescing_message_handler.interval",
             hpx::bind(&coalescing_message_handler::update_interval, this));
+        set_config_entry_callback(
+            "hpx.plugins.coalescing_message_handler.max_latency",
+            hpx::bind(&coalescing_message_handler::update_max_latency, this));
     }
 
     void coalescing_message_handler::put_parcel(parcelset::locality const& dest,
@@ -165,13 +251,20 @@ namespace hpx::plugins::parcel {
         if (time_between_parcels_)
             (*time_between_parcels_)(time_since_last_parcel);
 
-        std::chrono::microseconds interval(interval_);
+        // adjust the batch size and flush interval to the current traffic
+        if (max_latency_ != 0)
+            adapt_locked(time_since_last_parcel);
+
+        std::chrono::microseconds interval(flush_interval_);
 
         // just send parcel if the coalescing was stopped or the buffer is
-        // empty and time since last parcel is larger than coalescing interval.
+        // empty and time since last parcel is larger than coalescing interval
+        // (or no other parcel is expected to be coalesced with this one).
         if (stopped_ ||
             (buffer_.empty() &&
-                std::chrono::nanoseconds(time_since_last_parcel) > interval))
+                (batch_size_ <= 1 ||
+                    std::chrono::nanoseconds(time_since_last_parcel) >
+                        interval)))
         {
             ++num_messages_;
             l.unlock();
@@ -181,6 +274,8 @@ namespace hpx::plugins::parcel {
             return;
         }
 
+        buffer_.set_capacity(batch_size_);
+
         detail::message_buffer::message_buffer_append_state s =
             buffer_.append(dest, HPX_MOVE(p), HPX_MOVE(f));
 
@@ -272,7 +367,7 @@ namespace hpx::plugins::parcel {
         if (buffer_.empty())
             return false;
 
-        detail::message_buffer buff(num_coalesced_parcels_);
+        detail::message_buffer buff(batch_size_);
         std::swap(buff, buffer_);
 
         ++num_messages_;
@@ -317,6 +412,19 @@ namespace hpx::plugins::parcel {
         return value;
     }
 
+    std::int64_t coalescing_message_handler::get_batch_size(bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(batch_size_);
+    }
+
+    std::int64_t coalescing_message_handler::get_flush_interval(
+        bool /* reset */)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+        return static_cast<std::int64_t>(flush_interval_) * 1000;    // [ns]
+    }
+
     std::int64_t coalescing_message_handler::get_parcels_count(bool reset)
     {
         std::unique_lock<mutex_type> l(mtx_);
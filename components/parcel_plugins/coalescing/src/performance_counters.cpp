@@ -57,13 +57,22 @@ namespace hpx::plugins::parcel {
     }
 
     ///////////////////////////////////////////////////////////////////////////
+    // All coalescing counters are queried from the registry through one of
+    // its accessors, which return an empty function as long as no message
+    // handler for the given action exists
+    using registry_counter_getter_type =
+        coalescing_counter_registry::get_counter_type (
+            coalescing_counter_registry::*)(std::string const&) const;
+
     // Creation function for explicit sine performance counter. It's purpose is
     // to create and register a new instance of the given name (or reuse an
     // existing instance).
-    struct num_parcels_counter_surrogate
+    struct counter_surrogate
     {
-        explicit num_parcels_counter_surrogate(std::string const& parameters)
-          : parameters_(parameters)
+        counter_surrogate(
+            registry_counter_getter_type getter, std::string const& parameters)
+          : getter_(getter)
+          , parameters_(parameters)
         {
         }
 
@@ -71,9 +80,8 @@ namespace hpx::plugins::parcel {
         {
             if (counter_.empty())
             {
-                counter_ =
-                    coalescing_counter_registry::instance().get_parcels_counter(
-                        parameters_);
+                counter_ = (coalescing_counter_registry::instance().*getter_)(
+                    parameters_);
                 if (counter_.empty())
                     return 0;    // no counter available yet
             }
@@ -82,6 +90,7 @@ namespace hpx::plugins::parcel {
             return counter_(reset);
         }
 
+        registry_counter_getter_type getter_;
         hpx::function<std::int64_t(bool)> counter_;
         std::string parameters_;
     };
@@ -129,8 +138,11 @@ namespace hpx::plugins::parcel {
             }
 
             // the counter is not available yet, create surrogate function
-            return performance_counters::detail::create_raw_counter(
-                info, num_parcels_counter_surrogate(paths.parameters_), ec);
+            return performance_counters::detail::create_raw_counter(info,
+                counter_surrogate(
+                    &coalescing_counter_registry::get_parcels_counter,
+                    paths.parameters_),
+                ec);
         }
         break;
 
@@ -142,31 +154,6 @@ namespace hpx::plugins::parcel {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    struct num_messages_counter_surrogate
-    {
-        explicit num_messages_counter_surrogate(std::string const& parameters)
-          : parameters_(parameters)
-        {
-        }
-
-        std::int64_t operator()(bool reset)
-        {
-            if (counter_.empty())
-            {
-                counter_ = coalescing_counter_registry::instance()
-                               .get_messages_counter(parameters_);
-                if (counter_.empty())
-                    return 0;    // no counter available yet
-            }
-
-            // dispatch to actual counter
-            return counter_(reset);
-        }
-
-        hpx::function<std::int64_t(bool)> counter_;
-        std::string parameters_;
-    };
-
     hpx::naming::gid_type num_messages_counter_creator(
         hpx::performance_counters::counter_info const& info,
         hpx::error_code& ec)
@@ -210,8 +197,11 @@ namespace hpx::plugins::parcel {
             }
 
             // the counter is not available yet, create surrogate function
-            return performance_counters::detail::create_raw_counter(
-                info, num_messages_counter_surrogate(paths.parameters_), ec);
+            return performance_counters::detail::create_raw_counter(info,
+                counter_surrogate(
+                    &coalescing_counter_registry::get_messages_counter,
+                    paths.parameters_),
+                ec);
         }
         break;
 
@@ -223,32 +213,6 @@ namespace hpx::plugins::parcel {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    struct num_parcels_per_message_counter_surrogate
-    {
-        explicit num_parcels_per_message_counter_surrogate(
-            std::string const& parameters)
-          : parameters_(parameters)
-        {
-        }
-
-        std::int64_t operator()(bool reset)
-        {
-            if (counter_.empty())
-            {
-                counter_ = coalescing_counter_registry::instance()
-                               .get_parcels_per_message_counter(parameters_);
-                if (counter_.empty())
-                    return 0;    // no counter available yet
-            }
-
-            // dispatch to actual counter
-            return counter_(reset);
-        }
-
-        hpx::function<std::int64_t(bool)> counter_;
-        std::string parameters_;
-    };
-
     hpx::naming::gid_type num_parcels_per_message_counter_creator(
         hpx::performance_counters::counter_info const& info,
         hpx::error_code& ec)
@@ -295,7 +259,9 @@ namespace hpx::plugins::parcel {
 
             // the counter is not available yet, create surrogate function
             return performance_counters::detail::create_raw_counter(info,
-                num_parcels_per_message_counter_surrogate(paths.parameters_),
+                counter_surrogate(&coalescing_counter_registry::
+                                      get_parcels_per_message_counter,
+                    paths.parameters_),
                 ec);
         }
         break;
@@ -309,33 +275,6 @@ namespace hpx::plugins::parcel {
     }
 
     ///////////////////////////////////////////////////////////////////////////
-    struct average_time_between_parcels_counter_surrogate
-    {
-        explicit average_time_between_parcels_counter_surrogate(
-            std::string const& parameters)
-          : parameters_(parameters)
-        {
-        }
-
-        std::int64_t operator()(bool reset)
-        {
-            if (counter_.empty())
-            {
-                counter_ =
-                    coalescing_counter_registry::instance()
-                        .get_average_time_between_parcels_counter(parameters_);
-                if (counter_.empty())
-                    return 0;    // no counter available yet
-            }
-
-            // dispatch to actual counter
-            return counter_(reset);
-        }
-
-        hpx::function<std::int64_t(bool)> counter_;
-        std::string parameters_;
-    };
-
     hpx::naming::gid_type average_time_between_parcels_counter_creator(
         hpx::performance_counters::counter_info const& info,
         hpx::error_code& ec)
@@ -382,7 +321,8 @@ namespace hpx::plugins::parcel {
 
             // the counter is not available yet, create surrogate function
             return performance_counters::detail::create_raw_counter(info,
-                average_time_between_parcels_counter_surrogate(
+                counter_surrogate(&coalescing_counter_registry::
+                                      get_average_time_between_parcels_counter,
                     paths.parameters_),
                 ec);
         }
@@ -537,6 +477,82 @@ namespace hpx::plugins::parcel {
         }
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The counters exposing the decisions of the adaptive coalescing are raw
+    // values, they share the surrogate with the other coalescing counters
+    hpx::naming::gid_type adaptive_coalescing_counter_creator(
+        registry_counter_getter_type getter, char const* name,
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        switch (info.type_)
+        {
+        case performance_counters::counter_type::raw:
+        {
+            performance_counters::counter_path_elements paths;
+            performance_counters::get_counter_path_elements(
+                info.fullname_, paths, ec);
+            if (ec)
+                return naming::invalid_gid;
+
+            if (paths.parentinstance_is_basename_)
+            {
+                HPX_THROWS_IF(ec, bad_parameter, name,
+                    "invalid counter name for adaptive coalescing counter "
+                    "(instance name must not be a valid base counter name)");
+                return naming::invalid_gid;
+            }
+
+            if (paths.parameters_.empty())
+            {
+                HPX_THROWS_IF(ec, bad_parameter, name,
+                    "invalid counter parameter for adaptive coalescing "
+                    "counter: must specify an action type");
+                return naming::invalid_gid;
+            }
+
+            // ask registry
+            hpx::function<std::int64_t(bool)> f =
+                (coalescing_counter_registry::instance().*getter)(
+                    paths.parameters_);
+
+            if (!f.empty())
+            {
+                return performance_counters::detail::create_raw_counter(
+                    info, HPX_MOVE(f), ec);
+            }
+
+            // the counter is not available yet, create surrogate function
+            return performance_counters::detail::create_raw_counter(
+                info, counter_surrogate(getter, paths.parameters_), ec);
+        }
+        break;
+
+        default:
+            HPX_THROWS_IF(
+                ec, bad_parameter, name, "invalid counter type requested");
+            return naming::invalid_gid;
+        }
+    }
+
+    hpx::naming::gid_type batch_size_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return adaptive_coalescing_counter_creator(
+            &coalescing_counter_registry::get_batch_size_counter,
+            "batch_size_counter_creator", info, ec);
+    }
+
+    hpx::naming::gid_type flush_interval_counter_creator(
+        hpx::performance_counters::counter_info const& info,
+        hpx::error_code& ec)
+    {
+        return adaptive_coalescing_counter_creator(
+            &coalescing_counter_registry::get_flush_interval_counter,
+            "flush_interval_counter_creator", info, ec);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // This function will be registered as a startup function for HPX below.
     //
@@ -589,7 +605,21 @@ namespace hpx::plugins::parcel {
                 "the action which is given by the counter parameter",
                 HPX_PERFORMANCE_COUNTER_V1,
                 &time_between_parcels_histogram_counter_creator,
-                &counter_discoverer, "ns/0.1%"}};
+                &counter_discoverer, "ns/0.1%"},
+            // /coalescing(...)/count/batch-size@action-name
+            {"/coalescing/count/batch-size", counter_type::raw,
+                "returns the current number of parcels the message handler "
+                "associated with the action which is given by the counter "
+                "parameter coalesces into one message",
+                HPX_PERFORMANCE_COUNTER_V1, &batch_size_counter_creator,
+                &counter_discoverer, ""},
+            // /coalescing(...)/time/flush-interval@action-name
+            {"/coalescing/time/flush-interval", counter_type::raw,
+                "returns the current time the message handler associated "
+                "with the action which is given by the counter parameter "
+                "waits before sending a partially filled message",
+                HPX_PERFORMANCE_COUNTER_V1, &flush_interval_counter_creator,
+                &counter_discoverer, "ns"}};
 
         // Install the counter types, un-installation of the types is handled
         // automatically.
@@ -0,0 +1,132 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the adaptive coalescing mode keeps its batch size
+// and flush interval within the configured limits and that it can be
+// switched off at runtime.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/parcel_coalescing.hpp>
+#include <hpx/include/performance_counters.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const num_messages = 50;
+std::size_t const interval = 100;        // [us]
+std::size_t const max_latency = 1000;    // [us]
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t adaptive(std::size_t i)
+{
+    return i;
+}
+HPX_DECLARE_PLAIN_ACTION(adaptive, adaptive_action)
+HPX_ACTION_USES_MESSAGE_COALESCING(adaptive_action)
+HPX_PLAIN_ACTION(adaptive, adaptive_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::int64_t get_counter_value(char const* name)
+{
+    std::string const counter_name =
+        std::string("/coalescing{locality#0/total}/") + name +
+        "@adaptive_action";
+
+    hpx::performance_counters::performance_counter c(counter_name);
+    return c.get_value<std::int64_t>(hpx::launch::sync);
+}
+
+void send_parcels(hpx::id_type const& id, std::size_t count)
+{
+    std::vector<hpx::future<std::size_t>> results;
+    results.reserve(count);
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        results.push_back(hpx::async<adaptive_action>(id, i));
+    }
+
+    // verify all parcels were delivered
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), i);
+    }
+}
+
+void test_adaptive_coalescing(hpx::id_type const& id)
+{
+    // the message handler is created only once the first parcel is sent
+    HPX_TEST_EQ(get_counter_value("count/batch-size"), std::int64_t(0));
+
+    send_parcels(id, 1000);
+
+    // the decisions stay within the configured limits
+    std::int64_t const batch_size = get_counter_value("count/batch-size");
+    HPX_TEST_LTE(std::int64_t(1), batch_size);
+    HPX_TEST_LTE(batch_size, std::int64_t(num_messages));
+
+    std::int64_t const flush_interval =
+        get_counter_value("time/flush-interval");
+    HPX_TEST_LTE(std::int64_t(1000), flush_interval);
+    HPX_TEST_LTE(flush_interval, std::int64_t(max_latency * 1000));
+
+    // switching back to static coalescing restores the configured values
+    hpx::set_config_entry(
+        "hpx.plugins.coalescing_message_handler.max_latency", std::size_t(0));
+
+    HPX_TEST_EQ(
+        get_counter_value("count/batch-size"), std::int64_t(num_messages));
+    HPX_TEST_EQ(get_counter_value("time/flush-interval"),
+        std::int64_t(interval * 1000));
+
+    send_parcels(id, 1000);
+    HPX_TEST_EQ(
+        get_counter_value("count/batch-size"), std::int64_t(num_messages));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        test_adaptive_coalescing(id);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly enable message handlers (parcel coalescing) in adaptive mode
+    std::vector<std::string> const cfg = {"hpx.parcel.message_handlers=1",
+        "hpx.plugins.coalescing_message_handler.num_messages=" +
+            std::to_string(num_messages),
+        "hpx.plugins.coalescing_message_handler.interval=" +
+            std::to_string(interval),
+        "hpx.plugins.coalescing_message_handler.max_latency=" +
+            std::to_string(max_latency)};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
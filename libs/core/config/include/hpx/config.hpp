@@ -142,6 +142,33 @@
 #  define HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY 4
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the number of independently locked shards the cache of
+/// outgoing (parcel-) connections is split into. This value can be changed at
+/// runtime by setting the configuration parameter:
+///
+///   hpx.parcel.connection_cache_shards = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_CONNECTION_CACHE_SHARDS).
+#if !defined(HPX_PARCEL_CONNECTION_CACHE_SHARDS)
+#  define HPX_PARCEL_CONNECTION_CACHE_SHARDS 16
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the (estimated) message size starting at which the parcels
+/// of an outgoing message are serialized concurrently. This value can be
+/// changed at runtime by setting the configuration parameter:
+///
+///   hpx.parcel.parallel_serialization_threshold = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD). A value of zero disables
+/// parallel serialization.
+#if !defined(HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD)
+#  define HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD 1048576
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the maximally allowed message size for messages transferred
 /// between localities. This value can be changed at runtime by
@@ -167,6 +194,21 @@
 #  define HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE 1000000
 #endif
 
+/// This defines the execution time (in nanoseconds) below which remote
+/// invocations of actions marked as non-blocking (see
+/// HPX_ACTION_IS_NON_BLOCKING) are executed directly on the thread receiving
+/// the parcel instead of on a new thread. A value of zero disables the direct
+/// execution of those actions. This value can be changed at runtime by
+/// setting the configuration parameter:
+///
+///   hpx.parcel.direct_execution_threshold = ...
+///
+/// (or by setting the corresponding environment variable
+/// HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD).
+#if !defined(HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD)
+#  define HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD 10000
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 // This defines the number of bytes of overhead it takes to serialize a
 // parcel.
@@ -189,11 +231,34 @@
 #  define HPX_AGAS_LOCAL_CACHE_SIZE 4096
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the number of independently locked shards the tables of the
+/// primary AGAS namespace (the GID to GVA bindings and the global reference
+/// counts) are split into.
+#if !defined(HPX_AGAS_PRIMARY_NAMESPACE_SHARDS)
+#  define HPX_AGAS_PRIMARY_NAMESPACE_SHARDS 16
+#endif
+
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the number of independently locked shards the table of
+/// symbolic names managed by the AGAS symbol namespace is split into.
+#if !defined(HPX_AGAS_SYMBOL_NAMESPACE_SHARDS)
+#  define HPX_AGAS_SYMBOL_NAMESPACE_SHARDS 16
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS)
 #  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_REQUESTS 4096
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+/// This defines the maximum time (in milliseconds) a buffered reference count
+/// decrement is held back before it is sent to the owning locality. A value
+/// of zero disables the time based flushing of the buffered requests.
+#if !defined(HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_DELAY)
+#  define HPX_INITIAL_AGAS_MAX_PENDING_REFCNT_DELAY 10
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// This defines the initial global reference count associated with any created
 /// object.
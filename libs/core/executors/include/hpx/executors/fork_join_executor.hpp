@@ -672,6 +672,11 @@ namespace hpx { namespace execution { namespace experimental {
             }
 
         public:
+            std::size_t get_num_threads() const noexcept
+            {
+                return num_threads_;
+            }
+
             template <typename F, typename S, typename... Ts>
             void bulk_sync_execute(F&& f, S const& shape, Ts&&... ts)
             {
@@ -858,6 +863,16 @@ namespace hpx { namespace execution { namespace experimental {
             return exec.shared_data_->annotation_;
         }
 
+        // The number of worker threads participating in each parallel region.
+        // With a static schedule, a bulk_sync_execute over a shape of exactly
+        // this size runs one element on each of the worker threads.
+        friend std::size_t tag_invoke(
+            hpx::parallel::execution::processing_units_count_t,
+            fork_join_executor const& exec) noexcept
+        {
+            return exec.shared_data_->get_num_threads();
+        }
+
         /// \cond NOINTERNAL
         enum class init_mode
         {
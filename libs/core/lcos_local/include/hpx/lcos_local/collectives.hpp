@@ -0,0 +1,402 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file lcos_local/collectives.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/concepts/concepts.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/execution/executors/execution_parameters.hpp>
+#include <hpx/execution_base/this_thread.hpp>
+#include <hpx/execution_base/traits/is_executor.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/modules/errors.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace collectives { namespace local {
+
+    /// A communicator connects a fixed number of HPX threads (sites) running
+    /// on the same locality. All collective operations on a communicator
+    /// have to be invoked by all of its sites, each site passing its own
+    /// index. The operations block the calling thread until the result is
+    /// available.
+    ///
+    /// The sites are arranged in a combining tree where the children of site
+    /// \a i are the sites \a i + 2^k for all \a k such that \a i is
+    /// divisible by 2^(k+1). The subtree rooted at any site covers a
+    /// contiguous range of sites, thus the operations preserve the order of
+    /// the sites for non-commutative operations. Each site owns a cache line
+    /// sized slot holding its flags, the tree is synchronized using
+    /// sense-reversing flags, which allows for the communicator to be reused
+    /// for any number of subsequent operations without resetting it.
+    ///
+    /// A communicator can be used from within a parallel region of a
+    /// fork_join_executor. The executor has to use a static loop schedule
+    /// and the region has to have exactly one element per worker thread,
+    /// as otherwise several sites could be mapped onto the same thread:
+    ///
+    /// \code
+    ///     hpx::execution::experimental::fork_join_executor exec;
+    ///     hpx::collectives::local::communicator comm(exec);
+    ///
+    ///     hpx::parallel::execution::bulk_sync_execute(exec,
+    ///         [&](std::size_t site) {
+    ///             double sum = hpx::collectives::local::all_reduce(
+    ///                 comm, site, compute(site), std::plus<>{});
+    ///         },
+    ///         comm.num_sites());
+    /// \endcode
+    class communicator
+    {
+    public:
+        /// Create a communicator for the given number of sites
+        explicit communicator(std::size_t num_sites)
+          : sites_(num_sites)
+        {
+            if (num_sites == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::collectives::local::communicator::communicator",
+                    "the number of participating sites must be larger than "
+                    "zero");
+            }
+        }
+
+        /// Create a communicator for all worker threads of the given
+        /// executor (e.g. a fork_join_executor)
+        // clang-format off
+        template <typename Executor,
+            HPX_CONCEPT_REQUIRES_(
+                hpx::traits::is_executor_any_v<Executor>
+            )>
+        // clang-format on
+        explicit communicator(Executor const& exec)
+          : communicator(
+                hpx::parallel::execution::processing_units_count(exec))
+        {
+        }
+
+        communicator(communicator const&) = delete;
+        communicator(communicator&&) = delete;
+        communicator& operator=(communicator const&) = delete;
+        communicator& operator=(communicator&&) = delete;
+
+        /// Return the number of sites participating in collective
+        /// operations on this communicator
+        std::size_t num_sites() const noexcept
+        {
+            return sites_.size();
+        }
+
+        /// \cond NOINTERNAL
+
+        // Flip the sense of the given site, this starts a new operation
+        bool enter(std::size_t site) noexcept
+        {
+            HPX_ASSERT(site < sites_.size());
+            bool& sense = sites_[site].data_.sense_;
+            sense = !sense;
+            return sense;
+        }
+
+        template <typename F>
+        void for_each_child(std::size_t site, F&& f) const
+        {
+            std::size_t const num_sites = sites_.size();
+            for (std::size_t step = 1;
+                 (site & step) == 0 && step < num_sites - site; step <<= 1)
+            {
+                HPX_INVOKE(f, site + step);
+            }
+        }
+
+        // Wait for all children of this site to have arrived and invoke f
+        // for each of them (in order) with the value they have published
+        template <typename F>
+        void wait_children(std::size_t site, bool sense, F&& f) const
+        {
+            for_each_child(site, [&](std::size_t child) {
+                site_data const& c = sites_[child].data_;
+                wait(c.arrived_, sense);
+                HPX_INVOKE(f, c.value_);
+            });
+        }
+
+        // Publish the given value to the parent of this (non-root) site
+        void arrive(std::size_t site, bool sense, void const* value) noexcept
+        {
+            HPX_ASSERT(site != 0);
+            site_data& s = sites_[site].data_;
+            s.value_ = value;
+            s.arrived_.store(sense, std::memory_order_release);
+        }
+
+        // Return the value published by the given child while arriving, the
+        // value stays valid until the child has been released.
+        void const* contribution(std::size_t child) const noexcept
+        {
+            return sites_[child].data_.value_;
+        }
+
+        // Wait for the parent to release this (non-root) site and return the
+        // value it handed down.
+        void const* wait_release(std::size_t site, bool sense) const
+        {
+            HPX_ASSERT(site != 0);
+            site_data const& s = sites_[site].data_;
+            wait(s.released_, sense);
+            return s.result_;
+        }
+
+        // Signal the parent that the value handed down has been consumed
+        void depart(std::size_t site, bool sense) noexcept
+        {
+            sites_[site].data_.departed_.store(
+                sense, std::memory_order_release);
+        }
+
+        // Release the given child handing down the value
+        void release(std::size_t child, bool sense, void const* value) noexcept
+        {
+            site_data& c = sites_[child].data_;
+            c.result_ = value;
+            c.released_.store(sense, std::memory_order_release);
+        }
+
+        void wait_departed(std::size_t child, bool sense) const
+        {
+            wait(sites_[child].data_.departed_, sense);
+        }
+
+        // Release all children handing down the same value and wait for all
+        // of them to have consumed it.
+        void release_all(std::size_t site, bool sense, void const* value)
+        {
+            for_each_child(
+                site, [&](std::size_t child) { release(child, sense, value); });
+            for_each_child(
+                site, [&](std::size_t child) { wait_departed(child, sense); });
+        }
+        /// \endcond
+
+    private:
+        struct site_data
+        {
+            std::atomic<bool> arrived_{false};
+            std::atomic<bool> released_{false};
+            std::atomic<bool> departed_{false};
+
+            // only accessed by the thread representing the site
+            bool sense_ = false;
+
+            // the value published to the parent while arriving
+            void const* value_ = nullptr;
+
+            // the value handed down by the parent while releasing
+            void const* result_ = nullptr;
+        };
+
+        static void wait(std::atomic<bool> const& flag, bool sense)
+        {
+            hpx::util::yield_while(
+                [&]() {
+                    return flag.load(std::memory_order_acquire) != sense;
+                },
+                "hpx::collectives::local::communicator::wait");
+        }
+
+        std::vector<hpx::util::cache_aligned_data<site_data>> sites_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Block until all sites of the communicator have reached the barrier
+    ///
+    /// \param comm      The communicator to synchronize on
+    /// \param this_site The index of the calling site
+    inline void barrier(communicator& comm, std::size_t this_site)
+    {
+        bool const sense = comm.enter(this_site);
+
+        comm.wait_children(this_site, sense, [](void const*) {});
+        if (this_site != 0)
+        {
+            comm.arrive(this_site, sense, nullptr);
+            comm.wait_release(this_site, sense);
+            comm.depart(this_site, sense);
+        }
+        comm.release_all(this_site, sense, nullptr);
+    }
+
+    /// Combine the values of all sites and return the result on all sites
+    ///
+    /// \param comm      The communicator to use
+    /// \param this_site The index of the calling site
+    /// \param local     The value contributed by the calling site
+    /// \param op        The binary reduction operation, the values are
+    ///                  combined in the order of the sites
+    ///
+    /// \returns The combined values of all sites
+    template <typename T, typename F>
+    T all_reduce(communicator& comm, std::size_t this_site, T local, F&& op)
+    {
+        bool const sense = comm.enter(this_site);
+
+        comm.wait_children(this_site, sense, [&](void const* value) {
+            local =
+                HPX_INVOKE(op, HPX_MOVE(local), *static_cast<T const*>(value));
+        });
+
+        // the parent has finished reading the published value once it
+        // releases this site, thus local can be overwritten
+        if (this_site != 0)
+        {
+            comm.arrive(this_site, sense, &local);
+            local = *static_cast<T const*>(comm.wait_release(this_site, sense));
+            comm.depart(this_site, sense);
+        }
+        comm.release_all(this_site, sense, &local);
+
+        return local;
+    }
+
+    /// Distribute the value of the root site to all sites
+    ///
+    /// \param comm      The communicator to use
+    /// \param this_site The index of the calling site
+    /// \param local     The value to distribute (used on the root site only)
+    /// \param root_site The index of the site providing the value
+    ///
+    /// \returns The value provided by the root site
+    template <typename T>
+    T broadcast(communicator& comm, std::size_t this_site, T local,
+        std::size_t root_site = 0)
+    {
+        HPX_ASSERT(root_site < comm.num_sites());
+        bool const sense = comm.enter(this_site);
+
+        // pass the address of the value of the root site up to the root of
+        // the tree, the value stays valid while the root site waits for
+        // being released
+        void const* value = this_site == root_site ? &local : nullptr;
+        comm.wait_children(this_site, sense, [&](void const* child_value) {
+            if (child_value != nullptr)
+            {
+                value = child_value;
+            }
+        });
+
+        if (this_site != 0)
+        {
+            comm.arrive(this_site, sense, value);
+            if (this_site != root_site)
+            {
+                local =
+                    *static_cast<T const*>(comm.wait_release(this_site, sense));
+            }
+            else
+            {
+                comm.wait_release(this_site, sense);
+            }
+            comm.depart(this_site, sense);
+        }
+        else if (root_site != 0)
+        {
+            HPX_ASSERT(value != nullptr);
+            local = *static_cast<T const*>(value);
+        }
+        comm.release_all(this_site, sense, &local);
+
+        return local;
+    }
+
+    /// \cond NOINTERNAL
+    namespace detail {
+
+        template <typename T, typename F>
+        T scan(communicator& comm, std::size_t this_site, T local, F& op,
+            T const* init)
+        {
+            bool const sense = comm.enter(this_site);
+
+            // up-sweep: combine the values of the subtree of this site
+            T partial = local;
+            comm.wait_children(this_site, sense, [&](void const* value) {
+                partial = HPX_INVOKE(
+                    op, HPX_MOVE(partial), *static_cast<T const*>(value));
+            });
+
+            // down-sweep: receive the combined values of all preceding sites
+            T prefix = init != nullptr ? *init : local;
+            if (this_site != 0)
+            {
+                comm.arrive(this_site, sense, &partial);
+                prefix =
+                    *static_cast<T const*>(comm.wait_release(this_site, sense));
+                comm.depart(this_site, sense);
+            }
+
+            T inclusive = (this_site == 0 && init == nullptr) ?
+                HPX_MOVE(local) :
+                HPX_INVOKE(op, prefix, local);
+
+            // hand down the combined values of all sites preceding each
+            // child; the contribution of a child has to be read before
+            // releasing it as it becomes invalid afterwards
+            T running = inclusive;
+            comm.for_each_child(this_site, [&](std::size_t child) {
+                T next = HPX_INVOKE(op, running,
+                    *static_cast<T const*>(comm.contribution(child)));
+                comm.release(child, sense, &running);
+                comm.wait_departed(child, sense);
+                running = HPX_MOVE(next);
+            });
+
+            return init != nullptr ? prefix : inclusive;
+        }
+    }    // namespace detail
+    /// \endcond
+
+    /// Compute the inclusive prefix of the values of all sites
+    ///
+    /// \param comm      The communicator to use
+    /// \param this_site The index of the calling site
+    /// \param local     The value contributed by the calling site
+    /// \param op        The binary operation used to combine the values
+    ///
+    /// \returns The combined values of the sites [0, this_site]
+    template <typename T, typename F>
+    T inclusive_scan(
+        communicator& comm, std::size_t this_site, T local, F&& op)
+    {
+        return detail::scan(comm, this_site, HPX_MOVE(local), op,
+            static_cast<T const*>(nullptr));
+    }
+
+    /// Compute the exclusive prefix of the values of all sites
+    ///
+    /// \param comm      The communicator to use
+    /// \param this_site The index of the calling site
+    /// \param local     The value contributed by the calling site
+    /// \param init      The value returned on the first site
+    /// \param op        The binary operation used to combine the values
+    ///
+    /// \returns \a init combined with the values of the sites
+    ///          [0, this_site)
+    template <typename T, typename F>
+    T exclusive_scan(communicator& comm, std::size_t this_site, T local,
+        T const& init, F&& op)
+    {
+        return detail::scan(comm, this_site, HPX_MOVE(local), op, &init);
+    }
+}}}    // namespace hpx::collectives::local
@@ -0,0 +1,137 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/execution.hpp>
+#include <hpx/future.hpp>
+#include <hpx/lcos_local/collectives.hpp>
+#include <hpx/local/init.hpp>
+#include <hpx/modules/executors.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+constexpr std::size_t iterations = 20;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_site(local::communicator& comm, std::size_t site,
+    std::atomic<std::size_t>& counter)
+{
+    std::size_t const num_sites = comm.num_sites();
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        // barrier
+        ++counter;
+        local::barrier(comm, site);
+        HPX_TEST_EQ(counter.load(), (i + 1) * num_sites);
+        local::barrier(comm, site);
+
+        // all_reduce
+        std::size_t sum =
+            local::all_reduce(comm, site, site + i, std::plus<std::size_t>{});
+        HPX_TEST_EQ(sum, num_sites * (num_sites - 1) / 2 + num_sites * i);
+
+        // the values are combined in the order of the sites
+        std::string concatenated = local::all_reduce(comm, site,
+            std::to_string(site) + ",", std::plus<std::string>{});
+        std::string expected;
+        for (std::size_t s = 0; s != num_sites; ++s)
+        {
+            expected += std::to_string(s) + ",";
+        }
+        HPX_TEST_EQ(concatenated, expected);
+
+        // broadcast
+        std::size_t const root = i % num_sites;
+        std::size_t value = local::broadcast(comm, site, site + 42, root);
+        HPX_TEST_EQ(value, root + 42);
+
+        // scans
+        std::string inclusive = local::inclusive_scan(comm, site,
+            std::to_string(site) + ",", std::plus<std::string>{});
+        std::string exclusive = local::exclusive_scan(comm, site,
+            std::to_string(site) + ",", std::string("init,"),
+            std::plus<std::string>{});
+
+        expected.clear();
+        for (std::size_t s = 0; s != site; ++s)
+        {
+            expected += std::to_string(s) + ",";
+        }
+        HPX_TEST_EQ(exclusive, "init," + expected);
+        HPX_TEST_EQ(inclusive, expected + std::to_string(site) + ",");
+    }
+}
+
+void test_local_collectives(std::size_t num_sites)
+{
+    local::communicator comm(num_sites);
+    HPX_TEST_EQ(comm.num_sites(), num_sites);
+
+    std::atomic<std::size_t> counter(0);
+
+    std::vector<hpx::future<void>> sites;
+    sites.reserve(num_sites);
+    for (std::size_t site = 0; site != num_sites; ++site)
+    {
+        sites.push_back(hpx::async(
+            [&, site]() { test_site(comm, site, counter); }));
+    }
+    hpx::wait_all(sites);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_fork_join_executor()
+{
+    hpx::execution::experimental::fork_join_executor exec;
+    local::communicator comm(exec);
+    HPX_TEST_EQ(comm.num_sites(), hpx::get_num_worker_threads());
+
+    std::size_t const num_sites = comm.num_sites();
+    std::vector<std::size_t> results(num_sites, 0);
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        hpx::parallel::execution::bulk_sync_execute(
+            exec,
+            [&](std::size_t site) {
+                results[site] = local::inclusive_scan(
+                    comm, site, std::size_t(1), std::plus<std::size_t>{});
+            },
+            num_sites);
+
+        for (std::size_t site = 0; site != num_sites; ++site)
+        {
+            HPX_TEST_EQ(results[site], site + 1);
+        }
+    }
+}
+
+int hpx_main()
+{
+    for (std::size_t num_sites : {1, 2, 3, 5, 8, 13})
+    {
+        test_local_collectives(num_sites);
+    }
+
+    test_fork_join_executor();
+
+    return hpx::local::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::local::init(hpx_main, argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
@@ -90,6 +90,10 @@ namespace hpx { namespace util {
 
         std::size_t get_agas_max_pending_refcnt_requests() const;
 
+        // Maximum time (in milliseconds) buffered reference count requests
+        // are held back
+        std::size_t get_agas_max_pending_refcnt_delay() const;
+
         // Load application specific configuration and merge it with the
         // default configuration loaded from hpx.ini
         bool load_application_configuration(
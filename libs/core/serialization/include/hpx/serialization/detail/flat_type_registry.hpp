@@ -0,0 +1,209 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/serialization/config/defines.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx::serialization::detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // 64 bit FNV-1a hash of a (registered) type name. This is constexpr to
+    // allow for names known at compile time (for instance the ones generated
+    // by HPX_REGISTER_ACTION) to be hashed without any runtime overhead.
+    constexpr std::uint64_t hash_type_name(std::string_view name) noexcept
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (char c : name)
+        {
+            hash ^= static_cast<std::uint64_t>(static_cast<unsigned char>(c));
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Lookup statistics shared by all type registries
+    struct HPX_CORE_EXPORT flat_type_registry_base
+    {
+        static std::int64_t get_lookup_count(bool reset) noexcept;
+        static std::int64_t get_probe_count(bool reset) noexcept;
+
+    protected:
+#if defined(HPX_SERIALIZATION_HAVE_REGISTRY_COUNTERS)
+        static void record_lookup(std::size_t probes) noexcept;
+#else
+        static constexpr void record_lookup(std::size_t) noexcept {}
+#endif
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Open addressing (linear probing) hash table mapping type names to
+    // arbitrary values. All insertions are expected to happen during
+    // startup (i.e. from static initializers or before the parcel layer is
+    // running). After that the table is immutable and can be queried
+    // concurrently without any synchronization.
+    template <typename Value>
+    class flat_type_registry : flat_type_registry_base
+    {
+        struct entry
+        {
+            std::uint64_t hash = 0;
+            bool used = false;
+            std::string name;
+            Value value{};
+        };
+
+        static constexpr std::size_t initial_capacity = 64;
+
+    public:
+        using value_type = Value;
+
+        flat_type_registry() = default;
+
+        // Insert the given value for the given name, an existing entry is
+        // left untouched. Returns the stored value and whether the insertion
+        // took place.
+        std::pair<Value*, bool> emplace(std::string const& name, Value value)
+        {
+            if ((size_ + 1) * 2 > table_.size())
+            {
+                rehash(table_.empty() ? initial_capacity : 2 * table_.size());
+            }
+
+            std::uint64_t const hash = hash_type_name(name);
+            std::size_t const mask = table_.size() - 1;
+            for (std::size_t i = bucket(hash);; i = (i + 1) & mask)
+            {
+                entry& e = table_[i];
+                if (!e.used)
+                {
+                    e.hash = hash;
+                    e.used = true;
+                    e.name = name;
+                    e.value = HPX_MOVE(value);
+                    ++size_;
+                    return {&e.value, true};
+                }
+                if (e.hash == hash && e.name == name)
+                {
+                    return {&e.value, false};
+                }
+            }
+        }
+
+        Value const* find(std::string_view name) const noexcept
+        {
+            return find(hash_type_name(name), name);
+        }
+
+        // Look up an entry using a precomputed hash value, this avoids
+        // hashing the name again for names which are looked up repeatedly
+        Value const* find(
+            std::uint64_t hash, std::string_view name) const noexcept
+        {
+            if (size_ == 0)
+            {
+                return nullptr;
+            }
+
+            std::size_t const mask = table_.size() - 1;
+            std::size_t probes = 1;
+            for (std::size_t i = bucket(hash); table_[i].used;
+                 i = (i + 1) & mask, ++probes)
+            {
+                entry const& e = table_[i];
+                if (e.hash == hash && e.name == name)
+                {
+                    record_lookup(probes);
+                    return &e.value;
+                }
+            }
+
+            record_lookup(probes);
+            return nullptr;
+        }
+
+        bool contains(std::string_view name) const noexcept
+        {
+            return find(name) != nullptr;
+        }
+
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        // Call the given function for each (name, value) pair stored in the
+        // table (in unspecified order).
+        template <typename F>
+        void for_each(F&& f) const
+        {
+            for (entry const& e : table_)
+            {
+                if (e.used)
+                {
+                    f(e.name, e.value);
+                }
+            }
+        }
+
+    private:
+        std::size_t bucket(std::uint64_t hash) const noexcept
+        {
+            // Fibonacci hashing spreads the FNV bits over the whole table
+            HPX_ASSERT(!table_.empty());
+            return static_cast<std::size_t>(
+                       hash * 11400714819323198485ull >> 32) &
+                (table_.size() - 1);
+        }
+
+        void rehash(std::size_t capacity)
+        {
+            HPX_ASSERT((capacity & (capacity - 1)) == 0);
+
+            std::vector<entry> old(capacity);
+            std::swap(old, table_);
+
+            std::size_t const mask = capacity - 1;
+            for (entry& e : old)
+            {
+                if (!e.used)
+                {
+                    continue;
+                }
+
+                std::size_t i = bucket(e.hash);
+                while (table_[i].used)
+                {
+                    i = (i + 1) & mask;
+                }
+                table_[i] = HPX_MOVE(e);
+            }
+        }
+
+        std::vector<entry> table_;
+        std::size_t size_ = 0;
+    };
+}    // namespace hpx::serialization::detail
+
+#include <hpx/config/warnings_suffix.hpp>
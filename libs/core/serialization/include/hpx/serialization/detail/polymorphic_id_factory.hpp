@@ -13,6 +13,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/serialization/detail/flat_type_registry.hpp>
 #include <hpx/serialization/detail/polymorphic_intrusive_factory.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
@@ -20,8 +21,8 @@
 #include <hpx/type_support/unused.hpp>
 
 #include <cstdint>
-#include <map>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <vector>
 
@@ -36,8 +37,8 @@ namespace hpx::serialization::detail {
 
     public:
         typedef void* (*ctor_t)();
-        typedef std::map<std::string, ctor_t> typename_to_ctor_t;
-        typedef std::map<std::string, std::uint32_t> typename_to_id_t;
+        typedef flat_type_registry<ctor_t> typename_to_ctor_t;
+        typedef flat_type_registry<std::uint32_t> typename_to_id_t;
         typedef std::vector<ctor_t> cache_t;
 
         static constexpr std::uint32_t invalid_id = ~0u;
@@ -51,7 +52,7 @@ namespace hpx::serialization::detail {
         HPX_CORE_EXPORT void fill_missing_typenames();
 
         HPX_CORE_EXPORT std::uint32_t try_get_id(
-            const std::string& type_name) const;
+            std::string_view type_name) const;
 
         std::uint32_t get_max_registered_id() const
         {
@@ -120,7 +121,7 @@ namespace hpx::serialization::detail {
         }
 
         HPX_CORE_EXPORT static std::uint32_t get_id(
-            const std::string& type_name);
+            std::string_view type_name);
 
     private:
         polymorphic_id_factory() = default;
@@ -14,11 +14,10 @@
 #include <hpx/preprocessor/expand.hpp>
 #include <hpx/preprocessor/nargs.hpp>
 #include <hpx/preprocessor/stringize.hpp>
+#include <hpx/serialization/detail/flat_type_registry.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 
-#include <functional>
 #include <string>
-#include <unordered_map>
 
 namespace hpx { namespace serialization { namespace detail {
 
@@ -29,8 +28,7 @@ namespace hpx { namespace serialization { namespace detail {
 
     private:
         using ctor_type = void* (*) ();
-        using ctor_map_type =
-            std::unordered_map<std::string, ctor_type, std::hash<std::string>>;
+        using ctor_map_type = flat_type_registry<ctor_type>;
 
     public:
         polymorphic_intrusive_factory() = default;
@@ -16,18 +16,19 @@
 #include <hpx/modules/errors.hpp>
 #include <hpx/preprocessor/stringize.hpp>
 #include <hpx/preprocessor/strip_parens.hpp>
+#include <hpx/serialization/detail/flat_type_registry.hpp>
 #include <hpx/serialization/detail/non_default_constructible.hpp>
 #include <hpx/serialization/serialization_fwd.hpp>
 #include <hpx/serialization/traits/needs_automatic_registration.hpp>
 #include <hpx/serialization/traits/polymorphic_traits.hpp>
 #include <hpx/type_support/static.hpp>
 
-#include <functional>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <typeinfo>
-#include <unordered_map>
 
 #include <hpx/config/warnings_prefix.hpp>
 
@@ -106,10 +107,18 @@ namespace hpx::serialization::detail {
         HPX_NON_COPYABLE(polymorphic_nonintrusive_factory);
 
     public:
-        using serializer_map_type = std::unordered_map<std::string,
-            function_bunch_type, std::hash<std::string>>;
-        using serializer_typeinfo_map_type = std::unordered_map<std::string,
-            std::string, std::hash<std::string>>;
+        // The portable name of a registered class and its hash value, the
+        // hash is used for looking up the serialization functions whenever
+        // an object of this class is saved
+        struct class_name_type
+        {
+            std::string name;
+            std::uint64_t hash = 0;
+        };
+
+        using serializer_map_type = flat_type_registry<function_bunch_type>;
+        using serializer_typeinfo_map_type =
+            flat_type_registry<class_name_type>;
 
         HPX_CORE_EXPORT static polymorphic_nonintrusive_factory& instance();
 
@@ -128,13 +137,10 @@ namespace hpx::serialization::detail {
                     "polymorphic_nonintrusive_factory::register_class",
                     "Cannot register a factory with an empty name");
             }
-            auto it = map_.find(class_name);
-            auto jt = typeinfo_map_.find(typeinfo.name());
-
-            if (it == map_.end())
-                map_[class_name] = bunch;
-            if (jt == typeinfo_map_.end())
-                typeinfo_map_[typeinfo.name()] = class_name;
+            // existing entries are left untouched
+            map_.emplace(class_name, bunch);
+            typeinfo_map_.emplace(typeinfo.name(),
+                class_name_type{class_name, hash_type_name(class_name)});
         }
 
         // the following templates are defined in *.ipp file
@@ -152,6 +158,11 @@ namespace hpx::serialization::detail {
     private:
         polymorphic_nonintrusive_factory() {}
 
+        HPX_CORE_EXPORT class_name_type const& get_class_name(
+            std::type_info const& typeinfo) const;
+        HPX_CORE_EXPORT function_bunch_type const& get_function_bunch(
+            std::uint64_t hash, std::string_view class_name) const;
+
         friend struct hpx::util::static_<polymorphic_nonintrusive_factory>;
 
         serializer_map_type map_;
@@ -24,10 +24,11 @@ namespace hpx { namespace serialization { namespace detail {
         // It's safe to call typeid here. The typeid(t) return value is
         // only used for local lookup to the portable string that goes over the
         // wire
-        std::string const class_name = typeinfo_map_.at(typeid(t).name());
-        ar << class_name;
+        class_name_type const& class_name = get_class_name(typeid(t));
+        ar << class_name.name;
 
-        map_.at(class_name).save_function(ar, &t);
+        get_function_bunch(class_name.hash, class_name.name)
+            .save_function(ar, &t);
     }
 
     template <typename T>
@@ -36,7 +37,8 @@ namespace hpx { namespace serialization { namespace detail {
         std::string class_name;
         ar >> class_name;
 
-        map_.at(class_name).load_function(ar, &t);
+        get_function_bunch(hash_type_name(class_name), class_name)
+            .load_function(ar, &t);
     }
 
     template <typename T>
@@ -45,7 +47,8 @@ namespace hpx { namespace serialization { namespace detail {
         std::string class_name;
         ar >> class_name;
 
-        const function_bunch_type& bunch = map_.at(class_name);
+        function_bunch_type const& bunch =
+            get_function_bunch(hash_type_name(class_name), class_name);
         T* t = static_cast<T*>(bunch.create_function(ar));
 
         return t;
@@ -0,0 +1,336 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file hpx/serialization/stream_buffer.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/binary_filter.hpp>
+#include <hpx/serialization/traits/serialization_access_data.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx::serialization {
+
+    /// Default size of the segments handed to the sink of an
+    /// output_stream_buffer (and requested from the source of an
+    /// input_stream_buffer).
+    inline constexpr std::size_t default_stream_segment_size = 1024 * 1024;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An output_stream_buffer can be used as the container of an
+    /// output_archive. Instead of accumulating all serialized data in memory,
+    /// the data is handed to the given \a sink in segments of (at most) the
+    /// configured segment size while the serialization is in progress. The
+    /// sink is invoked as `sink(char const* data, std::size_t size)`, the
+    /// data it is given is valid only until it returns. Blocking inside the
+    /// sink throttles the serialization (back-pressure), the amount of memory
+    /// used by the buffer itself never exceeds a single segment.
+    ///
+    /// Large contiguous blocks of data (for instance bitwise serializable
+    /// arrays) that do not fit into the current segment are passed through to
+    /// the sink without being copied.
+    ///
+    /// \note The buffer must be flushed after the archive has been fully
+    ///       written to hand the last (partial) segment to the sink.
+    ///       Streaming is not supported for archives using a binary filter.
+    template <typename Sink>
+    class output_stream_buffer
+    {
+    public:
+        explicit output_stream_buffer(Sink sink,
+            std::size_t segment_size = default_stream_segment_size)
+          : sink_(HPX_MOVE(sink))
+          , segment_size_(segment_size != 0 ? segment_size :
+                                              default_stream_segment_size)
+          , size_(0)
+          , written_(0)
+        {
+            segment_.reserve(segment_size_);
+        }
+
+        output_stream_buffer(output_stream_buffer const&) = delete;
+        output_stream_buffer& operator=(output_stream_buffer const&) = delete;
+
+        /// Return the overall number of bytes written to this buffer
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        void resize(std::size_t size) noexcept
+        {
+            size_ = size;
+        }
+
+        /// Return the overall number of bytes handed to the sink
+        std::size_t bytes_flushed() const noexcept
+        {
+            return written_;
+        }
+
+        void write(void const* address, std::size_t count)
+        {
+            char const* data = static_cast<char const*>(address);
+
+            std::size_t const available = segment_size_ - segment_.size();
+            if (count < available)
+            {
+                segment_.insert(segment_.end(), data, data + count);
+                return;
+            }
+
+            // fill up the current segment and hand it to the sink
+            segment_.insert(segment_.end(), data, data + available);
+            data += available;
+            count -= available;
+            emit_segment();
+
+            // large blocks are passed through without copying them
+            if (count >= segment_size_)
+            {
+                std::size_t const passthrough =
+                    count - count % segment_size_;
+                emit(data, passthrough);
+                data += passthrough;
+                count -= passthrough;
+            }
+
+            segment_.insert(segment_.end(), data, data + count);
+        }
+
+        /// Hand the remaining data to the sink
+        void flush()
+        {
+            if (!segment_.empty())
+            {
+                emit_segment();
+            }
+        }
+
+        void reset() noexcept
+        {
+            segment_.clear();
+            size_ = 0;
+            written_ = 0;
+        }
+
+    private:
+        void emit(char const* data, std::size_t count)
+        {
+            sink_(data, count);
+            written_ += count;
+        }
+
+        void emit_segment()
+        {
+            emit(segment_.data(), segment_.size());
+            segment_.clear();
+        }
+
+        Sink sink_;
+        std::size_t segment_size_;
+        std::size_t size_;
+        std::size_t written_;
+        std::vector<char> segment_;
+    };
+
+    template <typename Sink>
+    output_stream_buffer(Sink) -> output_stream_buffer<Sink>;
+
+    template <typename Sink>
+    output_stream_buffer(Sink, std::size_t) -> output_stream_buffer<Sink>;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// An input_stream_buffer can be used as the container of an
+    /// input_archive. It requests the data from the given \a source segment by
+    /// segment while the de-serialization is in progress. The source is
+    /// invoked as `source(char* data, std::size_t size)` and is expected to
+    /// store up to `size` bytes at `data`, returning the number of bytes it
+    /// has stored. Returning zero signals the end of the data. The source may
+    /// block until more data becomes available, which allows for objects to be
+    /// de-serialized incrementally while their data is still arriving.
+    ///
+    /// Large contiguous blocks of data are read directly into their
+    /// destination without being copied through the segment buffer.
+    template <typename Source>
+    class input_stream_buffer
+    {
+    public:
+        explicit input_stream_buffer(Source source,
+            std::size_t segment_size = default_stream_segment_size)
+          : source_(HPX_MOVE(source))
+          , segment_size_(segment_size != 0 ? segment_size :
+                                              default_stream_segment_size)
+          , segment_(segment_size_)
+          , pos_(0)
+          , end_(0)
+          , consumed_(0)
+        {
+        }
+
+        input_stream_buffer(input_stream_buffer const&) = delete;
+        input_stream_buffer& operator=(input_stream_buffer const&) = delete;
+
+        /// The overall size of the data is not known upfront
+        static constexpr std::size_t size() noexcept
+        {
+            return (std::numeric_limits<std::size_t>::max)();
+        }
+
+        /// Return the overall number of bytes consumed from this buffer
+        std::size_t bytes_consumed() const noexcept
+        {
+            return consumed_;
+        }
+
+        // input archives refer to their container as a const object, the
+        // buffer has to modify its state nevertheless
+        void read(void* address, std::size_t count) const
+        {
+            char* dest = static_cast<char*>(address);
+            consumed_ += count;
+
+            std::size_t available = end_ - pos_;
+            if (count <= available)
+            {
+                std::memcpy(dest, segment_.data() + pos_, count);
+                pos_ += count;
+                return;
+            }
+
+            // drain the current segment
+            std::memcpy(dest, segment_.data() + pos_, available);
+            dest += available;
+            count -= available;
+            pos_ = end_ = 0;
+
+            // large blocks are read directly into their destination
+            while (count >= segment_size_)
+            {
+                std::size_t const received = receive(dest, count);
+                dest += received;
+                count -= received;
+            }
+
+            while (count != 0)
+            {
+                end_ = receive(segment_.data(), segment_size_);
+
+                std::size_t const n = (std::min)(count, end_);
+                std::memcpy(dest, segment_.data(), n);
+                dest += n;
+                count -= n;
+                pos_ = n;
+            }
+        }
+
+    private:
+        std::size_t receive(char* data, std::size_t count) const
+        {
+            std::size_t const received = source_(data, count);
+            if (received == 0)
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "input_stream_buffer::read",
+                    "archive data bstream is too short");
+            }
+            return received;
+        }
+
+        mutable Source source_;
+        std::size_t segment_size_;
+        mutable std::vector<char> segment_;
+        mutable std::size_t pos_;
+        mutable std::size_t end_;
+        mutable std::size_t consumed_;
+    };
+
+    template <typename Source>
+    input_stream_buffer(Source) -> input_stream_buffer<Source>;
+
+    template <typename Source>
+    input_stream_buffer(Source, std::size_t) -> input_stream_buffer<Source>;
+}    // namespace hpx::serialization
+
+namespace hpx::traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    template <typename Sink>
+    struct serialization_access_data<
+        serialization::output_stream_buffer<Sink>>
+      : default_serialization_access_data<
+            serialization::output_stream_buffer<Sink>>
+    {
+        using buffer_type = serialization::output_stream_buffer<Sink>;
+
+        static std::size_t size(buffer_type const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static void resize(buffer_type& cont, std::size_t count) noexcept
+        {
+            cont.resize(cont.size() + count);
+        }
+
+        static void write(buffer_type& cont, std::size_t count,
+            std::size_t /* current */, void const* address)
+        {
+            cont.write(address, count);
+        }
+
+        [[noreturn]] static bool flush(serialization::binary_filter*,
+            buffer_type&, std::size_t, std::size_t, std::size_t&)
+        {
+            HPX_THROW_EXCEPTION(invalid_status,
+                "serialization_access_data<output_stream_buffer>::flush",
+                "binary filters are not supported while streaming");
+        }
+
+        static void reset(buffer_type& cont) noexcept
+        {
+            cont.reset();
+        }
+    };
+
+    template <typename Source>
+    struct serialization_access_data<
+        serialization::input_stream_buffer<Source>>
+      : default_serialization_access_data<
+            serialization::input_stream_buffer<Source>>
+    {
+        using buffer_type = serialization::input_stream_buffer<Source>;
+
+        static constexpr std::size_t size(buffer_type const& cont) noexcept
+        {
+            return cont.size();
+        }
+
+        static void read(buffer_type const& cont, std::size_t count,
+            std::size_t /* current */, void* address)
+        {
+            cont.read(address, count);
+        }
+
+        [[noreturn]] static std::size_t init_data(buffer_type const&,
+            serialization::binary_filter*, std::size_t, std::size_t)
+        {
+            HPX_THROW_EXCEPTION(invalid_status,
+                "serialization_access_data<input_stream_buffer>::init_data",
+                "binary filters are not supported while streaming");
+        }
+    };
+}    // namespace hpx::traits
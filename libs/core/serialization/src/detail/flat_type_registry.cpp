@@ -0,0 +1,63 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/serialization/detail/flat_type_registry.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(HPX_SERIALIZATION_HAVE_REGISTRY_COUNTERS)
+#include <atomic>
+#endif
+
+namespace hpx::serialization::detail {
+
+#if defined(HPX_SERIALIZATION_HAVE_REGISTRY_COUNTERS)
+    namespace {
+
+        std::atomic<std::int64_t> lookup_count(0);
+        std::atomic<std::int64_t> probe_count(0);
+
+        std::int64_t get_and_reset_value(
+            std::atomic<std::int64_t>& value, bool reset) noexcept
+        {
+            if (reset)
+            {
+                return value.exchange(0, std::memory_order_relaxed);
+            }
+            return value.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    void flat_type_registry_base::record_lookup(std::size_t probes) noexcept
+    {
+        lookup_count.fetch_add(1, std::memory_order_relaxed);
+        probe_count.fetch_add(
+            static_cast<std::int64_t>(probes), std::memory_order_relaxed);
+    }
+
+    std::int64_t flat_type_registry_base::get_lookup_count(bool reset) noexcept
+    {
+        return get_and_reset_value(lookup_count, reset);
+    }
+
+    std::int64_t flat_type_registry_base::get_probe_count(bool reset) noexcept
+    {
+        return get_and_reset_value(probe_count, reset);
+    }
+#else
+    std::int64_t flat_type_registry_base::get_lookup_count(bool) noexcept
+    {
+        return 0;
+    }
+
+    std::int64_t flat_type_registry_base::get_probe_count(bool) noexcept
+    {
+        return 0;
+    }
+#endif
+}    // namespace hpx::serialization::detail
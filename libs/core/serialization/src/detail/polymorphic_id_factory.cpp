@@ -10,9 +10,10 @@
 #include <hpx/assert.hpp>
 #include <hpx/serialization/detail/polymorphic_id_factory.hpp>
 
+#include <algorithm>
 #include <cstdint>
-#include <map>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -45,9 +46,8 @@ namespace hpx { namespace serialization { namespace detail {
         typename_to_ctor.emplace(type_name, ctor);
 
         // populate cache
-        typename_to_id_t::const_iterator it = typename_to_id.find(type_name);
-        if (it != typename_to_id.end())
-            cache_id(it->second, ctor);
+        if (std::uint32_t const* id = typename_to_id.find(type_name))
+            cache_id(*id, ctor);
     }
 
     void id_registry::register_typename(
@@ -55,7 +55,7 @@ namespace hpx { namespace serialization { namespace detail {
     {
         HPX_ASSERT(id != invalid_id);
 
-        std::pair<typename_to_id_t::iterator, bool> p =
+        std::pair<std::uint32_t*, bool> p =
             typename_to_id.emplace(type_name, id);
 
         if (!p.second)
@@ -68,10 +68,8 @@ namespace hpx { namespace serialization { namespace detail {
         }
 
         // populate cache
-        typename_to_ctor_t::const_iterator it =
-            typename_to_ctor.find(type_name);
-        if (it != typename_to_ctor.end())
-            cache_id(id, it->second);
+        if (ctor_t const* ctor = typename_to_ctor.find(type_name))
+            cache_id(id, *ctor);
 
         if (id > max_id)
             max_id = id;
@@ -86,44 +84,42 @@ namespace hpx { namespace serialization { namespace detail {
 
         // Go over all registered mappings from type-names to ids and
         // fill in missing id to constructor mappings.
-        for (auto const& d : typename_to_id)
-        {
-            typename_to_ctor_t::const_iterator it =
-                typename_to_ctor.find(d.first);
-            if (it != typename_to_ctor.end())
-                cache_id(d.second, it->second);
-        }
+        typename_to_id.for_each(
+            [this](std::string const& name, std::uint32_t id) {
+                if (ctor_t const* ctor = typename_to_ctor.find(name))
+                    cache_id(id, *ctor);
+            });
 
         // Go over all registered mappings from type-names to
         // constructors and fill in missing id to constructor mappings.
-        for (auto const& d : typename_to_ctor)
-        {
-            typename_to_id_t::const_iterator it = typename_to_id.find(d.first);
-            HPX_ASSERT(it != typename_to_id.end());
-            cache_id(it->second, d.second);
-        }
+        typename_to_ctor.for_each([this](std::string const& name, ctor_t ctor) {
+            std::uint32_t const* id = typename_to_id.find(name);
+            HPX_ASSERT(id != nullptr);
+            cache_id(*id, ctor);
+        });
     }
 
-    std::uint32_t id_registry::try_get_id(const std::string& type_name) const
+    std::uint32_t id_registry::try_get_id(std::string_view type_name) const
     {
-        typename_to_id_t::const_iterator it = typename_to_id.find(type_name);
-        if (it == typename_to_id.end())
+        std::uint32_t const* id = typename_to_id.find(type_name);
+        if (id == nullptr)
             return invalid_id;
 
-        return it->second;
+        return *id;
     }
 
     std::vector<std::string> id_registry::get_unassigned_typenames() const
     {
-        typedef typename_to_ctor_t::value_type value_type;
-
         std::vector<std::string> result;
 
-        // O(Nlog(M)) ?
-        for (const value_type& v : typename_to_ctor)
-            if (!typename_to_id.count(v.first))
-                result.push_back(v.first);
+        // O(N)
+        typename_to_ctor.for_each([&](std::string const& name, ctor_t) {
+            if (!typename_to_id.contains(name))
+                result.push_back(name);
+        });
 
+        // keep the order in which ids are assigned deterministic
+        std::sort(result.begin(), result.end());
         return result;
     }
 
@@ -134,7 +130,7 @@ namespace hpx { namespace serialization { namespace detail {
         return factory.get();
     }
 
-    std::uint32_t polymorphic_id_factory::get_id(const std::string& type_name)
+    std::uint32_t polymorphic_id_factory::get_id(std::string_view type_name)
     {
         std::uint32_t id = id_registry::instance().try_get_id(type_name);
 
@@ -153,17 +149,17 @@ namespace hpx { namespace serialization { namespace detail {
 #if defined(HPX_DEBUG)
         std::string msg("known constructors:\n");
 
-        for (auto const& desc : id_registry::instance().typename_to_ctor)
-        {
-            msg += desc.first + "\n";
-        }
+        id_registry::instance().typename_to_ctor.for_each(
+            [&](std::string const& name, id_registry::ctor_t) {
+                msg += name + "\n";
+            });
 
         msg += "\nknown typenames:\n";
-        for (auto const& desc : id_registry::instance().typename_to_id)
-        {
-            msg += desc.first + " (";
-            msg += std::to_string(desc.second) + ")\n";
-        }
+        id_registry::instance().typename_to_id.for_each(
+            [&](std::string const& name, std::uint32_t id) {
+                msg += name + " (";
+                msg += std::to_string(id) + ")\n";
+            });
 
         return msg;
 #else
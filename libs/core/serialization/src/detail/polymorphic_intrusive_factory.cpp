@@ -31,15 +31,19 @@ namespace hpx { namespace serialization { namespace detail {
                 "Cannot register a factory with an empty name");
         }
 
-        auto it = map_.find(name);
-        if (it == map_.end())
-        {
-            map_.emplace(name, fun);
-        }
+        // existing entries are left untouched
+        map_.emplace(name, fun);
     }
 
     void* polymorphic_intrusive_factory::create(std::string const& name) const
     {
-        return map_.at(name)();
+        ctor_type const* ctor = map_.find(name);
+        if (ctor == nullptr)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "polymorphic_intrusive_factory::create", "Unknown typename: {}",
+                name);
+        }
+        return (*ctor)();
     }
 }}}    // namespace hpx::serialization::detail
@@ -7,8 +7,15 @@
 //  See accompanying file LICENSE_1_0.txt or copy at
 //  http://www.boost.org/LICENSE_1_0.txt)
 
+#include <hpx/config.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/serialization/detail/polymorphic_nonintrusive_factory.hpp>
 
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <typeinfo>
+
 namespace hpx { namespace serialization { namespace detail {
     polymorphic_nonintrusive_factory&
     polymorphic_nonintrusive_factory::instance()
@@ -16,4 +23,32 @@ namespace hpx { namespace serialization { namespace detail {
         hpx::util::static_<polymorphic_nonintrusive_factory> factory;
         return factory.get();
     }
+
+    polymorphic_nonintrusive_factory::class_name_type const&
+    polymorphic_nonintrusive_factory::get_class_name(
+        std::type_info const& typeinfo) const
+    {
+        class_name_type const* name = typeinfo_map_.find(typeinfo.name());
+        if (name == nullptr)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "polymorphic_nonintrusive_factory::get_class_name",
+                "Unknown type: {}", typeinfo.name());
+        }
+        return *name;
+    }
+
+    function_bunch_type const&
+    polymorphic_nonintrusive_factory::get_function_bunch(
+        std::uint64_t hash, std::string_view class_name) const
+    {
+        function_bunch_type const* bunch = map_.find(hash, class_name);
+        if (bunch == nullptr)
+        {
+            HPX_THROW_EXCEPTION(serialization_error,
+                "polymorphic_nonintrusive_factory::get_function_bunch",
+                "Unknown typename: {}", class_name);
+        }
+        return *bunch;
+    }
 }}}    // namespace hpx::serialization::detail
@@ -0,0 +1,80 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/detail/flat_type_registry.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+using hpx::serialization::detail::flat_type_registry;
+using hpx::serialization::detail::hash_type_name;
+
+// the type name hash can be computed at compile time
+static_assert(hash_type_name("") == 14695981039346656037ull);
+static_assert(hash_type_name("a") != hash_type_name("b"));
+
+void test_insert_find()
+{
+    flat_type_registry<std::uint32_t> registry;
+    HPX_TEST(registry.empty());
+    HPX_TEST(registry.find("unknown") == nullptr);
+
+    auto p = registry.emplace("hpx::lcos::base_lco", 1);
+    HPX_TEST(p.second);
+    HPX_TEST_EQ(*p.first, std::uint32_t(1));
+
+    // existing entries are not overwritten
+    p = registry.emplace("hpx::lcos::base_lco", 2);
+    HPX_TEST(!p.second);
+    HPX_TEST_EQ(*p.first, std::uint32_t(1));
+    HPX_TEST_EQ(registry.size(), std::size_t(1));
+
+    std::uint32_t const* value = registry.find("hpx::lcos::base_lco");
+    HPX_TEST(value != nullptr);
+    HPX_TEST_EQ(*value, std::uint32_t(1));
+
+    HPX_TEST(registry.contains("hpx::lcos::base_lco"));
+    HPX_TEST(!registry.contains("hpx::lcos::base_lc"));
+}
+
+void test_growth()
+{
+    constexpr std::uint32_t count = 1000;
+
+    flat_type_registry<std::uint32_t> registry;
+    for (std::uint32_t i = 0; i != count; ++i)
+    {
+        HPX_TEST(registry.emplace("type_" + std::to_string(i), i).second);
+    }
+    HPX_TEST_EQ(registry.size(), std::size_t(count));
+
+    for (std::uint32_t i = 0; i != count; ++i)
+    {
+        std::string const name = "type_" + std::to_string(i);
+        std::uint32_t const* value =
+            registry.find(hash_type_name(name), name);
+        HPX_TEST(value != nullptr);
+        HPX_TEST_EQ(*value, i);
+    }
+
+    std::size_t visited = 0;
+    registry.for_each([&](std::string const& name, std::uint32_t value) {
+        HPX_TEST_EQ(name, "type_" + std::to_string(value));
+        ++visited;
+    });
+    HPX_TEST_EQ(visited, std::size_t(count));
+}
+
+int main()
+{
+    test_insert_find();
+    test_growth();
+
+    return hpx::util::report_errors();
+}
@@ -0,0 +1,160 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/serialization/input_archive.hpp>
+#include <hpx/serialization/output_archive.hpp>
+#include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/stream_buffer.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <vector>
+
+constexpr std::size_t segment_size = 256;
+
+struct A
+{
+    std::string name;
+    std::vector<double> values;
+    std::vector<std::string> labels;
+
+    template <typename Archive>
+    void serialize(Archive& ar, unsigned)
+    {
+        // clang-format off
+        ar & name & values & labels;
+        // clang-format on
+    }
+
+    friend bool operator==(A const& lhs, A const& rhs)
+    {
+        return lhs.name == rhs.name && lhs.values == rhs.values &&
+            lhs.labels == rhs.labels;
+    }
+};
+
+A make_data()
+{
+    A a;
+    a.name = "streamed";
+    a.values.resize(10000);
+    for (std::size_t i = 0; i != a.values.size(); ++i)
+    {
+        a.values[i] = static_cast<double>(i) * 0.5;
+    }
+    for (int i = 0; i != 100; ++i)
+    {
+        a.labels.push_back("label" + std::to_string(i));
+    }
+    return a;
+}
+
+std::vector<char> save(A const& a, std::size_t& num_segments)
+{
+    std::vector<char> stream;
+    num_segments = 0;
+
+    auto sink = [&](char const* data, std::size_t size) {
+        HPX_TEST_NEQ(size, std::size_t(0));
+        stream.insert(stream.end(), data, data + size);
+        ++num_segments;
+    };
+
+    hpx::serialization::output_stream_buffer buffer(sink, segment_size);
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << a;
+    }
+
+    // nothing is left in the buffer after it has been flushed
+    buffer.flush();
+    HPX_TEST_EQ(buffer.bytes_flushed(), stream.size());
+    HPX_TEST_EQ(buffer.size(), stream.size());
+
+    return stream;
+}
+
+void test_stream_buffer()
+{
+    A const a = make_data();
+
+    std::size_t num_segments = 0;
+    std::vector<char> stream = save(a, num_segments);
+
+    // the data was emitted incrementally
+    HPX_TEST_LT(std::size_t(1), num_segments);
+
+    // the streamed data is identical to the non-streamed data
+    std::vector<char> buffer;
+    {
+        hpx::serialization::output_archive oarchive(buffer);
+        oarchive << a;
+    }
+    HPX_TEST(buffer == stream);
+
+    // read back the data in small pieces
+    std::size_t pos = 0;
+    auto source = [&](char* data, std::size_t size) -> std::size_t {
+        std::size_t n = (std::min)(size, (std::min)(std::size_t(100),
+                                             stream.size() - pos));
+        std::memcpy(data, stream.data() + pos, n);
+        pos += n;
+        return n;
+    };
+
+    hpx::serialization::input_stream_buffer in(source, segment_size);
+    hpx::serialization::input_archive iarchive(in);
+
+    A b;
+    iarchive >> b;
+    HPX_TEST(a == b);
+    HPX_TEST_EQ(in.bytes_consumed(), stream.size());
+}
+
+void test_stream_buffer_too_short()
+{
+    std::size_t num_segments = 0;
+    std::vector<char> stream = save(make_data(), num_segments);
+    stream.resize(stream.size() / 2);
+
+    std::size_t pos = 0;
+    auto source = [&](char* data, std::size_t size) -> std::size_t {
+        std::size_t n = (std::min)(size, stream.size() - pos);
+        std::memcpy(data, stream.data() + pos, n);
+        pos += n;
+        return n;
+    };
+
+    hpx::serialization::input_stream_buffer in(source, segment_size);
+    hpx::serialization::input_archive iarchive(in);
+
+    bool caught_exception = false;
+    try
+    {
+        A b;
+        iarchive >> b;
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::serialization_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+int main()
+{
+    test_stream_buffer();
+    test_stream_buffer_too_short();
+
+    return hpx::util::report_errors();
+}
@@ -9,6 +9,7 @@
 
 #include <hpx/config.hpp>
 #include <hpx/actions/apply_helper_fwd.hpp>
+#include <hpx/actions/detail/adaptive_execution.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
 #include <hpx/actions_base/traits/action_decorate_continuation.hpp>
@@ -18,11 +19,14 @@
 #include <hpx/actions_base/traits/action_stacksize.hpp>
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/coroutines/thread_enums.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/naming_base/address.hpp>
+#include <hpx/runtime_local/report_error.hpp>
 #include <hpx/runtime_local/state.hpp>
 #include <hpx/threading_base/thread_helpers.hpp>
 
 #include <chrono>
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <thread>
@@ -45,25 +49,44 @@ namespace hpx { namespace applier { namespace detail {
 
     ///////////////////////////////////////////////////////////////////////////
     template <typename Action, typename... Ts>
-    void call_async(threads::thread_init_data&& data,
+    threads::thread_function_type construct_thread_function(
         hpx::id_type const& target, naming::address::address_type lva,
-        naming::address::component_type comptype,
-        threads::thread_priority priority, Ts&&... vs)
+        naming::address::component_type comptype, Ts&&... vs)
     {
         using continuation_type = traits::action_continuation_t<Action>;
 
         continuation_type cont;
         if (traits::action_decorate_continuation<Action>::call(cont))    //-V614
         {
-            data.func = Action::construct_thread_function(
+            return Action::construct_thread_function(
                 target, HPX_MOVE(cont), lva, comptype, HPX_FORWARD(Ts, vs)...);
         }
-        else
-        {
-            data.func = Action::construct_thread_function(
-                target, lva, comptype, HPX_FORWARD(Ts, vs)...);
-        }
+        return Action::construct_thread_function(
+            target, lva, comptype, HPX_FORWARD(Ts, vs)...);
+    }
+
+    template <typename Action, typename Continuation, typename... Ts>
+    threads::thread_function_type construct_thread_function(
+        Continuation&& cont, hpx::id_type const& target,
+        naming::address::address_type lva,
+        naming::address::component_type comptype, Ts&&... vs)
+    {
+        // first decorate the continuation
+        traits::action_decorate_continuation<Action>::call(cont);
 
+        return Action::construct_thread_function(target,
+            HPX_FORWARD(Continuation, cont), lva, comptype,
+            HPX_FORWARD(Ts, vs)...);
+    }
+
+    // schedule a new thread executing the (already constructed) thread
+    // function of the given action
+    template <typename Action>
+    void schedule_thread_function(threads::thread_init_data& data,
+        naming::address::address_type lva,
+        naming::address::component_type comptype,
+        threads::thread_priority priority)
+    {
 #if defined(HPX_HAVE_THREAD_DESCRIPTION)
 #if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
         data.description =
@@ -85,40 +108,27 @@ namespace hpx { namespace applier { namespace detail {
         traits::action_schedule_thread<Action>::call(lva, comptype, data);
     }
 
+    template <typename Action, typename... Ts>
+    void call_async(threads::thread_init_data&& data,
+        hpx::id_type const& target, naming::address::address_type lva,
+        naming::address::component_type comptype,
+        threads::thread_priority priority, Ts&&... vs)
+    {
+        data.func = construct_thread_function<Action>(
+            target, lva, comptype, HPX_FORWARD(Ts, vs)...);
+        schedule_thread_function<Action>(data, lva, comptype, priority);
+    }
+
     template <typename Action, typename Continuation, typename... Ts>
     void call_async(threads::thread_init_data&& data, Continuation&& cont,
         hpx::id_type const& target, naming::address::address_type lva,
         naming::address::component_type comptype,
         threads::thread_priority priority, Ts&&... vs)
     {
-        // first decorate the continuation
-        traits::action_decorate_continuation<Action>::call(cont);
-
-        // now, schedule the thread
-        data.func = Action::construct_thread_function(target,
-            HPX_FORWARD(Continuation, cont), lva, comptype,
+        data.func = construct_thread_function<Action>(
+            HPX_FORWARD(Continuation, cont), target, lva, comptype,
             HPX_FORWARD(Ts, vs)...);
-
-#if defined(HPX_HAVE_THREAD_DESCRIPTION)
-#if HPX_HAVE_ITTNOTIFY != 0 && !defined(HPX_HAVE_APEX)
-        data.description =
-            util::thread_description(actions::detail::get_action_name<Action>(),
-                actions::detail::get_action_name_itt<Action>());
-#else
-        data.description = actions::detail::get_action_name<Action>();
-#endif
-#endif
-        data.priority = fix_priority<Action>(priority);
-        data.stacksize = static_cast<threads::thread_stacksize>(
-            traits::action_stacksize<Action>::value);
-
-        while (!threads::threadmanager_is_at_least(hpx::state::running))
-        {
-            std::this_thread::sleep_for(
-                std::chrono::milliseconds(HPX_NETWORK_RETRIES_SLEEP));
-        }
-
-        traits::action_schedule_thread<Action>::call(lva, comptype, data);
+        schedule_thread_function<Action>(data, lva, comptype, priority);
     }
 
     template <typename Action, typename... Ts>
@@ -245,4 +255,128 @@ namespace hpx { namespace applier { namespace detail {
             }
         }
     };
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Measures the execution time of a thread function of an action executed
+    // on a new thread
+    struct measure_execution_time
+    {
+        threads::thread_result_type operator()(
+            threads::thread_restart_state state)
+        {
+            std::uint64_t const start =
+                hpx::chrono::high_resolution_clock::now();
+            threads::thread_result_type result = f_(state);
+            data_->record_execution_time(
+                static_cast<std::int64_t>(
+                    hpx::chrono::high_resolution_clock::now() - start),
+                false);
+            return result;
+        }
+
+        threads::thread_function_type f_;
+        actions::detail::adaptive_execution_data* data_;
+    };
+
+    // Remote invocations of non-blocking actions are executed directly if
+    // their execution time measured so far is short enough, otherwise they
+    // are executed on a new thread (see adaptive_execution_data)
+    template <typename Action>
+    struct adaptive_apply_helper
+    {
+        template <typename... Ts>
+        static void call(actions::detail::adaptive_execution_data& adaptive,
+            threads::thread_init_data&& data, hpx::id_type const& target,
+            naming::address::address_type lva,
+            naming::address::component_type comptype,
+            threads::thread_priority priority, Ts&&... vs)
+        {
+            // route launch policy through component
+            launch policy =
+                traits::action_select_direct_execution<Action>::call(
+                    launch::async, lva);
+
+            if (policy != launch::async)
+            {
+                call_sync<Action>(lva, comptype, HPX_FORWARD(Ts, vs)...);
+            }
+            else if (execute_directly(adaptive))
+            {
+                std::uint64_t const start =
+                    hpx::chrono::high_resolution_clock::now();
+                try
+                {
+                    call_sync<Action>(lva, comptype, HPX_FORWARD(Ts, vs)...);
+                }
+                catch (...)
+                {
+                    // report this error to the console in any case, as
+                    // if the action was executed on a new thread
+                    hpx::report_error(std::current_exception());
+                }
+                adaptive.record_execution_time(
+                    static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now() - start),
+                    true);
+            }
+            else
+            {
+                data.func = measure_execution_time{
+                    construct_thread_function<Action>(
+                        target, lva, comptype, HPX_FORWARD(Ts, vs)...),
+                    &adaptive};
+                schedule_thread_function<Action>(data, lva, comptype, priority);
+            }
+        }
+
+        template <typename Continuation, typename... Ts>
+        static void call(actions::detail::adaptive_execution_data& adaptive,
+            threads::thread_init_data&& data, Continuation&& cont,
+            hpx::id_type const& target, naming::address::address_type lva,
+            naming::address::component_type comptype,
+            threads::thread_priority priority, Ts&&... vs)
+        {
+            // route launch policy through component
+            launch policy =
+                traits::action_select_direct_execution<Action>::call(
+                    launch::async, lva);
+
+            if (policy != launch::async)
+            {
+                call_sync<Action>(HPX_FORWARD(Continuation, cont), lva,
+                    comptype, HPX_FORWARD(Ts, vs)...);
+            }
+            else if (execute_directly(adaptive))
+            {
+                std::uint64_t const start =
+                    hpx::chrono::high_resolution_clock::now();
+
+                // exceptions are propagated through the continuation
+                call_sync<Action>(HPX_FORWARD(Continuation, cont), lva,
+                    comptype, HPX_FORWARD(Ts, vs)...);
+
+                adaptive.record_execution_time(
+                    static_cast<std::int64_t>(
+                        hpx::chrono::high_resolution_clock::now() - start),
+                    true);
+            }
+            else
+            {
+                data.func = measure_execution_time{
+                    construct_thread_function<Action>(
+                        HPX_FORWARD(Continuation, cont), target, lva, comptype,
+                        HPX_FORWARD(Ts, vs)...),
+                    &adaptive};
+                schedule_thread_function<Action>(data, lva, comptype, priority);
+            }
+        }
+
+        static bool execute_directly(
+            actions::detail::adaptive_execution_data const& adaptive)
+        {
+            return adaptive.execute_directly() &&
+                threads::threadmanager_is_at_least(hpx::state::running) &&
+                this_thread::has_sufficient_stack_space();
+        }
+    };
 }}}    // namespace hpx::applier::detail
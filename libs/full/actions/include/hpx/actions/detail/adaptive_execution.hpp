@@ -0,0 +1,65 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/util/get_and_reset_value.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace actions { namespace detail {
+
+    // Return the execution time (in nanoseconds) below which remote
+    // invocations of non-blocking actions are executed directly (see
+    // hpx.parcel.direct_execution_threshold)
+    HPX_EXPORT std::int64_t get_direct_execution_threshold();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Keeps track of the execution time of the remote invocations of one
+    // non-blocking action and decides whether those can be executed directly
+    // on the thread receiving the parcel. An action is executed directly only
+    // after a minimal number of invocations have been measured and as long as
+    // the (exponentially weighted) average of the measured execution times
+    // stays below the threshold. A single invocation exceeding the threshold
+    // by far restarts the measurements, that is, the following invocations
+    // are executed on new threads again.
+    class HPX_EXPORT adaptive_execution_data
+    {
+    public:
+        static constexpr std::uint32_t min_samples = 16;
+        static constexpr std::int64_t outlier_factor = 4;
+
+        bool execute_directly() const
+        {
+            return samples_.load(std::memory_order_relaxed) >= min_samples &&
+                average_time_.load(std::memory_order_relaxed) <
+                get_direct_execution_threshold();
+        }
+
+        void record_execution_time(std::int64_t time, bool direct) noexcept;
+
+        std::int64_t get_direct_execution_count(bool reset) noexcept
+        {
+            return util::get_and_reset_value(direct_count_, reset);
+        }
+
+        std::int64_t get_average_execution_time(bool /*reset*/) const noexcept
+        {
+            return average_time_.load(std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<std::int64_t> average_time_{0};
+        std::atomic<std::uint32_t> samples_{0};
+        std::atomic<std::int64_t> direct_count_{0};
+    };
+}}}    // namespace hpx::actions::detail
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -14,17 +14,20 @@
 
 #include <hpx/actions/actions_fwd.hpp>
 #include <hpx/actions/base_action.hpp>
+#include <hpx/actions/detail/adaptive_execution.hpp>
 #include <hpx/actions/register_action.hpp>
 #include <hpx/actions_base/actions_base_support.hpp>
 #include <hpx/actions_base/detail/invocation_count_registry.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
 #include <hpx/actions_base/traits/action_does_termination_detection.hpp>
+#include <hpx/actions_base/traits/action_is_non_blocking.hpp>
 #include <hpx/actions_base/traits/action_priority.hpp>
 #include <hpx/actions_base/traits/action_schedule_thread.hpp>
 #include <hpx/actions_base/traits/action_stacksize.hpp>
 #include <hpx/actions_base/traits/action_trigger_continuation_fwd.hpp>
 #include <hpx/actions_base/traits/action_was_object_migrated.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
+#include <hpx/components_base/traits/action_decorate_function.hpp>
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
@@ -174,6 +177,33 @@ namespace hpx { namespace actions {
 
         using direct_execution = typename Action::direct_execution;
 
+        // Remote invocations of non-blocking actions are executed directly if
+        // their measured execution time is short enough. This is not
+        // supported for actions which are decorated (e.g. actions invoked on
+        // migratable components, or actions with a fixed priority).
+        using adaptive_execution = std::integral_constant<bool,
+            traits::action_is_non_blocking_v<derived_type> &&
+                !traits::has_decorates_action_v<derived_type> &&
+                !direct_execution::value>;
+
+        // Return whether the next remote invocation of this action will be
+        // executed directly
+        static bool executes_directly()
+        {
+            if constexpr (direct_execution::value)
+            {
+                return true;
+            }
+            else if constexpr (adaptive_execution::value)
+            {
+                return adaptive_execution_data_.execute_directly();
+            }
+            else
+            {
+                return false;
+            }
+        }
+
         // construct an empty transfer_action to avoid serialization overhead
         transfer_base_action() = default;
 
@@ -296,6 +326,13 @@ namespace hpx { namespace actions {
             return util::get_and_reset_value(invocation_count_, reset);
         }
 
+        /// Extract the number of remote invocations of this action which were
+        /// executed directly
+        static std::int64_t get_direct_execution_count(bool reset)
+        {
+            return adaptive_execution_data_.get_direct_execution_count(reset);
+        }
+
         // serialization support
         // loading ...
         void load_base(hpx::serialization::input_archive& ar)
@@ -322,12 +359,18 @@ namespace hpx { namespace actions {
         {
             ++invocation_count_;
         }
+
+        static detail::adaptive_execution_data adaptive_execution_data_;
     };
 
     template <typename Action>
     std::atomic<std::int64_t> transfer_base_action<Action>::invocation_count_(
         0);
 
+    template <typename Action>
+    detail::adaptive_execution_data
+        transfer_base_action<Action>::adaptive_execution_data_;
+
     namespace detail {
         template <typename Action>
         void register_remote_action_invocation_count(
@@ -337,6 +380,15 @@ namespace hpx { namespace actions {
                 hpx::actions::detail::get_action_name<Action>(),
                 &transfer_base_action<Action>::get_invocation_count);
         }
+
+        template <typename Action>
+        void register_remote_action_direct_execution_count(
+            invocation_count_registry& registry)
+        {
+            registry.register_class(
+                hpx::actions::detail::get_action_name<Action>(),
+                &transfer_base_action<Action>::get_direct_execution_count);
+        }
     }    // namespace detail
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,60 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions/detail/adaptive_execution.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace actions { namespace detail {
+
+    std::int64_t get_direct_execution_threshold()
+    {
+        static std::int64_t const threshold =
+            hpx::util::from_string<std::int64_t>(
+                hpx::get_config_entry("hpx.parcel.direct_execution_threshold",
+                    HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD),
+                HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD);
+        return threshold;
+    }
+
+    void adaptive_execution_data::record_execution_time(
+        std::int64_t time, bool direct) noexcept
+    {
+        if (direct)
+        {
+            ++direct_count_;
+        }
+
+        // The updates below are not atomic as a whole, concurrent updates
+        // may get lost, which is acceptable for the purpose of estimating
+        // the execution time.
+        if (time >= outlier_factor * get_direct_execution_threshold())
+        {
+            samples_.store(0, std::memory_order_relaxed);
+            average_time_.store(time, std::memory_order_relaxed);
+            return;
+        }
+
+        std::uint32_t const samples = samples_.load(std::memory_order_relaxed);
+        std::int64_t const average =
+            average_time_.load(std::memory_order_relaxed);
+
+        // exponentially weighted moving average, the first measurement
+        // initializes the average
+        average_time_.store(
+            samples == 0 ? time : average + (time - average) / 8,
+            std::memory_order_relaxed);
+
+        if (samples < min_samples)
+        {
+            samples_.store(samples + 1, std::memory_order_relaxed);
+        }
+    }
+}}}    // namespace hpx::actions::detail
@@ -20,6 +20,7 @@
 #include <hpx/actions_base/traits/action_continuation.hpp>
 #include <hpx/actions_base/traits/action_priority.hpp>
 #include <hpx/actions_base/traits/action_remote_result.hpp>
+#include <hpx/actions_base/traits/action_is_non_blocking.hpp>
 #include <hpx/actions_base/traits/action_stacksize.hpp>
 #include <hpx/actions_base/traits/action_trigger_continuation_fwd.hpp>
 #include <hpx/actions_base/traits/is_distribution_policy.hpp>
@@ -648,6 +649,26 @@ namespace hpx { namespace actions {
 /**/
 #endif
 
+///////////////////////////////////////////////////////////////////////////////
+// Mark an action as never suspending, remote invocations of such an action
+// are executed directly on the thread receiving the parcel as long as their
+// measured execution time stays below the configured threshold (see
+// hpx.parcel.direct_execution_threshold). This has to be used before the
+// action is registered.
+#if defined(HPX_COMPUTE_DEVICE_CODE)
+#define HPX_ACTION_IS_NON_BLOCKING(action) /**/
+#else
+#define HPX_ACTION_IS_NON_BLOCKING(action)                                     \
+    namespace hpx { namespace traits {                                         \
+            template <>                                                        \
+            struct action_is_non_blocking<action> : std::true_type             \
+            {                                                                  \
+            };                                                                 \
+        }                                                                      \
+    }                                                                          \
+    /**/
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 #if defined(HPX_COMPUTE_DEVICE_CODE)
 #define HPX_ACTION_HAS_PRIORITY(action, priority)      /**/
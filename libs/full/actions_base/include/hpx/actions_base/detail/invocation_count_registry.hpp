@@ -33,6 +33,10 @@ namespace hpx { namespace actions { namespace detail {
         static invocation_count_registry& local_instance();
 #if defined(HPX_HAVE_NETWORKING)
         static invocation_count_registry& remote_instance();
+
+        // number of remote invocations executed directly on the thread
+        // receiving the parcel
+        static invocation_count_registry& direct_execution_instance();
 #endif
 
         void register_class(
@@ -57,6 +61,12 @@ namespace hpx { namespace actions { namespace detail {
         {
         };
         friend struct hpx::util::static_<invocation_count_registry, remote_tag>;
+
+        struct direct_execution_tag
+        {
+        };
+        friend struct hpx::util::static_<invocation_count_registry,
+            direct_execution_tag>;
 #endif
         map_type map_;
     };
@@ -69,6 +79,10 @@ namespace hpx { namespace actions { namespace detail {
     template <typename Action>
     void register_remote_action_invocation_count(
         invocation_count_registry& registry);
+
+    template <typename Action>
+    void register_remote_action_direct_execution_count(
+        invocation_count_registry& registry);
 #endif
 
     template <typename Action>
@@ -82,6 +96,8 @@ namespace hpx { namespace actions { namespace detail {
 #if defined(HPX_HAVE_NETWORKING)
             register_remote_action_invocation_count<Action>(
                 invocation_count_registry::remote_instance());
+            register_remote_action_direct_execution_count<Action>(
+                invocation_count_registry::direct_execution_instance());
 #endif
         }
 
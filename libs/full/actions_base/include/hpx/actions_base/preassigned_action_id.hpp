@@ -86,6 +86,7 @@ namespace hpx { namespace actions {
         primary_namespace_unbind_gid_action_id,
         primary_namespace_statistics_counter_action_id,
         remove_from_connection_cache_action_id,
+        set_response_error_action_id,
         set_value_action_agas_bool_response_type_id,
         set_value_action_agas_id_type_response_type_id,
         shutdown_action_id,
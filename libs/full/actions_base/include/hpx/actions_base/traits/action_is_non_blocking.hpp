@@ -0,0 +1,27 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace traits {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Customization point for actions which never suspend. Remote
+    // invocations of such actions may be executed directly on the thread
+    // receiving the parcel if their measured execution time is short enough.
+    template <typename Action, typename Enable = void>
+    struct action_is_non_blocking : std::false_type
+    {
+    };
+
+    template <typename Action>
+    inline constexpr bool action_is_non_blocking_v =
+        action_is_non_blocking<Action>::value;
+}}    // namespace hpx::traits
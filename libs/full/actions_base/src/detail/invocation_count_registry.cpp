@@ -27,6 +27,14 @@ namespace hpx { namespace actions { namespace detail {
         hpx::util::static_<invocation_count_registry, remote_tag> registry;
         return registry.get();
     }
+
+    invocation_count_registry&
+    invocation_count_registry::direct_execution_instance()
+    {
+        hpx::util::static_<invocation_count_registry, direct_execution_tag>
+            registry;
+        return registry.get();
+    }
 #endif
 
     void invocation_count_registry::register_class(
@@ -11,12 +11,14 @@
 
 #include <hpx/config.hpp>
 #include <hpx/agas/agas_fwd.hpp>
-#include <hpx/cache/lru_cache.hpp>
-#include <hpx/cache/statistics/local_full_statistics.hpp>
+#include <hpx/agas/gva_cache.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/datastructures/detail/dynamic_bitset.hpp>
 #include <hpx/functional/function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/promise.hpp>
 #include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/runtime_configuration.hpp>
 #include <hpx/naming_base/address.hpp>
@@ -61,16 +63,12 @@ namespace hpx { namespace agas {
         using mutex_type = hpx::spinlock;
 
         // gva cache
-        struct gva_cache_key;
-
-        using gva_cache_type = hpx::util::cache::lru_cache<gva_cache_key, gva,
-            hpx::util::cache::statistics::local_full_statistics>;
+        using gva_cache_type = detail::gva_cache;
 
         using migrated_objects_table_type = std::set<naming::gid_type>;
         using refcnt_requests_type = std::map<naming::gid_type, std::int64_t>;
 
-        mutable mutex_type gva_cache_mtx_;
-        std::shared_ptr<gva_cache_type> gva_cache_;
+        std::unique_ptr<gva_cache_type> gva_cache_;
 
         mutable mutex_type migrated_objects_mtx_;
         migrated_objects_table_type migrated_objects_table_;
@@ -78,13 +76,57 @@ namespace hpx { namespace agas {
         mutable mutex_type console_cache_mtx_;
         std::uint32_t console_cache_;
 
+        // Pending reference count requests are buffered separately for the
+        // localities owning the referenced objects (several localities may
+        // share a buffer). Increments and decrements for the same GID are
+        // merged while being buffered. A buffer is flushed once it holds
+        // max_refcnt_requests_ requests, once its oldest request has been
+        // held back for max_refcnt_delay_ nanoseconds (even if no further
+        // requests are made, see schedule_refcnt_flush), or (see
+        // piggyback_refcnt_requests) together with the next parcel sent to
+        // the buffer's localities after half of that time.
+        //
+        // Increments which are not compensated by buffered decrements are
+        // sent right away, unless another increment is already in flight. In
+        // that case they are queued and sent all at once as soon as the
+        // increment in flight has been acknowledged.
+        struct incref_request
+        {
+            naming::gid_type id_;
+            std::int64_t credit_;
+            hpx::promise<std::int64_t> promise_;
+        };
+
+        struct refcnt_buffer
+        {
+            mutex_type mtx_;
+            std::shared_ptr<refcnt_requests_type> requests_ =
+                std::make_shared<refcnt_requests_type>();
+            std::size_t count_ = 0;
+
+            // point in time by which the buffer has to be flushed, zero if
+            // the buffer is empty
+            std::atomic<std::uint64_t> deadline_{0};
+
+            std::vector<incref_request> increfs_;
+            bool incref_in_flight_ = false;
+        };
+
+        using refcnt_buffer_type = util::cache_aligned_data<refcnt_buffer>;
+
+        static constexpr std::size_t num_refcnt_buffers = 16;
+
+        refcnt_buffer& refcnt_buffer_for(
+            naming::gid_type const& id) const noexcept;
+        refcnt_buffer& refcnt_buffer_for(
+            std::uint32_t locality_id) const noexcept;
+
         std::size_t const max_refcnt_requests_;
+        std::uint64_t const max_refcnt_delay_;
 
-        mutex_type refcnt_requests_mtx_;
-        std::size_t refcnt_requests_count_;
-        bool enable_refcnt_caching_;
+        std::atomic<bool> enable_refcnt_caching_;
 
-        std::shared_ptr<refcnt_requests_type> refcnt_requests_;
+        std::unique_ptr<refcnt_buffer_type[]> refcnt_buffers_;
 
         service_mode const service_type;
         runtime_mode const runtime_type;
@@ -176,6 +218,15 @@ namespace hpx { namespace agas {
         // FIXME: document (add comments)
         void garbage_collect(error_code& ec = throws);
 
+#if defined(HPX_HAVE_NETWORKING)
+        // Append parcels carrying the reference count requests buffered for
+        // the given locality if those have been held back for long enough.
+        // This is invoked for each parcel sent to the locality, allowing for
+        // the requests to be transferred together with the parcel.
+        void piggyback_refcnt_requests(
+            std::uint32_t locality_id, std::vector<parcelset::parcel>& parcels);
+#endif
+
         std::int64_t synchronize_with_async_incref(
             hpx::future<std::int64_t> fut, hpx::id_type const& id,
             std::int64_t compensated_credit);
@@ -228,21 +279,29 @@ namespace hpx { namespace agas {
         bool was_object_migrated_locked(naming::gid_type const& id);
 
     private:
-        /// Assumes that \a refcnt_requests_mtx_ is locked.
-        void send_refcnt_requests(
+        /// Assumes that the mutex of \a b is locked.
+        void send_refcnt_requests(refcnt_buffer& b,
             std::unique_lock<mutex_type>& l, error_code& ec = throws);
 
-        /// Assumes that \a refcnt_requests_mtx_ is locked.
-        void send_refcnt_requests_non_blocking(
+        /// Assumes that the mutex of \a b is locked.
+        void send_refcnt_requests_non_blocking(refcnt_buffer& b,
             std::unique_lock<mutex_type>& l, error_code& ec);
 
-        /// Assumes that \a refcnt_requests_mtx_ is locked.
+        /// Assumes that the mutex of \a b is locked.
         std::vector<hpx::future<std::vector<std::int64_t>>>
-        send_refcnt_requests_async(std::unique_lock<mutex_type>& l);
+        send_refcnt_requests_async(
+            refcnt_buffer& b, std::unique_lock<mutex_type>& l);
 
-        /// Assumes that \a refcnt_requests_mtx_ is locked.
-        void send_refcnt_requests_sync(
-            std::unique_lock<mutex_type>& l, error_code& ec);
+        /// Send the buffered requests of \a b once their deadline has
+        /// passed, even if no further requests are made in the meantime.
+        void schedule_refcnt_flush(refcnt_buffer& b, std::uint64_t deadline);
+
+        /// Send the increments queued while another increment was in flight.
+        void send_pending_increfs(refcnt_buffer& b);
+
+        /// Invalidate the cached entries of a range which is being unbound.
+        void remove_cached_range(
+            naming::gid_type const& lower_id, std::uint64_t count);
 
     public:
         // Helper functions to access the current cache statistics
@@ -251,6 +310,7 @@ namespace hpx { namespace agas {
         std::uint64_t get_cache_misses(bool);
         std::uint64_t get_cache_evictions(bool);
         std::uint64_t get_cache_insertions(bool);
+        std::uint64_t get_cache_contentions(bool);
 
         std::uint64_t get_cache_get_entry_count(bool reset);
         std::uint64_t get_cache_insertion_entry_count(bool reset);
@@ -1162,6 +1222,11 @@ namespace hpx { namespace agas {
         void remove_cache_entry(
             naming::gid_type const& id, error_code& ec = throws);
 
+        /// \warning This function is for internal use only. It is dangerous and
+        ///          may break your code if you use it.
+        void remove_cache_entries(std::vector<naming::gid_type> const& ids,
+            error_code& ec = throws);
+
         /// \warning This function is for internal use only. It is dangerous and
         ///          may break your code if you use it.
         void clear_cache(error_code& ec = throws);
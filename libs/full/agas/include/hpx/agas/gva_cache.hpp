@@ -0,0 +1,198 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/concurrency.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace agas { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The cache of resolved global virtual addresses used by the addressing
+    // service. Each entry maps a contiguous range of global ids to the
+    // address of the first object in the range.
+    //
+    // The global id space is divided into blocks of consecutive ids, each
+    // block is managed by one of a number of shards (selected by hashing the
+    // block). Entries for ranges spanning more than one block are kept in a
+    // separate (rarely modified) range table. Each shard and the range table
+    // are protected by a reader/writer spinlock, lookups are performed
+    // concurrently with other lookups and touch nothing but the referenced
+    // bit of the entry found, which drives a CLOCK (second chance) eviction
+    // policy.
+    //
+    // The capacity is divided evenly between the shards, the range table
+    // may hold up to the full capacity on its own. The cache may therefore
+    // hold up to twice its capacity if many ranges are cached.
+    class HPX_EXPORT gva_cache
+    {
+    public:
+        static constexpr std::size_t default_num_shards = 32;
+
+        explicit gva_cache(std::size_t capacity = HPX_AGAS_LOCAL_CACHE_SIZE,
+            std::size_t num_shards = default_num_shards);
+        ~gva_cache();
+
+        gva_cache(gva_cache const&) = delete;
+        gva_cache(gva_cache&&) = delete;
+        gva_cache& operator=(gva_cache const&) = delete;
+        gva_cache& operator=(gva_cache&&) = delete;
+
+        // Change the overall number of entries the cache may hold. Surplus
+        // entries are evicted during subsequent insertions.
+        void reserve(std::size_t capacity) noexcept;
+
+        std::size_t capacity() const noexcept;
+        std::size_t size() const noexcept;
+
+        // Insert the address of the range of count ids starting at id, or
+        // update an existing entry for exactly the same range. Returns false
+        // if the range overlaps with a different range already stored in the
+        // cache, in which case the start and size of that range are returned
+        // in collision_base and collision_count. Entries never overlap, no
+        // matter whether they are inserted concurrently.
+        bool update(naming::gid_type const& id, std::uint64_t count,
+            gva const& g, naming::gid_type& collision_base,
+            std::uint64_t& collision_count);
+
+        // Look up the entry the given id belongs to. On success the address
+        // of the range and the first id of the range are returned. Every
+        // lookup acquires and releases the lock of the responsible shard in
+        // shared mode and updates the statistics of the shard, i.e. it
+        // performs atomic read-modify-write operations on cache lines shared
+        // with all concurrent lookups in the same shard. The range table is
+        // locked only if it is not empty.
+        bool get(naming::gid_type const& id, naming::gid_type& idbase, gva& g);
+
+        // Remove the entry (entries) covering the given id(s), returns the
+        // number of removed entries. The batched version acquires the lock
+        // of each affected shard only once.
+        std::size_t erase(naming::gid_type const& id);
+        std::size_t erase(std::vector<naming::gid_type> const& ids);
+
+        void clear();
+
+        // access statistics
+        std::uint64_t hits(bool reset) noexcept;
+        std::uint64_t misses(bool reset) noexcept;
+        std::uint64_t evictions(bool reset) noexcept;
+        std::uint64_t insertions(bool reset) noexcept;
+        std::uint64_t contentions(bool reset) noexcept;
+
+        std::uint64_t get_entry_count(bool reset) noexcept;
+        std::uint64_t insert_entry_count(bool reset) noexcept;
+        std::uint64_t update_entry_count(bool reset) noexcept;
+        std::uint64_t erase_entry_count(bool reset) noexcept;
+
+        std::uint64_t get_entry_time(bool reset) noexcept;
+        std::uint64_t insert_entry_time(bool reset) noexcept;
+        std::uint64_t update_entry_time(bool reset) noexcept;
+        std::uint64_t erase_entry_time(bool reset) noexcept;
+
+    private:
+        // Reader/writer spinlock, the locking functions return whether the
+        // lock was available right away.
+        class shared_spinlock
+        {
+        public:
+            bool lock_shared();
+            void unlock_shared();
+
+            bool lock();
+            void unlock();
+
+        private:
+            static constexpr std::uint32_t writer = 0x80000000;
+            std::atomic<std::uint32_t> state_{0};
+        };
+
+        struct entry
+        {
+            entry(naming::gid_type const& last, gva const& g) noexcept
+              : last_(last)
+              , gva_(g)
+              , referenced_(false)
+            {
+            }
+
+            naming::gid_type last_;    // last id covered by this entry
+            gva gva_;
+            mutable std::atomic<bool> referenced_;
+        };
+
+        enum statistics_type
+        {
+            stat_hits = 0,
+            stat_misses,
+            stat_evictions,
+            stat_insertions,
+            stat_contentions,
+            stat_get_entry_count,
+            stat_insert_entry_count,
+            stat_update_entry_count,
+            stat_erase_entry_count,
+            stat_get_entry_time,
+            stat_insert_entry_time,
+            stat_update_entry_time,
+            stat_erase_entry_time,
+            num_statistics
+        };
+
+        // entries are keyed by the first id of the range they cover
+        using entries_type = std::map<naming::gid_type, entry>;
+
+        struct table
+        {
+            mutable shared_spinlock mtx_;
+            entries_type entries_;
+            naming::gid_type clock_hand_;
+            std::atomic<std::size_t> size_{0};
+            std::atomic<std::uint64_t> statistics_[num_statistics] = {};
+        };
+
+        using table_type = hpx::util::cache_aligned_data<table>;
+
+        table& shard_for(naming::gid_type const& id) const noexcept;
+
+        void record(table& t, statistics_type s, std::uint64_t value = 1) const
+            noexcept;
+        std::uint64_t get_statistics(statistics_type s, bool reset) noexcept;
+
+        static entries_type::iterator find_overlapping(entries_type& entries,
+            naming::gid_type const& first, naming::gid_type const& last);
+
+        // Look for an entry in any of the shards overlapping with the given
+        // range.
+        bool find_in_shards(naming::gid_type const& first,
+            naming::gid_type const& last, naming::gid_type& collision_base,
+            std::uint64_t& collision_count);
+
+        bool update_locked(table& t, naming::gid_type const& first,
+            naming::gid_type const& last, gva const& g,
+            naming::gid_type& collision_base, std::uint64_t& collision_count);
+        void evict_locked(table& t, std::size_t capacity);
+        std::size_t erase_locked(table& t, naming::gid_type const& id);
+
+        std::atomic<std::size_t> capacity_;
+        std::size_t const num_shards_;
+        std::unique_ptr<table_type[]> shards_;
+        table ranges_;
+    };
+}}}    // namespace hpx::agas::detail
+
+#include <hpx/config/warnings_suffix.hpp>
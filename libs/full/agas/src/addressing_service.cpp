@@ -27,19 +27,29 @@
 #include <hpx/modules/execution.hpp>
 #include <hpx/modules/format.hpp>
 #include <hpx/modules/logging.hpp>
+#include <hpx/modules/timing.hpp>
 #include <hpx/naming/split_gid.hpp>
 #include <hpx/runtime_configuration/runtime_configuration.hpp>
 #include <hpx/runtime_local/runtime_local_fwd.hpp>
 #include <hpx/serialization/serialize.hpp>
 #include <hpx/serialization/vector.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
+#include <hpx/threading/thread.hpp>
 #include <hpx/type_support/unused.hpp>
 #include <hpx/util/get_entry_as.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/async_distributed/put_parcel.hpp>
+#endif
+
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <functional>
+#include <iterator>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -51,80 +61,15 @@
 
 namespace hpx { namespace agas {
 
-    struct addressing_service::gva_cache_key
-    {    // {{{ gva_cache_key implementation
-    private:
-        using key_type = std::pair<naming::gid_type, naming::gid_type>;
-
-        key_type key_;
-
-    public:
-        gva_cache_key()
-          : key_()
-        {
-        }
-
-        explicit gva_cache_key(
-            naming::gid_type const& id, std::uint64_t count = 1)
-          : key_(naming::detail::get_stripped_gid(id),
-                naming::detail::get_stripped_gid(id) + (count - 1))
-        {
-            HPX_ASSERT(count);
-        }
-
-        naming::gid_type get_gid() const
-        {
-            return key_.first;
-        }
-
-        std::uint64_t get_count() const
-        {
-            naming::gid_type const size = key_.second - key_.first;
-            HPX_ASSERT(size.get_msb() == 0);
-            return size.get_lsb();
-        }
-
-        friend bool operator<(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            return lhs.key_.second < rhs.key_.first;
-        }
-
-        friend bool operator==(
-            gva_cache_key const& lhs, gva_cache_key const& rhs)
-        {
-            // Direct hit
-            if (lhs.key_ == rhs.key_)
-            {
-                return true;
-            }
-
-            // Is lhs in rhs?
-            if (1 == lhs.get_count() && 1 != rhs.get_count())
-            {
-                return rhs.key_.first <= lhs.key_.first &&
-                    lhs.key_.second <= rhs.key_.second;
-            }
-
-            // Is rhs in lhs?
-            else if (1 != lhs.get_count() && 1 == rhs.get_count())
-            {
-                return lhs.key_.first <= rhs.key_.first &&
-                    rhs.key_.second <= lhs.key_.second;
-            }
-
-            return false;
-        }
-    };    // }}}
-
     addressing_service::addressing_service(
         util::runtime_configuration const& ini_)
       : gva_cache_(new gva_cache_type)
       , console_cache_(naming::invalid_locality_id)
       , max_refcnt_requests_(ini_.get_agas_max_pending_refcnt_requests())
-      , refcnt_requests_count_(0)
+      , max_refcnt_delay_(
+            ini_.get_agas_max_pending_refcnt_delay() * 1000000)    // ms -> ns
       , enable_refcnt_caching_(true)
-      , refcnt_requests_(new refcnt_requests_type)
+      , refcnt_buffers_(new refcnt_buffer_type[num_refcnt_buffers])
       , service_type(ini_.get_agas_service_mode())
       , runtime_type(ini_.mode_)
       , caching_(ini_.get_agas_caching_mode())
@@ -706,9 +651,27 @@ namespace hpx { namespace agas {
                 &addressing_service::bind_postproc, this, id, g)));
     }
 
+    void addressing_service::remove_cached_range(
+        naming::gid_type const& lower_id, std::uint64_t count)
+    {
+        // A range is cached as a whole when it is resolved, thus the entries
+        // covering its first and its last id are all which have to go.
+        std::vector<naming::gid_type> ids;
+        ids.reserve(2);
+        ids.push_back(lower_id);
+        if (count > 1)
+        {
+            ids.push_back(lower_id + (count - 1));
+        }
+
+        error_code ec(throwmode::lightweight);
+        remove_cache_entries(ids, ec);
+    }
+
     hpx::future<naming::address> addressing_service::unbind_range_async(
         naming::gid_type const& lower_id, std::uint64_t count)
     {
+        remove_cached_range(lower_id, count);
         return primary_ns_.unbind_gid_async(count, lower_id);
     }
 
@@ -718,6 +681,7 @@ namespace hpx { namespace agas {
     {    // {{{ unbind_range implementation
         try
         {
+            remove_cached_range(lower_id, count);
             addr = primary_ns_.unbind_gid(count, lower_id);
 
             return true;
@@ -1299,13 +1263,16 @@ namespace hpx { namespace agas {
         bool has_pending_incref = false;
         std::int64_t pending_decrefs = 0;
 
+        refcnt_buffer& b = refcnt_buffer_for(raw);
+        hpx::future<std::int64_t> f;
+
         {
-            std::lock_guard<mutex_type> l(refcnt_requests_mtx_);
+            std::lock_guard<mutex_type> l(b.mtx_);
 
             using iterator = refcnt_requests_type::iterator;
 
-            iterator matches = refcnt_requests_->find(raw);
-            if (matches != refcnt_requests_->end())
+            iterator matches = b.requests_->find(raw);
+            if (matches != b.requests_->end())
             {
                 pending_decrefs = matches->second;
                 matches->second += credit;
@@ -1322,13 +1289,13 @@ namespace hpx { namespace agas {
                     pending_incref = mapping(matches->first, matches->second);
                     has_pending_incref = true;
 
-                    refcnt_requests_->erase(matches);
+                    b.requests_->erase(matches);
                 }
                 else if (matches->second == 0)
                 {
                     // credit == decref (case no. 3): if the incref offsets any
                     // pending decref, just remove the pending decref request.
-                    refcnt_requests_->erase(matches);
+                    b.requests_->erase(matches);
                 }
                 else
                 {
@@ -1341,6 +1308,22 @@ namespace hpx { namespace agas {
                 pending_incref = mapping(raw, credit);
                 has_pending_incref = true;
             }
+
+            if (has_pending_incref)
+            {
+                if (b.incref_in_flight_)
+                {
+                    // send this increment together with all others made
+                    // until the one in flight has been acknowledged
+                    b.increfs_.push_back(incref_request{pending_incref.first,
+                        pending_incref.second, hpx::promise<std::int64_t>()});
+                    f = b.increfs_.back().promise_.get_future();
+                }
+                else
+                {
+                    b.incref_in_flight_ = true;
+                }
+            }
         }
 
         if (!has_pending_incref)
@@ -1349,10 +1332,27 @@ namespace hpx { namespace agas {
             return hpx::make_ready_future(pending_decrefs);
         }
 
-        naming::gid_type const e_lower = pending_incref.first;
+        if (!f.valid())
+        {
+            naming::gid_type const e_lower = pending_incref.first;
 
-        hpx::future<std::int64_t> f = primary_ns_.increment_credit(
-            pending_incref.second, e_lower, e_lower);
+            try
+            {
+                f = primary_ns_
+                        .increment_credit(
+                            pending_incref.second, e_lower, e_lower)
+                        .then(hpx::launch::sync,
+                            [this, &b](hpx::future<std::int64_t> f) {
+                                send_pending_increfs(b);
+                                return f.get();
+                            });
+            }
+            catch (...)
+            {
+                send_pending_increfs(b);
+                throw;
+            }
+        }
 
         // pass the amount of compensated decrefs to the callback
         using placeholders::_1;
@@ -1393,21 +1393,22 @@ namespace hpx { namespace agas {
 
         try
         {
-            std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
+            refcnt_buffer& b = refcnt_buffer_for(raw);
+            std::unique_lock<mutex_type> l(b.mtx_);
 
             // Match the decref request with entries in the incref table
             using iterator = refcnt_requests_type::iterator;
             using mapping = refcnt_requests_type::value_type;
 
-            iterator matches = refcnt_requests_->find(raw);
-            if (matches != refcnt_requests_->end())
+            iterator matches = b.requests_->find(raw);
+            if (matches != b.requests_->end())
             {
                 matches->second -= credit;
             }
             else
             {
                 std::pair<iterator, bool> p =
-                    refcnt_requests_->insert(mapping(raw, -credit));
+                    b.requests_->insert(mapping(raw, -credit));
 
                 if (HPX_UNLIKELY(!p.second))
                 {
@@ -1421,7 +1422,7 @@ namespace hpx { namespace agas {
                 }
             }
 
-            send_refcnt_requests(l, ec);
+            send_refcnt_requests(b, l, ec);
         }
         catch (hpx::exception const& e)
         {
@@ -1580,15 +1581,6 @@ namespace hpx { namespace agas {
         return symbol_ns_.iterate_async(pattern);
     }    // }}}
 
-    // This function has to return false if the key is already in the cache (true
-    // means go ahead with the cache update).
-    bool check_for_collisions(addressing_service::gva_cache_key const& new_key,
-        addressing_service::gva_cache_key const& old_key)
-    {
-        return (new_key.get_gid() != old_key.get_gid()) ||
-            (new_key.get_count() != old_key.get_count());
-    }
-
     void addressing_service::update_cache_entry(
         naming::gid_type const& id, gva const& g, error_code& ec)
     {    // {{{
@@ -1649,37 +1641,17 @@ namespace hpx { namespace agas {
                 "addressing_service::update_cache_entry, gid({1}), count({2})",
                 gid, count);
 
-            const gva_cache_key key(gid, count);
-
+            naming::gid_type collision_base;
+            std::uint64_t collision_count = 0;
+            if (!gva_cache_->update(
+                    gid, count, g, collision_base, collision_count))
             {
-                std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-                if (!gva_cache_->update_if(key, g, check_for_collisions))
-                {
-                    if (LAGAS_ENABLED(warning))
-                    {
-                        // Figure out who we collided with.
-                        addressing_service::gva_cache_key idbase;
-                        addressing_service::gva_cache_type::entry_type e;
-
-                        if (!gva_cache_->get_entry(key, idbase, e))
-                        {
-                            // This is impossible under sane conditions.
-                            lock.unlock();
-                            HPX_THROWS_IF(ec, invalid_data,
-                                "addressing_service::update_cache_entry",
-                                "data corruption or lock error occurred in "
-                                "cache");
-                            return;
-                        }
-
-                        LAGAS_(warning).format(
-                            "addressing_service::update_cache_entry, aborting "
-                            "update due to key collision in cache, "
-                            "new_gid({1}), new_count({2}), old_gid({3}), "
-                            "old_count({4})",
-                            gid, count, idbase.get_gid(), idbase.get_count());
-                    }
-                }
+                LAGAS_(warning).format(
+                    "addressing_service::update_cache_entry, aborting "
+                    "update due to key collision in cache, "
+                    "new_gid({1}), new_count({2}), old_gid({3}), "
+                    "old_count({4})",
+                    gid, count, collision_base, collision_count);
             }
 
             if (&ec != &throws)
@@ -1699,25 +1671,22 @@ namespace hpx { namespace agas {
         {
             return false;
         }
-        gva_cache_key k(gid);
-        gva_cache_key idbase_key;
 
-        std::unique_lock<mutex_type> lock(gva_cache_mtx_);
-        if (gva_cache_->get_entry(k, idbase_key, gva))
+        naming::gid_type idbase_gid;
+        if (gva_cache_->get(gid, idbase_gid, gva))
         {
             const std::uint64_t id_msb =
                 naming::detail::strip_internal_bits_from_gid(gid.get_msb());
 
-            if (HPX_UNLIKELY(id_msb != idbase_key.get_gid().get_msb()))
+            if (HPX_UNLIKELY(id_msb != idbase_gid.get_msb()))
             {
-                lock.unlock();
                 HPX_THROWS_IF(ec, internal_server_error,
                     "addressing_service::get_cache_entry",
                     "bad entry in cache, MSBs of GID base and GID do not "
                     "match");
                 return false;
             }
-            idbase = idbase_key.get_gid();
+            idbase = idbase_gid;
             return true;
         }
 
@@ -1739,8 +1708,6 @@ namespace hpx { namespace agas {
             LAGAS_(warning).format(
                 "addressing_service::clear_cache, clearing cache");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-
             gva_cache_->clear();
 
             if (&ec != &throws)
@@ -1786,18 +1753,56 @@ namespace hpx { namespace agas {
         {
             LAGAS_(warning).format("addressing_service::remove_cache_entry");
 
-            std::lock_guard<mutex_type> lock(gva_cache_mtx_);
+            gva_cache_->erase(gid);
 
-            gva_cache_->erase([&gid](std::pair<gva_cache_key, gva> const& p) {
-                return gid == p.first.get_gid();
-            });
+            if (&ec != &throws)
+                ec = make_success_code();
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_RETHROWS_IF(ec, e, "addressing_service::remove_cache_entry");
+        }
+    }
+
+    void addressing_service::remove_cache_entries(
+        std::vector<naming::gid_type> const& ids, error_code& ec)
+    {
+        // If caching is disabled, we silently pretend success.
+        if (!caching_)
+        {
+            if (&ec != &throws)
+                ec = make_success_code();
+            return;
+        }
+
+        // filter the ids which could have been stored in the cache
+        std::vector<naming::gid_type> gids;
+        gids.reserve(ids.size());
+        for (naming::gid_type const& id : ids)
+        {
+            if (!naming::detail::store_in_cache(id) ||
+                naming::get_locality_id_from_gid(id) ==
+                    naming::get_locality_id_from_gid(locality_))
+            {
+                continue;
+            }
+            gids.push_back(naming::detail::get_stripped_gid(id));
+        }
+
+        try
+        {
+            LAGAS_(warning).format(
+                "addressing_service::remove_cache_entries, {1} entries",
+                gids.size());
+
+            gva_cache_->erase(gids);
 
             if (&ec != &throws)
                 ec = make_success_code();
         }
         catch (hpx::exception const& e)
         {
-            HPX_RETHROWS_IF(ec, e, "addressing_service::clear_cache");
+            HPX_RETHROWS_IF(ec, e, "addressing_service::remove_cache_entries");
         }
     }
 
@@ -1808,91 +1813,98 @@ namespace hpx { namespace agas {
         if (!caching_)
             return;
 
-        std::unique_lock<mutex_type> l(refcnt_requests_mtx_);
-        enable_refcnt_caching_ = false;
-        send_refcnt_requests_sync(l, ec);
+        enable_refcnt_caching_.store(false);
+
+        std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
+        for (std::size_t i = 0; i != num_refcnt_buffers; ++i)
+        {
+            refcnt_buffer& b = refcnt_buffers_[i].data_;
+
+            std::unique_lock<mutex_type> l(b.mtx_);
+            auto results = send_refcnt_requests_async(b, l);
+            std::move(results.begin(), results.end(),
+                std::back_inserter(lazy_results));
+        }
+
+        // re throw possible errors
+        hpx::when_all(lazy_results).get();
+
+        if (&ec != &throws)
+            ec = make_success_code();
     }
 
     ///////////////////////////////////////////////////////////////////////////
     // Helper functions to access the current cache statistics
     std::uint64_t addressing_service::get_cache_entries(bool /* reset */)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
         return gva_cache_->size();
     }
 
     std::uint64_t addressing_service::get_cache_hits(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().hits(reset);
+        return gva_cache_->hits(reset);
     }
 
     std::uint64_t addressing_service::get_cache_misses(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().misses(reset);
+        return gva_cache_->misses(reset);
     }
 
     std::uint64_t addressing_service::get_cache_evictions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().evictions(reset);
+        return gva_cache_->evictions(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertions(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().insertions(reset);
+        return gva_cache_->insertions(reset);
+    }
+
+    std::uint64_t addressing_service::get_cache_contentions(bool reset)
+    {
+        return gva_cache_->contentions(reset);
     }
 
     ///////////////////////////////////////////////////////////////////////////
     std::uint64_t addressing_service::get_cache_get_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_count(reset);
+        return gva_cache_->get_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_count(
         bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_count(reset);
+        return gva_cache_->insert_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_count(reset);
+        return gva_cache_->update_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_count(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_count(reset);
+        return gva_cache_->erase_entry_count(reset);
     }
 
     std::uint64_t addressing_service::get_cache_get_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_get_entry_time(reset);
+        return gva_cache_->get_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_insertion_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_insert_entry_time(reset);
+        return gva_cache_->insert_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_update_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_update_entry_time(reset);
+        return gva_cache_->update_entry_time(reset);
     }
 
     std::uint64_t addressing_service::get_cache_erase_entry_time(bool reset)
     {
-        std::lock_guard<mutex_type> lock(gva_cache_mtx_);
-        return gva_cache_->get_statistics().get_erase_entry_time(reset);
+        return gva_cache_->erase_entry_time(reset);
     }
 
     void addressing_service::register_server_instances()
@@ -1906,25 +1918,255 @@ namespace hpx { namespace agas {
         symbol_ns_.register_server_instance(locality_id);
     }
 
+    ///////////////////////////////////////////////////////////////////////////
+    addressing_service::refcnt_buffer& addressing_service::refcnt_buffer_for(
+        std::uint32_t locality_id) const noexcept
+    {
+        return refcnt_buffers_[locality_id % num_refcnt_buffers].data_;
+    }
+
+    addressing_service::refcnt_buffer& addressing_service::refcnt_buffer_for(
+        naming::gid_type const& id) const noexcept
+    {
+        // all requests are sent to the primary namespace instance responsible
+        // for the given id, which lives on the locality encoded in the id
+        return refcnt_buffer_for(naming::get_locality_id_from_gid(id));
+    }
+
     void addressing_service::garbage_collect_non_blocking(error_code& ec)
     {
-        std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
-        if (!l.owns_lock())
-            return;    // no need to compete for garbage collection
+        for (std::size_t i = 0; i != num_refcnt_buffers; ++i)
+        {
+            refcnt_buffer& b = refcnt_buffers_[i].data_;
 
-        send_refcnt_requests_non_blocking(l, ec);
+            std::unique_lock<mutex_type> l(b.mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+                continue;    // no need to compete for garbage collection
+
+            send_refcnt_requests_non_blocking(b, l, ec);
+            if (ec)
+                return;
+        }
     }
 
     void addressing_service::garbage_collect(error_code& ec)
     {
-        std::unique_lock<mutex_type> l(refcnt_requests_mtx_, std::try_to_lock);
+        std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
+        for (std::size_t i = 0; i != num_refcnt_buffers; ++i)
+        {
+            refcnt_buffer& b = refcnt_buffers_[i].data_;
+
+            std::unique_lock<mutex_type> l(b.mtx_, std::try_to_lock);
+            if (!l.owns_lock())
+                continue;    // no need to compete for garbage collection
+
+            auto results = send_refcnt_requests_async(b, l);
+            std::move(results.begin(), results.end(),
+                std::back_inserter(lazy_results));
+        }
+
+        // re throw possible errors
+        hpx::when_all(lazy_results).get();
+
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
+
+#if defined(HPX_HAVE_NETWORKING)
+    void addressing_service::piggyback_refcnt_requests(
+        std::uint32_t locality_id, std::vector<parcelset::parcel>& parcels)
+    {
+        if (max_refcnt_delay_ == 0)
+            return;
+
+        refcnt_buffer& b = refcnt_buffer_for(locality_id);
+
+        // avoid touching the lock if there is nothing to send (yet)
+        std::uint64_t const deadline =
+            b.deadline_.load(std::memory_order_relaxed);
+        if (deadline == 0 ||
+            hpx::chrono::high_resolution_clock::now() + max_refcnt_delay_ / 2 <
+                deadline)
+        {
+            return;
+        }
+
+        std::unique_lock<mutex_type> l(b.mtx_, std::try_to_lock);
         if (!l.owns_lock())
-            return;    // no need to compete for garbage collection
+            return;    // somebody else is about to send the requests
+
+        // Take the requests for the given locality, those for other
+        // localities sharing the buffer stay until their deadline.
+        std::vector<
+            hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>>
+            requests;
+
+        for (auto it = b.requests_->begin(); it != b.requests_->end(); /**/)
+        {
+            if (naming::get_locality_id_from_gid(it->first) == locality_id)
+            {
+                HPX_ASSERT(it->second < 0);
+                requests.push_back(
+                    hpx::make_tuple(it->second, it->first, it->first));
+                it = b.requests_->erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+
+        if (b.requests_->empty())
+        {
+            b.count_ = 0;
+            b.deadline_.store(0, std::memory_order_relaxed);
+        }
+        else
+        {
+            b.count_ -= (std::min)(b.count_, requests.size());
+        }
+
+        l.unlock();
+
+        if (requests.empty())
+            return;
+
+        LAGAS_(info).format("addressing_service::piggyback_refcnt_requests, "
+                            "locality({1}), requests({2})",
+            locality_id, requests.size());
+
+        naming::gid_type target =
+            primary_namespace::get_service_instance(locality_id);
+
+        naming::address addr;
+        resolve_locally_known_addresses(target, addr);
+
+        using action_type = server::primary_namespace::decrement_credit_action;
+        parcels.push_back(parcelset::detail::create_parcel::call(
+            HPX_MOVE(target), HPX_MOVE(addr), action_type(),
+            actions::action_priority<action_type>(), HPX_MOVE(requests)));
+    }
+#endif
+
+    void addressing_service::schedule_refcnt_flush(
+        refcnt_buffer& b, std::uint64_t deadline)
+    {
+        threads::thread_init_data data(
+            threads::make_thread_function_nullary([this, &b, deadline]() {
+                std::uint64_t const now =
+                    hpx::chrono::high_resolution_clock::now();
+                if (now < deadline)
+                {
+                    hpx::this_thread::sleep_for(
+                        std::chrono::nanoseconds(deadline - now));
+                }
+
+                std::unique_lock<mutex_type> l(b.mtx_);
+
+                // the buffer might have been flushed in the meantime, in
+                // which case its new requests have their own deadline
+                if (b.deadline_.load(std::memory_order_relaxed) != deadline)
+                    return;
+
+                error_code ec(throwmode::lightweight);
+                send_refcnt_requests_non_blocking(b, l, ec);
+            }),
+            "addressing_service::schedule_refcnt_flush",
+            threads::thread_priority::normal, threads::thread_schedule_hint(),
+            threads::thread_stacksize::default_,
+            threads::thread_schedule_state::pending, true);
+        threads::register_thread(data);
+    }
+
+    void addressing_service::send_pending_increfs(refcnt_buffer& b)
+    {
+        auto increfs = std::make_shared<std::vector<incref_request>>();
+        {
+            std::lock_guard<mutex_type> l(b.mtx_);
+            if (b.increfs_.empty())
+            {
+                b.incref_in_flight_ = false;
+                return;
+            }
+            increfs->swap(b.increfs_);
+        }
+
+        LAGAS_(info).format(
+            "addressing_service::send_pending_increfs, requests({1})",
+            increfs->size());
+
+        // collect all requests for each locality, remembering which of the
+        // increments belong to which request
+        using request_type =
+            hpx::tuple<std::int64_t, naming::gid_type, naming::gid_type>;
+        using requests_type = std::map<hpx::id_type,
+            std::pair<std::vector<std::size_t>, std::vector<request_type>>>;
+        requests_type requests;
+
+        for (std::size_t i = 0; i != increfs->size(); ++i)
+        {
+            incref_request const& r = (*increfs)[i];
+
+            hpx::id_type target(primary_namespace::get_service_instance(r.id_),
+                hpx::id_type::management_type::unmanaged);
+
+            auto& entry = requests[target];
+            entry.first.push_back(i);
+            entry.second.push_back(hpx::make_tuple(r.credit_, r.id_, r.id_));
+        }
+
+        std::vector<hpx::future<void>> results;
+        results.reserve(requests.size());
+
+        for (auto& entry : requests)
+        {
+            auto acknowledge =
+                [increfs, indices = HPX_MOVE(entry.second.first)](
+                    hpx::future<std::vector<std::int64_t>> f) {
+                    try
+                    {
+                        std::vector<std::int64_t> credits = f.get();
+                        for (std::size_t i = 0; i != indices.size(); ++i)
+                        {
+                            (*increfs)[indices[i]].promise_.set_value(
+                                credits[i]);
+                        }
+                    }
+                    catch (...)
+                    {
+                        std::exception_ptr e = std::current_exception();
+                        for (std::size_t i : indices)
+                        {
+                            (*increfs)[i].promise_.set_exception(e);
+                        }
+                    }
+                };
+
+            hpx::future<std::vector<std::int64_t>> f;
+            try
+            {
+                server::primary_namespace::decrement_credit_action action;
+                f = hpx::async(action, entry.first,
+                    HPX_MOVE(entry.second.second));
+            }
+            catch (...)
+            {
+                f = hpx::make_exceptional_future<std::vector<std::int64_t>>(
+                    std::current_exception());
+            }
 
-        send_refcnt_requests_sync(l, ec);
+            results.push_back(
+                f.then(hpx::launch::sync, HPX_MOVE(acknowledge)));
+        }
+
+        // send the increments which have been queued in the meantime
+        hpx::when_all(results).then(hpx::launch::sync,
+            [this, &b](hpx::future<std::vector<hpx::future<void>>>) {
+                send_pending_increfs(b);
+            });
     }
 
-    void addressing_service::send_refcnt_requests(
+    void addressing_service::send_refcnt_requests(refcnt_buffer& b,
         std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
     {
         if (!l.owns_lock())
@@ -1935,11 +2177,34 @@ namespace hpx { namespace agas {
             return;
         }
 
-        if (!enable_refcnt_caching_ ||
-            max_refcnt_requests_ == ++refcnt_requests_count_)
-            send_refcnt_requests_non_blocking(l, ec);
+        if (!enable_refcnt_caching_.load(std::memory_order_relaxed) ||
+            max_refcnt_requests_ <= ++b.count_)
+        {
+            send_refcnt_requests_non_blocking(b, l, ec);
+            return;
+        }
+
+        if (max_refcnt_delay_ != 0)
+        {
+            std::uint64_t const deadline =
+                b.deadline_.load(std::memory_order_relaxed);
+            std::uint64_t const now = hpx::chrono::high_resolution_clock::now();
+            if (deadline == 0)
+            {
+                b.deadline_.store(
+                    now + max_refcnt_delay_, std::memory_order_relaxed);
+
+                l.unlock();
+                schedule_refcnt_flush(b, now + max_refcnt_delay_);
+            }
+            else if (now >= deadline)
+            {
+                send_refcnt_requests_non_blocking(b, l, ec);
+                return;
+            }
+        }
 
-        else if (&ec != &throws)
+        if (&ec != &throws)
             ec = make_success_code();
     }
 
@@ -1972,14 +2237,18 @@ namespace hpx { namespace agas {
 #endif
 
     void addressing_service::send_refcnt_requests_non_blocking(
-        std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
+        refcnt_buffer& b, std::unique_lock<addressing_service::mutex_type>& l,
+        error_code& ec)
     {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
         HPX_ASSERT(l.owns_lock());
 
         try
         {
-            if (refcnt_requests_->empty())
+            b.count_ = 0;
+            b.deadline_.store(0, std::memory_order_relaxed);
+
+            if (b.requests_->empty())
             {
                 l.unlock();
                 return;
@@ -1987,8 +2256,7 @@ namespace hpx { namespace agas {
 
             std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
 
-            p.swap(refcnt_requests_);
-            refcnt_requests_count_ = 0;
+            p.swap(b.requests_);
 
             l.unlock();
 
@@ -2039,6 +2307,7 @@ namespace hpx { namespace agas {
                 ec, e, "addressing_service::send_refcnt_requests_non_blocking");
         }
 #else
+        HPX_UNUSED(b);
         HPX_UNUSED(l);
         HPX_UNUSED(ec);
         HPX_ASSERT(false);
@@ -2047,12 +2316,15 @@ namespace hpx { namespace agas {
 
     std::vector<hpx::future<std::vector<std::int64_t>>>
     addressing_service::send_refcnt_requests_async(
-        std::unique_lock<addressing_service::mutex_type>& l)
+        refcnt_buffer& b, std::unique_lock<addressing_service::mutex_type>& l)
     {
 #if !defined(HPX_COMPUTE_DEVICE_CODE)
         HPX_ASSERT(l.owns_lock());
 
-        if (refcnt_requests_->empty())
+        b.count_ = 0;
+        b.deadline_.store(0, std::memory_order_relaxed);
+
+        if (b.requests_->empty())
         {
             l.unlock();
             return std::vector<hpx::future<std::vector<std::int64_t>>>();
@@ -2060,8 +2332,7 @@ namespace hpx { namespace agas {
 
         std::shared_ptr<refcnt_requests_type> p(new refcnt_requests_type);
 
-        p.swap(refcnt_requests_);
-        refcnt_requests_count_ = 0;
+        p.swap(b.requests_);
 
         l.unlock();
 
@@ -2105,6 +2376,7 @@ namespace hpx { namespace agas {
 
         return lazy_results;
 #else
+        HPX_UNUSED(b);
         HPX_UNUSED(l);
         HPX_ASSERT(false);
         std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results;
@@ -2112,19 +2384,6 @@ namespace hpx { namespace agas {
 #endif
     }
 
-    void addressing_service::send_refcnt_requests_sync(
-        std::unique_lock<addressing_service::mutex_type>& l, error_code& ec)
-    {
-        std::vector<hpx::future<std::vector<std::int64_t>>> lazy_results =
-            send_refcnt_requests_async(l);
-
-        // re throw possible errors
-        hpx::when_all(lazy_results).get();
-
-        if (&ec != &throws)
-            ec = make_success_code();
-    }
-
     ///////////////////////////////////////////////////////////////////////////
     hpx::future<void> addressing_service::mark_as_migrated(
         naming::gid_type const& gid_,
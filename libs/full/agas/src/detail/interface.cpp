@@ -502,6 +502,16 @@ namespace hpx { namespace agas { namespace detail { namespace impl {
         return naming::get_agas_client().route(
             HPX_MOVE(p), HPX_MOVE(f), local_priority);
     }
+
+    void piggyback_refcnt_requests(
+        std::uint32_t locality_id, std::vector<parcelset::parcel>& parcels)
+    {
+        auto* client = naming::get_agas_client_ptr();
+        if (nullptr != client)
+        {
+            client->piggyback_refcnt_requests(locality_id, parcels);
+        }
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -625,6 +635,8 @@ namespace hpx { namespace agas {
 
 #if defined(HPX_HAVE_NETWORKING)
             detail::route = &detail::impl::route;
+            detail::piggyback_refcnt_requests =
+                &detail::impl::piggyback_refcnt_requests;
 #endif
 
             detail::get_primary_ns_lva = &detail::impl::get_primary_ns_lva;
@@ -0,0 +1,655 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/agas/gva_cache.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/execution_base.hpp>
+#include <hpx/modules/timing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace agas { namespace detail {
+
+    namespace {
+
+        // number of consecutive ids managed by the same shard
+        constexpr std::size_t gid_block_bits = 8;
+
+        bool same_block(naming::gid_type const& lhs,
+            naming::gid_type const& rhs) noexcept
+        {
+            return lhs.get_msb() == rhs.get_msb() &&
+                (lhs.get_lsb() >> gid_block_bits) ==
+                (rhs.get_lsb() >> gid_block_bits);
+        }
+
+        std::size_t round_to_power_of_two(std::size_t n) noexcept
+        {
+            std::size_t result = 1;
+            while (result < n)
+            {
+                result <<= 1;
+            }
+            return result;
+        }
+
+        std::uint64_t get_and_reset(
+            std::atomic<std::uint64_t>& value, bool reset) noexcept
+        {
+            if (reset)
+            {
+                return value.exchange(0, std::memory_order_relaxed);
+            }
+            return value.load(std::memory_order_relaxed);
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool gva_cache::shared_spinlock::lock_shared()
+    {
+        std::uint32_t s = state_.load(std::memory_order_relaxed);
+        if (!(s & writer) &&
+            state_.compare_exchange_strong(
+                s, s + 1, std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        for (std::size_t k = 0;; ++k)
+        {
+            s = state_.load(std::memory_order_relaxed);
+            if (!(s & writer) &&
+                state_.compare_exchange_weak(s, s + 1,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                return false;
+            }
+            hpx::execution_base::this_thread::yield_k(
+                k, "gva_cache::lock_shared");
+        }
+    }
+
+    void gva_cache::shared_spinlock::unlock_shared()
+    {
+        state_.fetch_sub(1, std::memory_order_release);
+    }
+
+    bool gva_cache::shared_spinlock::lock()
+    {
+        std::uint32_t s = 0;
+        if (state_.compare_exchange_strong(s, writer,
+                std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            return true;
+        }
+
+        // announce the writer, this prevents new readers from entering
+        for (std::size_t k = 0;; ++k)
+        {
+            s = state_.load(std::memory_order_relaxed);
+            if (!(s & writer) &&
+                state_.compare_exchange_weak(s, s | writer,
+                    std::memory_order_acquire, std::memory_order_relaxed))
+            {
+                break;
+            }
+            hpx::execution_base::this_thread::yield_k(k, "gva_cache::lock");
+        }
+
+        // wait for the active readers to leave
+        for (std::size_t k = 0;
+             state_.load(std::memory_order_acquire) != writer; ++k)
+        {
+            hpx::execution_base::this_thread::yield_k(k, "gva_cache::lock");
+        }
+        return false;
+    }
+
+    void gva_cache::shared_spinlock::unlock()
+    {
+        state_.store(0, std::memory_order_release);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    gva_cache::gva_cache(std::size_t capacity, std::size_t num_shards)
+      : capacity_(capacity)
+      , num_shards_(round_to_power_of_two(num_shards == 0 ? 1 : num_shards))
+      , shards_(new table_type[num_shards_])
+    {
+    }
+
+    gva_cache::~gva_cache() = default;
+
+    void gva_cache::reserve(std::size_t capacity) noexcept
+    {
+        capacity_.store(capacity, std::memory_order_relaxed);
+    }
+
+    std::size_t gva_cache::capacity() const noexcept
+    {
+        return capacity_.load(std::memory_order_relaxed);
+    }
+
+    std::size_t gva_cache::size() const noexcept
+    {
+        std::size_t result = ranges_.size_.load(std::memory_order_relaxed);
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            result += shards_[i].data_.size_.load(std::memory_order_relaxed);
+        }
+        return result;
+    }
+
+    gva_cache::table& gva_cache::shard_for(
+        naming::gid_type const& id) const noexcept
+    {
+        // Fibonacci hashing spreads the block numbers over all shards
+        std::uint64_t const block =
+            id.get_msb() ^ (id.get_lsb() >> gid_block_bits);
+        std::size_t const index =
+            static_cast<std::size_t>(block * 11400714819323198485ull >> 32) &
+            (num_shards_ - 1);
+        return shards_[index].data_;
+    }
+
+    void gva_cache::record(
+        table& t, statistics_type s, std::uint64_t value) const noexcept
+    {
+        t.statistics_[s].fetch_add(value, std::memory_order_relaxed);
+    }
+
+    std::uint64_t gva_cache::get_statistics(
+        statistics_type s, bool reset) noexcept
+    {
+        std::uint64_t result = get_and_reset(ranges_.statistics_[s], reset);
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            result += get_and_reset(shards_[i].data_.statistics_[s], reset);
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The entries of a table never overlap, thus the only candidate for
+    // overlapping with the given range is the entry with the largest first id
+    // not larger than the last id of the range.
+    gva_cache::entries_type::iterator gva_cache::find_overlapping(
+        entries_type& entries, naming::gid_type const& first,
+        naming::gid_type const& last)
+    {
+        auto it = entries.upper_bound(last);
+        if (it == entries.begin())
+        {
+            return entries.end();
+        }
+
+        --it;
+        if (it->second.last_ < first)
+        {
+            return entries.end();
+        }
+        return it;
+    }
+
+    void gva_cache::evict_locked(table& t, std::size_t capacity)
+    {
+        // CLOCK: advance the hand, giving referenced entries a second chance
+        auto it = t.entries_.lower_bound(t.clock_hand_);
+        while (!t.entries_.empty() && t.entries_.size() >= capacity)
+        {
+            if (it == t.entries_.end())
+            {
+                it = t.entries_.begin();
+            }
+
+            if (it->second.referenced_.load(std::memory_order_relaxed))
+            {
+                it->second.referenced_.store(false, std::memory_order_relaxed);
+                ++it;
+                continue;
+            }
+
+            it = t.entries_.erase(it);
+            t.size_.fetch_sub(1, std::memory_order_relaxed);
+            record(t, stat_evictions);
+        }
+
+        t.clock_hand_ =
+            it != t.entries_.end() ? it->first : naming::gid_type();
+    }
+
+    bool gva_cache::update_locked(table& t, naming::gid_type const& first,
+        naming::gid_type const& last, gva const& g,
+        naming::gid_type& collision_base, std::uint64_t& collision_count)
+    {
+        auto it = find_overlapping(t.entries_, first, last);
+        if (it != t.entries_.end())
+        {
+            // update the entry only if it refers to exactly the same range
+            if (it->first == first && it->second.last_ == last)
+            {
+                it->second.gva_ = g;
+                it->second.referenced_.store(true, std::memory_order_relaxed);
+                return true;
+            }
+
+            collision_base = it->first;
+            collision_count = (it->second.last_ - it->first).get_lsb() + 1;
+            return false;
+        }
+
+        // make room for the new entry, the capacity is divided evenly
+        // between the shards while the range table may use all of it
+        std::size_t capacity = capacity_.load(std::memory_order_relaxed);
+        if (&t != &ranges_)
+        {
+            capacity = (capacity + num_shards_ - 1) / num_shards_;
+        }
+        evict_locked(t, (std::max)(std::size_t(1), capacity));
+
+        t.entries_.emplace(std::piecewise_construct,
+            std::forward_as_tuple(first), std::forward_as_tuple(last, g));
+        t.size_.fetch_add(1, std::memory_order_relaxed);
+
+        record(t, stat_insertions);
+        record(t, stat_insert_entry_count);
+        return true;
+    }
+
+    bool gva_cache::find_in_shards(naming::gid_type const& first,
+        naming::gid_type const& last, naming::gid_type& collision_base,
+        std::uint64_t& collision_count)
+    {
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            table& t = shards_[i].data_;
+            if (!t.mtx_.lock_shared())
+            {
+                record(t, stat_contentions);
+            }
+
+            auto it = find_overlapping(t.entries_, first, last);
+            bool const collides = it != t.entries_.end();
+            if (collides)
+            {
+                collision_base = it->first;
+                collision_count = (it->second.last_ - it->first).get_lsb() + 1;
+            }
+
+            t.mtx_.unlock_shared();
+
+            if (collides)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool gva_cache::update(naming::gid_type const& id, std::uint64_t count,
+        gva const& g, naming::gid_type& collision_base,
+        std::uint64_t& collision_count)
+    {
+        HPX_ASSERT(count != 0);
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        naming::gid_type const first = naming::detail::get_stripped_gid(id);
+        naming::gid_type const last = first + (count - 1);
+
+        bool const is_range = !same_block(first, last);
+        table& t = is_range ? ranges_ : shard_for(first);
+
+        // Entries for single blocks are inserted while holding the range
+        // table shared, ranges are inserted while holding it exclusively.
+        // This makes the check for overlapping entries and the insertion a
+        // single step, the range table is always locked first.
+        bool result = false;
+        bool inserted = false;
+        if (is_range)
+        {
+            if (!ranges_.mtx_.lock())
+            {
+                record(ranges_, stat_contentions);
+            }
+
+            try
+            {
+                // a range may not overlap with any of the single blocks
+                if (!find_in_shards(
+                        first, last, collision_base, collision_count))
+                {
+                    std::uint64_t const inserted_before =
+                        ranges_.statistics_[stat_insertions].load(
+                            std::memory_order_relaxed);
+
+                    result = update_locked(ranges_, first, last, g,
+                        collision_base, collision_count);
+
+                    inserted = ranges_.statistics_[stat_insertions].load(
+                                   std::memory_order_relaxed) !=
+                        inserted_before;
+                }
+            }
+            catch (...)
+            {
+                ranges_.mtx_.unlock();
+                throw;
+            }
+
+            ranges_.mtx_.unlock();
+        }
+        else
+        {
+            if (!ranges_.mtx_.lock_shared())
+            {
+                record(ranges_, stat_contentions);
+            }
+            if (!t.mtx_.lock())
+            {
+                record(t, stat_contentions);
+            }
+
+            try
+            {
+                // a single block may not overlap with any of the ranges
+                auto it = find_overlapping(ranges_.entries_, first, last);
+                if (it != ranges_.entries_.end())
+                {
+                    collision_base = it->first;
+                    collision_count =
+                        (it->second.last_ - it->first).get_lsb() + 1;
+                }
+                else
+                {
+                    std::uint64_t const inserted_before =
+                        t.statistics_[stat_insertions].load(
+                            std::memory_order_relaxed);
+
+                    result = update_locked(
+                        t, first, last, g, collision_base, collision_count);
+
+                    inserted = t.statistics_[stat_insertions].load(
+                                   std::memory_order_relaxed) !=
+                        inserted_before;
+                }
+            }
+            catch (...)
+            {
+                t.mtx_.unlock();
+                ranges_.mtx_.unlock_shared();
+                throw;
+            }
+
+            t.mtx_.unlock();
+            ranges_.mtx_.unlock_shared();
+        }
+
+        std::uint64_t const elapsed =
+            hpx::chrono::high_resolution_clock::now() - start;
+        record(t, stat_update_entry_count);
+        record(t, stat_update_entry_time, elapsed);
+        if (inserted)
+        {
+            record(t, stat_insert_entry_time, elapsed);
+        }
+        return result;
+    }
+
+    bool gva_cache::get(
+        naming::gid_type const& id, naming::gid_type& idbase, gva& g)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+        auto lookup = [&](table& t) -> bool {
+            if (!t.mtx_.lock_shared())
+            {
+                record(t, stat_contentions);
+            }
+
+            bool found = false;
+            auto it = find_overlapping(t.entries_, gid, gid);
+            if (it != t.entries_.end())
+            {
+                idbase = it->first;
+                g = it->second.gva_;
+
+                // avoid writing to the entry if it is referenced already
+                if (!it->second.referenced_.load(std::memory_order_relaxed))
+                {
+                    it->second.referenced_.store(
+                        true, std::memory_order_relaxed);
+                }
+                found = true;
+            }
+
+            t.mtx_.unlock_shared();
+            return found;
+        };
+
+        table& t = shard_for(gid);
+        bool found = lookup(t);
+        if (!found && ranges_.size_.load(std::memory_order_relaxed) != 0)
+        {
+            found = lookup(ranges_);
+        }
+
+        record(t, found ? stat_hits : stat_misses);
+        record(t, stat_get_entry_count);
+        record(t, stat_get_entry_time,
+            hpx::chrono::high_resolution_clock::now() - start);
+        return found;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::size_t gva_cache::erase_locked(table& t, naming::gid_type const& id)
+    {
+        auto it = find_overlapping(t.entries_, id, id);
+        if (it == t.entries_.end())
+        {
+            return 0;
+        }
+
+        if (it->first == t.clock_hand_)
+        {
+            auto next = std::next(it);
+            t.clock_hand_ =
+                next != t.entries_.end() ? next->first : naming::gid_type();
+        }
+
+        t.entries_.erase(it);
+        t.size_.fetch_sub(1, std::memory_order_relaxed);
+        return 1;
+    }
+
+    std::size_t gva_cache::erase(naming::gid_type const& id)
+    {
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        naming::gid_type const gid = naming::detail::get_stripped_gid(id);
+
+        std::size_t erased = 0;
+
+        table& t = shard_for(gid);
+        if (!t.mtx_.lock())
+        {
+            record(t, stat_contentions);
+        }
+        erased += erase_locked(t, gid);
+        t.mtx_.unlock();
+
+        if (ranges_.size_.load(std::memory_order_relaxed) != 0)
+        {
+            if (!ranges_.mtx_.lock())
+            {
+                record(ranges_, stat_contentions);
+            }
+            erased += erase_locked(ranges_, gid);
+            ranges_.mtx_.unlock();
+        }
+
+        record(t, stat_erase_entry_count);
+        record(t, stat_erase_entry_time,
+            hpx::chrono::high_resolution_clock::now() - start);
+        return erased;
+    }
+
+    std::size_t gva_cache::erase(std::vector<naming::gid_type> const& ids)
+    {
+        if (ids.empty())
+        {
+            return 0;
+        }
+
+        std::uint64_t const start = hpx::chrono::high_resolution_clock::now();
+
+        // group the ids by shard
+        std::vector<std::pair<table*, naming::gid_type>> requests;
+        requests.reserve(ids.size());
+        for (naming::gid_type const& id : ids)
+        {
+            naming::gid_type gid = naming::detail::get_stripped_gid(id);
+            table* t = &shard_for(gid);
+            requests.emplace_back(t, HPX_MOVE(gid));
+        }
+
+        std::sort(requests.begin(), requests.end(),
+            [](auto const& lhs, auto const& rhs) {
+                return lhs.first < rhs.first;
+            });
+
+        std::size_t erased = 0;
+        for (auto it = requests.begin(); it != requests.end(); /**/)
+        {
+            table& t = *it->first;
+            if (!t.mtx_.lock())
+            {
+                record(t, stat_contentions);
+            }
+            for (/**/; it != requests.end() && it->first == &t; ++it)
+            {
+                erased += erase_locked(t, it->second);
+            }
+            t.mtx_.unlock();
+        }
+
+        if (ranges_.size_.load(std::memory_order_relaxed) != 0)
+        {
+            if (!ranges_.mtx_.lock())
+            {
+                record(ranges_, stat_contentions);
+            }
+            for (auto const& request : requests)
+            {
+                erased += erase_locked(ranges_, request.second);
+            }
+            ranges_.mtx_.unlock();
+        }
+
+        record(ranges_, stat_erase_entry_count, ids.size());
+        record(ranges_, stat_erase_entry_time,
+            hpx::chrono::high_resolution_clock::now() - start);
+        return erased;
+    }
+
+    void gva_cache::clear()
+    {
+        auto clear_table = [this](table& t) {
+            if (!t.mtx_.lock())
+            {
+                record(t, stat_contentions);
+            }
+            t.entries_.clear();
+            t.clock_hand_ = naming::gid_type();
+            t.size_.store(0, std::memory_order_relaxed);
+            t.mtx_.unlock();
+        };
+
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            clear_table(shards_[i].data_);
+        }
+        clear_table(ranges_);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t gva_cache::hits(bool reset) noexcept
+    {
+        return get_statistics(stat_hits, reset);
+    }
+
+    std::uint64_t gva_cache::misses(bool reset) noexcept
+    {
+        return get_statistics(stat_misses, reset);
+    }
+
+    std::uint64_t gva_cache::evictions(bool reset) noexcept
+    {
+        return get_statistics(stat_evictions, reset);
+    }
+
+    std::uint64_t gva_cache::insertions(bool reset) noexcept
+    {
+        return get_statistics(stat_insertions, reset);
+    }
+
+    std::uint64_t gva_cache::contentions(bool reset) noexcept
+    {
+        return get_statistics(stat_contentions, reset);
+    }
+
+    std::uint64_t gva_cache::get_entry_count(bool reset) noexcept
+    {
+        return get_statistics(stat_get_entry_count, reset);
+    }
+
+    std::uint64_t gva_cache::insert_entry_count(bool reset) noexcept
+    {
+        return get_statistics(stat_insert_entry_count, reset);
+    }
+
+    std::uint64_t gva_cache::update_entry_count(bool reset) noexcept
+    {
+        return get_statistics(stat_update_entry_count, reset);
+    }
+
+    std::uint64_t gva_cache::erase_entry_count(bool reset) noexcept
+    {
+        return get_statistics(stat_erase_entry_count, reset);
+    }
+
+    std::uint64_t gva_cache::get_entry_time(bool reset) noexcept
+    {
+        return get_statistics(stat_get_entry_time, reset);
+    }
+
+    std::uint64_t gva_cache::insert_entry_time(bool reset) noexcept
+    {
+        return get_statistics(stat_insert_entry_time, reset);
+    }
+
+    std::uint64_t gva_cache::update_entry_time(bool reset) noexcept
+    {
+        return get_statistics(stat_update_entry_time, reset);
+    }
+
+    std::uint64_t gva_cache::erase_entry_time(bool reset) noexcept
+    {
+        return get_statistics(stat_erase_entry_time, reset);
+    }
+}}}    // namespace hpx::agas::detail
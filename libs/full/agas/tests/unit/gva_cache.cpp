@@ -0,0 +1,223 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/agas/gva_cache.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::detail::gva_cache;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+gva make_gva(std::uint64_t count, std::uint64_t lva)
+{
+    return gva(gid_type(1, 1), 42, count, lva);
+}
+
+bool test_update(gva_cache& cache, gid_type const& id, std::uint64_t count,
+    gva const& g)
+{
+    gid_type collision_base;
+    std::uint64_t collision_count = 0;
+    return cache.update(id, count, g, collision_base, collision_count);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_insert_lookup()
+{
+    gva_cache cache(1024, 4);
+
+    gid_type const id(1, 0x1000);
+    gva const g = make_gva(1, 0x100);
+    HPX_TEST(test_update(cache, id, 1, g));
+    HPX_TEST_EQ(cache.size(), std::size_t(1));
+
+    gid_type idbase;
+    gva found;
+    HPX_TEST(cache.get(id, idbase, found));
+    HPX_TEST(idbase == id);
+    HPX_TEST(found == g);
+
+    HPX_TEST(!cache.get(id + 1, idbase, found));
+    HPX_TEST_EQ(cache.hits(true), std::uint64_t(1));
+    HPX_TEST_EQ(cache.misses(true), std::uint64_t(1));
+
+    // updating the same range replaces the address
+    gva const g1 = make_gva(1, 0x200);
+    HPX_TEST(test_update(cache, id, 1, g1));
+    HPX_TEST_EQ(cache.size(), std::size_t(1));
+    HPX_TEST(cache.get(id, idbase, found));
+    HPX_TEST(found == g1);
+
+    // a range inside of a single block
+    gid_type const base(1, 0x2000);
+    HPX_TEST(test_update(cache, base, 16, make_gva(16, 0x300)));
+    HPX_TEST(cache.get(base + 15, idbase, found));
+    HPX_TEST(idbase == base);
+    HPX_TEST(!cache.get(base + 16, idbase, found));
+}
+
+void test_ranges()
+{
+    gva_cache cache(1024, 4);
+
+    // a range spanning many blocks
+    gid_type const base(1, 0x10000);
+    std::uint64_t const count = 5000;
+    HPX_TEST(test_update(cache, base, count, make_gva(count, 0x100)));
+
+    gid_type idbase;
+    gva found;
+    HPX_TEST(cache.get(base + 2500, idbase, found));
+    HPX_TEST(idbase == base);
+    HPX_TEST(cache.get(base + (count - 1), idbase, found));
+    HPX_TEST(!cache.get(base + count, idbase, found));
+
+    // single blocks may not overlap with the range
+    gid_type collision_base;
+    std::uint64_t collision_count = 0;
+    HPX_TEST(!cache.update(
+        base + 1000, 1, make_gva(1, 0x200), collision_base, collision_count));
+    HPX_TEST(collision_base == base);
+    HPX_TEST_EQ(collision_count, count);
+
+    // ranges may not overlap with single blocks
+    gid_type const single(1, 0x20000);
+    HPX_TEST(test_update(cache, single, 1, make_gva(1, 0x300)));
+    HPX_TEST(!cache.update(single - 1000, 2000, make_gva(2000, 0x400),
+        collision_base, collision_count));
+    HPX_TEST(collision_base == single);
+    HPX_TEST_EQ(collision_count, std::uint64_t(1));
+
+    // ranges may not overlap with other ranges
+    HPX_TEST(!cache.update(base + (count - 1), 1000, make_gva(1000, 0x500),
+        collision_base, collision_count));
+    HPX_TEST(collision_base == base);
+
+    HPX_TEST_EQ(cache.size(), std::size_t(2));
+
+    // removing any of the ids removes the whole range
+    HPX_TEST_EQ(cache.erase(base + 4000), std::size_t(1));
+    HPX_TEST(!cache.get(base, idbase, found));
+    HPX_TEST(test_update(cache, base + 1000, 1, make_gva(1, 0x200)));
+}
+
+void test_erase()
+{
+    gva_cache cache(1024, 4);
+
+    std::vector<gid_type> ids;
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        ids.emplace_back(1, 0x1000 + 0x100 * i);
+        HPX_TEST(test_update(cache, ids.back(), 1, make_gva(1, i)));
+    }
+    HPX_TEST_EQ(cache.size(), ids.size());
+
+    HPX_TEST_EQ(cache.erase(ids[0]), std::size_t(1));
+    HPX_TEST_EQ(cache.erase(ids[0]), std::size_t(0));
+
+    // batched removal, including unknown ids
+    std::vector<gid_type> to_erase(ids.begin() + 1, ids.begin() + 50);
+    to_erase.emplace_back(2, 0x1000);
+    HPX_TEST_EQ(cache.erase(to_erase), std::size_t(49));
+    HPX_TEST_EQ(cache.size(), std::size_t(50));
+
+    gid_type idbase;
+    gva found;
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        HPX_TEST_EQ(cache.get(ids[i], idbase, found), i >= 50);
+    }
+
+    cache.clear();
+    HPX_TEST_EQ(cache.size(), std::size_t(0));
+    HPX_TEST(!cache.get(ids[99], idbase, found));
+}
+
+void test_eviction()
+{
+    std::size_t const capacity = 64;
+    gva_cache cache(capacity, 4);
+
+    for (std::uint64_t i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(
+            test_update(cache, gid_type(1, 0x100 * i), 1, make_gva(1, i)));
+    }
+    HPX_TEST(cache.size() <= capacity);
+    HPX_TEST_EQ(cache.evictions(false), 1000 - cache.size());
+
+    // the range table is not limited to the share of a single shard
+    gva_cache ranges(capacity, 4);
+    for (std::uint64_t i = 0; i != 1000; ++i)
+    {
+        HPX_TEST(test_update(
+            ranges, gid_type(1, 0x1000 * i), 0x200, make_gva(0x200, i)));
+    }
+    HPX_TEST_EQ(ranges.size(), capacity);
+    HPX_TEST_EQ(ranges.evictions(false), 1000 - capacity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Concurrently insert a range and single blocks covered by it, the cache
+// must never end up holding overlapping entries.
+void test_concurrent_overlap()
+{
+    std::size_t const num_singles = 16;
+    gid_type const base(1, 0x100000);
+    std::uint64_t const count = 256 * num_singles;
+
+    for (int iteration = 0; iteration != 100; ++iteration)
+    {
+        gva_cache cache(1024, 8);
+
+        std::atomic<std::size_t> singles_inserted(0);
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(num_singles);
+        for (std::size_t i = 0; i != num_singles; ++i)
+        {
+            futures.push_back(hpx::async([&, i]() {
+                if (test_update(cache, base + 256 * i, 1, make_gva(1, i)))
+                {
+                    ++singles_inserted;
+                }
+            }));
+        }
+
+        bool const range_inserted =
+            test_update(cache, base, count, make_gva(count, 0x100));
+        hpx::wait_all(futures);
+
+        HPX_TEST(range_inserted != (singles_inserted != 0));
+        HPX_TEST_EQ(cache.size(),
+            range_inserted ? std::size_t(1) : singles_inserted.load());
+    }
+}
+
+int main()
+{
+    test_insert_lookup();
+    test_ranges();
+    test_erase();
+    test_eviction();
+    test_concurrent_overlap();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that buffered reference count requests reach AGAS even
+// if no further requests are made, and that concurrent increments (which are
+// sent in batches) are all applied.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::size_t> alive(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    test_server()
+    {
+        ++alive;
+    }
+
+    ~test_server()
+    {
+        --alive;
+    }
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+///////////////////////////////////////////////////////////////////////////////
+// wait for the given number of objects to be alive, gives up after a while
+bool wait_for_alive(std::size_t count)
+{
+    for (int i = 0; i != 1000 && alive.load() != count; ++i)
+    {
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return alive.load() == count;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_decrements_after_idle()
+{
+    std::vector<hpx::id_type> ids;
+    for (int i = 0; i != 10; ++i)
+    {
+        ids.push_back(hpx::new_<test_server>(hpx::find_here()).get());
+    }
+    HPX_TEST_EQ(alive.load(), std::size_t(10));
+
+    // Releasing the objects buffers their decrements, no further requests
+    // are made afterwards.
+    ids.clear();
+
+    HPX_TEST(wait_for_alive(0));
+}
+
+void test_concurrent_increments()
+{
+    hpx::id_type id = hpx::new_<test_server>(hpx::find_here()).get();
+    HPX_TEST_EQ(alive.load(), std::size_t(1));
+
+    hpx::naming::gid_type const raw =
+        hpx::naming::detail::get_stripped_gid(id.get_gid());
+
+    std::vector<hpx::future<void>> futures;
+    for (int i = 0; i != 100; ++i)
+    {
+        futures.push_back(hpx::async([&]() {
+            hpx::agas::incref(raw, 1, id).get();
+            hpx::this_thread::yield();
+            hpx::agas::decref(raw, 1);
+        }));
+    }
+    hpx::wait_all(futures);
+
+    // the increments and decrements cancel out, the object stays alive
+    // after all of them have been sent
+    hpx::this_thread::sleep_for(std::chrono::milliseconds(100));
+    HPX_TEST_EQ(alive.load(), std::size_t(1));
+
+    id = hpx::invalid_id;
+    HPX_TEST(wait_for_alive(0));
+}
+
+int hpx_main()
+{
+    test_decrements_after_idle();
+    test_concurrent_increments();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // make sure the decrements are not sent because of their number
+    std::vector<std::string> const cfg = {
+        "hpx.agas.max_pending_refcnt_requests=1000",
+        "hpx.agas.max_pending_refcnt_delay=10"};
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
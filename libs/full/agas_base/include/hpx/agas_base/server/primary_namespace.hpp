@@ -19,6 +19,7 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/datastructures/tuple.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/traits/action_get_embedded_parcel.hpp>
@@ -127,12 +128,38 @@ namespace hpx::agas::server {
             hpx::tuple<naming::gid_type, gva, naming::gid_type>;
 
     private:
-        // REVIEW: Separate mutexes might reduce contention here. This has to be
-        // investigated carefully.
-        mutex_type mutex_;
+        // The GVA and reference count tables are partitioned into shards.
+        // The GID space is divided into blocks of consecutive ids, each block
+        // is assigned to one of the shards (by hashing the block). Bindings
+        // spanning more than one block are kept in a separate table. The
+        // shards and the table of ranges are protected by their own locks,
+        // a shard is always locked before the table of ranges. Binding a
+        // range locks all shards (in order), num_ranges_ is incremented only
+        // while holding all shard locks and the lock of the table of ranges.
+        // It is read while holding at least one shard lock whenever the
+        // result decides whether the table of ranges has to be checked for
+        // conflicting bindings, such a read can't miss a range bound
+        // concurrently. num_ranges_ is decremented while holding the lock of
+        // the table of ranges only after the range has been removed. Readers
+        // seeing the old value just lock the table of ranges and don't find
+        // the range, they never see a value of zero while a range exists.
+        struct table
+        {
+            mutex_type mtx_;
+            gva_table_type gvas_;
+            refcnt_table_type refcnts_;
+            std::atomic<std::int64_t> contentions_{0};
+        };
+
+        using shard_type = util::cache_aligned_data<table>;
 
-        gva_table_type gvas_;
-        refcnt_table_type refcnts_;
+        std::size_t const num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        table ranges_;
+        std::atomic<std::size_t> num_ranges_;
+
+        // protects the table of objects currently being migrated
+        mutex_type mutex_;
 
         using migration_table_type = std::map<naming::gid_type,
             hpx::tuple<bool, std::size_t,
@@ -228,7 +255,8 @@ namespace hpx::agas::server {
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
         /// Dump the credit counts of all matching ranges. Expects that \p l
         /// is locked.
-        void dump_refcnt_matches(refcnt_table_type::iterator lower_it,
+        void dump_refcnt_matches(refcnt_table_type& refcnts,
+            refcnt_table_type::iterator lower_it,
             refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
             naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
             const char* func_name);
@@ -238,9 +266,21 @@ namespace hpx::agas::server {
         void wait_for_migration_locked(std::unique_lock<mutex_type>& l,
             naming::gid_type const& id, error_code& ec);
 
+        // return the shard responsible for the given (stripped) id
+        table& shard_for(naming::gid_type const& id) const noexcept;
+
+        // acquire the lock of the given table, counting contentions
+        static std::unique_lock<mutex_type> lock_table(table& t);
+
+        // acquire the locks of all shards, in order
+        std::vector<std::unique_lock<mutex_type>> lock_all_shards();
+
     public:
         primary_namespace()
           : base_type(agas::primary_ns_msb, agas::primary_ns_lsb)
+          , num_shards_(HPX_AGAS_PRIMARY_NAMESPACE_SHARDS)
+          , shards_(new shard_type[num_shards_])
+          , num_ranges_(0)
           , mutex_()
           , instance_name_()
           , next_id_(naming::invalid_gid)
@@ -283,6 +323,9 @@ namespace hpx::agas::server {
         std::int64_t increment_credit(std::int64_t credits,
             naming::gid_type lower, naming::gid_type upper);
 
+        // Apply a batch of reference count requests. Positive credits are
+        // added to the reference counts before any of the negative credits
+        // are subtracted from them.
         std::vector<std::int64_t> decrement_credit(
             std::vector<hpx::tuple<std::int64_t, naming::gid_type,
                 naming::gid_type>> const& requests);
@@ -290,8 +333,18 @@ namespace hpx::agas::server {
         std::pair<naming::gid_type, naming::gid_type> allocate(
             std::uint64_t count);
 
+        // Lock contention statistics, shard == std::size_t(-1) refers to
+        // all tables.
+        std::size_t get_num_shards() const noexcept
+        {
+            return num_shards_;
+        }
+        std::int64_t get_contention_count(std::size_t shard, bool reset);
+
     private:
-        resolved_type resolve_gid_locked(std::unique_lock<mutex_type>& l,
+        // resolve the given gid, acquires the lock of the shard responsible
+        // for it (and the lock of the table of ranges, if needed)
+        resolved_type resolve_gid_impl(
             naming::gid_type const& gid, error_code& ec);
 
         void increment(naming::gid_type const& lower,
@@ -318,20 +371,21 @@ namespace hpx::agas::server {
         using free_entry_list_type =
             std::list<free_entry, free_entry_allocator_type>;
 
-        void resolve_free_list(std::unique_lock<mutex_type>& l,
-            std::list<refcnt_table_type::iterator> const& free_list,
-            free_entry_list_type& free_entry_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            error_code& ec);
+        void add_free_entry(std::unique_lock<mutex_type>& l,
+            naming::gid_type const& gid, resolved_type& r,
+            free_entry_list_type& free_entry_list, error_code& ec);
 
-        void decrement_sweep(free_entry_list_type& free_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
-            std::int64_t credits, error_code& ec);
+        void resolve_free_list(std::vector<naming::gid_type> const& free_list,
+            free_entry_list_type& free_entry_list, error_code& ec);
 
-        void free_components_sync(free_entry_list_type& free_list,
-            naming::gid_type const& lower, naming::gid_type const& upper,
+        void decrement_sweep(free_entry_list_type& free_entry_list,
+            std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+                naming::gid_type>> const& requests,
             error_code& ec);
 
+        void free_components_sync(
+            free_entry_list_type& free_list, error_code& ec);
+
     public:
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, allocate)
         HPX_DEFINE_COMPONENT_ACTION(primary_namespace, bind_gid)
@@ -16,16 +16,20 @@
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/components_base/server/fixed_component_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/functional/function.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -51,16 +55,38 @@ namespace hpx { namespace agas { namespace server {
         using iterate_names_return_type =
             std::map<std::string, naming::gid_type>;
 
-        using gid_table_type =
-            std::map<std::string, std::shared_ptr<naming::gid_type>>;
+        using gid_table_type = std::unordered_map<std::string,
+            std::shared_ptr<naming::gid_type>>;
 
-        using on_event_data_map_type = std::multimap<std::string, hpx::id_type>;
+        using on_event_data_map_type =
+            std::unordered_multimap<std::string, hpx::id_type>;
+
+        using names_index_type = std::set<std::string>;
 
     private:
-        mutex_type mutex_;
-        gid_table_type gids_;
+        // The bound names and the LCOs waiting for names to be bound are
+        // kept in hash tables which are partitioned into shards (selected
+        // by hashing the name), each protected by its own lock. Additionally,
+        // each shard keeps its bound names in an ordered index which allows
+        // to answer queries for all names starting with a given prefix (as
+        // used for wildcard patterns) without visiting all names. Only those
+        // queries have to visit (and lock) all shards.
+        struct table
+        {
+            mutex_type mtx_;
+            gid_table_type gids_;
+            names_index_type names_;
+            on_event_data_map_type on_event_data_;
+        };
+
+        using shard_type = util::cache_aligned_data<table>;
+
+        table& shard_for(std::string const& name) const noexcept;
+
+        std::size_t const num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+
         std::string instance_name_;
-        on_event_data_map_type on_event_data_;
 
     public:
         // data structure holding all counters for the omponent_namespace component
@@ -125,6 +151,8 @@ namespace hpx { namespace agas { namespace server {
     public:
         symbol_namespace()
           : base_type(agas::symbol_ns_msb, agas::symbol_ns_lsb)
+          , num_shards_(HPX_AGAS_SYMBOL_NAMESPACE_SHARDS)
+          , shards_(new shard_type[num_shards_])
         {
         }
 
@@ -22,6 +22,7 @@
 #include <hpx/util/get_and_reset_value.hpp>
 #include <hpx/util/insert_checked.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
@@ -49,6 +50,51 @@ namespace hpx { namespace agas {
 
 namespace hpx { namespace agas { namespace server {
 
+    namespace {
+
+        // number of consecutive ids handled by the same shard
+        constexpr std::size_t gid_block_bits = 8;
+
+        bool same_block(naming::gid_type const& lhs,
+            naming::gid_type const& rhs) noexcept
+        {
+            return lhs.get_msb() == rhs.get_msb() &&
+                (lhs.get_lsb() >> gid_block_bits) ==
+                (rhs.get_lsb() >> gid_block_bits);
+        }
+
+        // Find the binding covering the given id, if any
+        template <typename Table>
+        typename Table::iterator find_binding(
+            Table& gvas, naming::gid_type const& id)
+        {
+            auto it = gvas.upper_bound(id);
+            if (it == gvas.begin())
+            {
+                return gvas.end();
+            }
+
+            --it;
+            if (it->first == id || (it->first + it->second.first.count) > id)
+            {
+                return it;
+            }
+            return gvas.end();
+        }
+
+        // Return whether a binding starts in the given (closed) interval
+        template <typename Table>
+        bool contains_binding(Table const& gvas,
+            naming::gid_type const& lower, naming::gid_type const& upper)
+        {
+            auto it = gvas.lower_bound(lower);
+            return it != gvas.end() && !(upper < it->first);
+        }
+    }    // namespace
+
+    static_assert(HPX_AGAS_PRIMARY_NAMESPACE_SHARDS != 0,
+        "the primary namespace requires at least one shard");
+
     void primary_namespace::register_server_instance(
         char const* servicename, std::uint32_t locality_id, error_code& ec)
     {
@@ -97,7 +143,7 @@ namespace hpx { namespace agas { namespace server {
         std::unique_lock<mutex_type> l(mutex_);
 
         wait_for_migration_locked(l, id, hpx::throws);
-        resolved_type r = resolve_gid_locked(l, id, hpx::throws);
+        resolved_type r = resolve_gid_impl(id, hpx::throws);
         if (get<0>(r) == naming::invalid_gid)
         {
             l.unlock();
@@ -205,12 +251,53 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type gid = id;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        naming::gid_type upper_bound(id + (g.count - 1));
+        bool const spans_blocks = !same_block(id, upper_bound);
+
+        table& s = shard_for(id);
 
-        gva_table_type::iterator it = gvas_.lower_bound(id),
-                                 begin = gvas_.begin(), end = gvas_.end();
+        // Binding a range locks all shards. This prevents single blocks
+        // covered by the range from being bound concurrently by a thread
+        // which has seen the table of ranges empty.
+        std::unique_lock<mutex_type> l;
+        std::vector<std::unique_lock<mutex_type>> shard_locks;
+        if (spans_blocks)
+        {
+            shard_locks = lock_all_shards();
+        }
+        else
+        {
+            l = lock_table(s);
+        }
 
-        if (it != end)
+        // the table of ranges has to be consulted only if it is not empty
+        std::unique_lock<mutex_type> lr;
+        if (spans_blocks || num_ranges_.load(std::memory_order_acquire) != 0)
+        {
+            lr = lock_table(ranges_);
+        }
+
+        auto unlock = [&]() {
+            if (lr.owns_lock())
+            {
+                lr.unlock();
+            }
+            if (l.owns_lock())
+            {
+                l.unlock();
+            }
+            shard_locks.clear();
+        };
+
+        table* t = &s;
+        gva_table_type::iterator it = find_binding(s.gvas_, id);
+        if (it == s.gvas_.end() && lr.owns_lock())
+        {
+            t = &ranges_;
+            it = find_binding(ranges_.gvas_, id);
+        }
+
+        if (it != t->gvas_.end())
         {
             // If we got an exact match, this is a request to update an existing
             // binding (e.g. move semantics).
@@ -220,7 +307,7 @@ namespace hpx { namespace agas { namespace server {
                 if (naming::refers_to_local_lva(gid) &&
                     !naming::refers_to_virtual_memory(gid))
                 {
-                    l.unlock();
+                    unlock();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -237,7 +324,7 @@ namespace hpx { namespace agas { namespace server {
                 if (HPX_UNLIKELY(gaddr.count != g.count))
                 {
                     // REVIEW: Is this the right error code to use?
-                    l.unlock();
+                    unlock();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -246,7 +333,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(components::component_invalid == g.type))
                 {
-                    l.unlock();
+                    unlock();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -257,7 +344,7 @@ namespace hpx { namespace agas { namespace server {
 
                 if (HPX_UNLIKELY(!locality))
                 {
-                    l.unlock();
+                    unlock();
 
                     HPX_THROW_EXCEPTION(bad_parameter,
                         "primary_namespace::bind_gid",
@@ -274,7 +361,7 @@ namespace hpx { namespace agas { namespace server {
                 gaddr.offset = g.offset;
                 loc = locality;
 
-                l.unlock();
+                unlock();
 
                 LAGAS_(info).format(
                     "primary_namespace::bind_gid, gid({1}), gva({2}), "
@@ -284,45 +371,20 @@ namespace hpx { namespace agas { namespace server {
                 return false;
             }
 
-            // We're about to decrement the iterator it - first, we
-            // check that it's safe to do this.
-            else if (it != begin)
-            {
-                --it;
-
-                // Check that a previous range doesn't cover the new id.
-                if (HPX_UNLIKELY((it->first + it->second.first.count) > id))
-                {
-                    // REVIEW: Is this the right error code to use?
-                    l.unlock();
+            // A previous range covers the new id.
+            // REVIEW: Is this the right error code to use?
+            unlock();
 
-                    HPX_THROW_EXCEPTION(bad_parameter,
-                        "primary_namespace::bind_gid",
-                        "the new GID is contained in an existing range");
-                }
-            }
-        }
-
-        else if (HPX_LIKELY(!gvas_.empty()))
-        {
-            --it;
-
-            // Check that a previous range doesn't cover the new id.
-            if ((it->first + it->second.first.count) > id)
-            {
-                // REVIEW: Is this the right error code to use?
-                l.unlock();
-
-                HPX_THROW_EXCEPTION(bad_parameter,
-                    "primary_namespace::bind_gid",
-                    "the new GID is contained in an existing range");
-            }
+            HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
+                "the new GID is contained in an existing range");
         }
 
         // non-migratable gids don't need to be bound
         if (naming::refers_to_local_lva(gid) &&
             !naming::refers_to_virtual_memory(gid))
         {
+            unlock();
+
             LAGAS_(info).format(
                 "primary_namespace::bind_gid, gid({1}), gva({2}), "
                 "locality({3})",
@@ -331,11 +393,9 @@ namespace hpx { namespace agas { namespace server {
             return true;
         }
 
-        naming::gid_type upper_bound(id + (g.count - 1));
-
         if (HPX_UNLIKELY(id.get_msb() != upper_bound.get_msb()))
         {
-            l.unlock();
+            unlock();
 
             HPX_THROW_EXCEPTION(internal_server_error,
                 "primary_namespace::bind_gid",
@@ -344,7 +404,7 @@ namespace hpx { namespace agas { namespace server {
 
         if (HPX_UNLIKELY(components::component_invalid == g.type))
         {
-            l.unlock();
+            unlock();
 
             HPX_THROW_EXCEPTION(bad_parameter, "primary_namespace::bind_gid",
                 "attempt to insert a GVA with an invalid type, "
@@ -352,11 +412,44 @@ namespace hpx { namespace agas { namespace server {
                 id, g, locality);
         }
 
+        // The new binding may not cover any of the existing bindings. All
+        // tables holding bindings in the new range are locked at this point.
+        if (g.count > 1)
+        {
+            bool overlaps = lr.owns_lock() &&
+                contains_binding(ranges_.gvas_, id, upper_bound);
+            if (spans_blocks)
+            {
+                for (std::size_t i = 0; !overlaps && i != num_shards_; ++i)
+                {
+                    overlaps = contains_binding(
+                        shards_[i].data_.gvas_, id, upper_bound);
+                }
+            }
+            else
+            {
+                overlaps = overlaps ||
+                    contains_binding(s.gvas_, id + 1, upper_bound);
+            }
+
+            if (overlaps)
+            {
+                unlock();
+
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "primary_namespace::bind_gid",
+                    "the new range contains an existing GID, "
+                    "gid({1}), gva({2}), locality({3})",
+                    id, g, locality);
+            }
+        }
+
         // Insert a GID -> GVA entry into the GVA table.
-        if (HPX_UNLIKELY(!util::insert_checked(
-                gvas_.insert(std::make_pair(id, std::make_pair(g, locality))))))
+        table& target = spans_blocks ? ranges_ : s;
+        if (HPX_UNLIKELY(!util::insert_checked(target.gvas_.insert(
+                std::make_pair(id, std::make_pair(g, locality))))))
         {
-            l.unlock();
+            unlock();
 
             HPX_THROW_EXCEPTION(lock_error, "primary_namespace::bind_gid",
                 "GVA table insertion failed due to a locking error or "
@@ -364,7 +457,12 @@ namespace hpx { namespace agas { namespace server {
                 id, g, locality);
         }
 
-        l.unlock();
+        if (spans_blocks)
+        {
+            num_ranges_.fetch_add(1, std::memory_order_release);
+        }
+
+        unlock();
 
         LAGAS_(info).format(
             "primary_namespace::bind_gid, gid({1}), gva({2}), locality({3})",
@@ -384,17 +482,19 @@ namespace hpx { namespace agas { namespace server {
 
         resolved_type r;
 
+        if (naming::detail::is_migratable(id))
         {
             std::unique_lock<mutex_type> l(mutex_);
 
             // wait for any migration to be completed
-            if (naming::detail::is_migratable(id))
-            {
-                wait_for_migration_locked(l, id, hpx::throws);
-            }
+            wait_for_migration_locked(l, id, hpx::throws);
 
             // now, resolve the id
-            r = resolve_gid_locked(l, id, hpx::throws);
+            r = resolve_gid_impl(id, hpx::throws);
+        }
+        else
+        {
+            r = resolve_gid_impl(id, hpx::throws);
         }
 
         if (get<0>(r) == naming::invalid_gid)
@@ -431,15 +531,34 @@ namespace hpx { namespace agas { namespace server {
 
         naming::detail::strip_internal_bits_from_gid(id);
 
-        std::unique_lock<mutex_type> l(mutex_);
+        table& s = shard_for(id);
+        std::unique_lock<mutex_type> l = lock_table(s);
+
+        table* t = &s;
+        gva_table_type::iterator it = s.gvas_.find(id);
+
+        std::unique_lock<mutex_type> lr;
+        if (it == s.gvas_.end() &&
+            num_ranges_.load(std::memory_order_acquire) != 0)
+        {
+            lr = lock_table(ranges_);
+            t = &ranges_;
+            it = ranges_.gvas_.find(id);
+        }
 
-        gva_table_type::iterator it = gvas_.find(id), end = gvas_.end();
+        auto unlock = [&]() {
+            if (lr.owns_lock())
+            {
+                lr.unlock();
+            }
+            l.unlock();
+        };
 
-        if (it != end)
+        if (it != t->gvas_.end())
         {
             if (HPX_UNLIKELY(it->second.first.count != count))
             {
-                l.unlock();
+                unlock();
 
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::unbind_gid", "block sizes must match");
@@ -447,9 +566,16 @@ namespace hpx { namespace agas { namespace server {
 
             gva_table_data_type data = it->second;
 
-            gvas_.erase(it);
+            t->gvas_.erase(it);
+            if (t == &ranges_)
+            {
+                // Removing a range does not require all shard locks, other
+                // threads may still see the old count and look for the range
+                // needlessly (see the comment on num_ranges_).
+                num_ranges_.fetch_sub(1, std::memory_order_release);
+            }
 
-            l.unlock();
+            unlock();
             LAGAS_(info).format(
                 "primary_namespace::unbind_gid, gid({1}), count({2}), "
                 "gva({3}), locality_id({4})",
@@ -459,6 +585,8 @@ namespace hpx { namespace agas { namespace server {
             return naming::address(g.prefix, g.type, g.lva());
         }
 
+        unlock();
+
         // non-migratable gids are not bound
         if (naming::refers_to_local_lva(id) &&
             !naming::refers_to_virtual_memory(id))
@@ -476,8 +604,6 @@ namespace hpx { namespace agas { namespace server {
             return naming::address(g.prefix, g.type, g.lva());
         }
 
-        l.unlock();
-
         LAGAS_(info).format(
             "primary_namespace::unbind_gid, gid({1}), count({2}), "
             "response(no_success)",
@@ -529,35 +655,71 @@ namespace hpx { namespace agas { namespace server {
         std::vector<int64_t> res_credits;
         res_credits.reserve(requests.size());
 
+        std::size_t num_increments = 0;
         for (auto& req : requests)
         {
             std::int64_t credits = hpx::get<0>(req);
-            naming::gid_type lower = hpx::get<1>(req);
-            naming::gid_type upper = hpx::get<1>(req);
+            if (credits == 0)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "primary_namespace::decrement_credit",
+                    "invalid credit count of {1}", credits);
+            }
 
-            naming::detail::strip_internal_bits_from_gid(lower);
-            naming::detail::strip_internal_bits_from_gid(upper);
+            if (credits > 0)
+            {
+                // Increment first, the corresponding decrements may be part
+                // of the same batch.
+                naming::gid_type lower = hpx::get<1>(req);
+                naming::gid_type upper = hpx::get<2>(req);
 
-            if (lower == upper)
-                ++upper;
+                naming::detail::strip_internal_bits_from_gid(lower);
+                naming::detail::strip_internal_bits_from_gid(upper);
 
-            // Decrement.
-            if (credits < 0)
-            {
-                free_entry_list_type free_list;
-                decrement_sweep(free_list, lower, upper, -credits, hpx::throws);
+                if (lower == upper)
+                    ++upper;
+
+                increment(lower, upper, credits, hpx::throws);
 
-                free_components_sync(free_list, lower, upper, hpx::throws);
+                ++num_increments;
+                res_credits.push_back(0);
             }
             else
             {
-                HPX_THROW_EXCEPTION(bad_parameter,
-                    "primary_namespace::decrement_credit",
-                    "invalid credit count of {1}", credits);
+                res_credits.push_back(credits);
             }
-            res_credits.push_back(credits);
         }
 
+        if (num_increments == requests.size())
+        {
+            return res_credits;
+        }
+
+        // Decrement, all requests are handled at once to acquire the lock of
+        // each of the affected shards only once.
+        free_entry_list_type free_list;
+        if (num_increments == 0)
+        {
+            decrement_sweep(free_list, requests, hpx::throws);
+        }
+        else
+        {
+            std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+                naming::gid_type>>
+                decrements;
+            decrements.reserve(requests.size() - num_increments);
+            for (auto& req : requests)
+            {
+                if (hpx::get<0>(req) < 0)
+                {
+                    decrements.push_back(req);
+                }
+            }
+            decrement_sweep(free_list, decrements, hpx::throws);
+        }
+
+        free_components_sync(free_list, hpx::throws);
+
         return res_credits;
     }
 
@@ -624,7 +786,7 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
 #if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-    void primary_namespace::dump_refcnt_matches(
+    void primary_namespace::dump_refcnt_matches(refcnt_table_type& refcnts,
         refcnt_table_type::iterator lower_it,
         refcnt_table_type::iterator upper_it, naming::gid_type const& lower,
         naming::gid_type const& upper, std::unique_lock<mutex_type>& l,
@@ -632,7 +794,7 @@ namespace hpx { namespace agas { namespace server {
     {    // dump_refcnt_matches implementation
         HPX_ASSERT(l.owns_lock());
 
-        if (lower_it == refcnts_.end() && upper_it == refcnts_.end())
+        if (lower_it == refcnts.end() && upper_it == refcnts.end())
             // We got nothing, bail - our caller is probably about to throw.
             return;
 
@@ -654,34 +816,67 @@ namespace hpx { namespace agas { namespace server {
     }    // dump_refcnt_matches implementation
 #endif
 
-    ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::increment(naming::gid_type const& lower,
-        naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
-    {    // {{{ increment implementation
-        std::unique_lock<mutex_type> l(mutex_);
+    ///////////////////////////////////////////////////////////////////////////
+    primary_namespace::table& primary_namespace::shard_for(
+        naming::gid_type const& id) const noexcept
+    {
+        // Fibonacci hashing spreads the block numbers over all shards
+        std::uint64_t const block =
+            id.get_msb() ^ (id.get_lsb() >> gid_block_bits);
+        return shards_[static_cast<std::size_t>(
+                           block * 11400714819323198485ull >> 32) %
+            num_shards_]
+            .data_;
+    }
 
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-        if (LAGAS_ENABLED(debug))
+    std::unique_lock<primary_namespace::mutex_type>
+    primary_namespace::lock_table(table& t)
+    {
+        std::unique_lock<mutex_type> l(t.mtx_, std::try_to_lock);
+        if (!l.owns_lock())
         {
-            typedef refcnt_table_type::iterator iterator;
+            t.contentions_.fetch_add(1, std::memory_order_relaxed);
+            l.lock();
+        }
+        return l;
+    }
 
-            // Find the mappings that we're about to touch.
-            refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-            refcnt_table_type::iterator upper_it;
-            if (lower != upper)
-            {
-                upper_it = refcnts_.find(upper);
-            }
-            else
-            {
-                upper_it = lower_it;
-                ++upper_it;
-            }
+    std::vector<std::unique_lock<primary_namespace::mutex_type>>
+    primary_namespace::lock_all_shards()
+    {
+        std::vector<std::unique_lock<mutex_type>> locks;
+        locks.reserve(num_shards_);
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            locks.push_back(lock_table(shards_[i].data_));
+        }
+        return locks;
+    }
+
+    std::int64_t primary_namespace::get_contention_count(
+        std::size_t shard, bool reset)
+    {
+        if (shard != std::size_t(-1))
+        {
+            HPX_ASSERT(shard < num_shards_);
+            return util::get_and_reset_value(
+                shards_[shard].data_.contentions_, reset);
+        }
 
-            dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                "primary_namespace::increment");
+        std::int64_t result =
+            util::get_and_reset_value(ranges_.contentions_, reset);
+        for (std::size_t i = 0; i != num_shards_; ++i)
+        {
+            result +=
+                util::get_and_reset_value(shards_[i].data_.contentions_, reset);
         }
-#endif
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////////
+    void primary_namespace::increment(naming::gid_type const& lower,
+        naming::gid_type const& upper, std::int64_t& credits, error_code& ec)
+    {    // {{{ increment implementation
 
         // TODO: Whine loudly if a reference count overflows. We reserve ~0 for
         // internal bookkeeping in the decrement algorithm, so the maximum global
@@ -693,38 +888,68 @@ namespace hpx { namespace agas { namespace server {
         // allocate/bind them, so if a GID is not in the refcnt table, we know that
         // it's global reference count is the initial global reference count.
 
-        for (naming::gid_type raw = lower; raw != upper; ++raw)
+        for (naming::gid_type raw = lower; raw != upper; /**/)
         {
-            refcnt_table_type::iterator it = refcnts_.find(raw);
-            if (it == refcnts_.end())
-            {
-                std::int64_t count =
-                    std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
+            // all ids of a block are handled by the same shard
+            naming::gid_type const first = raw;
+            table& s = shard_for(first);
+            std::unique_lock<mutex_type> l = lock_table(s);
 
-                std::pair<refcnt_table_type::iterator, bool> p =
-                    refcnts_.insert(refcnt_table_type::value_type(raw, count));
-                if (!p.second)
+#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
+            if (LAGAS_ENABLED(debug))
+            {
+                // Find the mappings that we're about to touch.
+                refcnt_table_type::iterator lower_it = s.refcnts_.find(first);
+                refcnt_table_type::iterator upper_it;
+                if (first != upper)
                 {
-                    l.unlock();
-
-                    HPX_THROWS_IF(ec, invalid_data,
-                        "primary_namespace::increment",
-                        "couldn't create entry in reference count table, "
-                        "raw({1}), ref-count({2})",
-                        raw, count);
-                    return;
+                    upper_it = s.refcnts_.find(upper);
+                }
+                else
+                {
+                    upper_it = lower_it;
+                    ++upper_it;
                 }
 
-                it = p.first;
+                dump_refcnt_matches(s.refcnts_, lower_it, upper_it, first,
+                    upper, l, "primary_namespace::increment");
             }
-            else
+#endif
+
+            for (/**/; raw != upper && same_block(first, raw); ++raw)
             {
-                it->second += credits;
-            }
+                refcnt_table_type::iterator it = s.refcnts_.find(raw);
+                if (it == s.refcnts_.end())
+                {
+                    std::int64_t count =
+                        std::int64_t(HPX_GLOBALCREDIT_INITIAL) + credits;
 
-            LAGAS_(info).format(
-                "primary_namespace::increment, raw({1}), refcnt({2})", lower,
-                it->second);
+                    std::pair<refcnt_table_type::iterator, bool> p =
+                        s.refcnts_.insert(
+                            refcnt_table_type::value_type(raw, count));
+                    if (!p.second)
+                    {
+                        l.unlock();
+
+                        HPX_THROWS_IF(ec, invalid_data,
+                            "primary_namespace::increment",
+                            "couldn't create entry in reference count table, "
+                            "raw({1}), ref-count({2})",
+                            raw, count);
+                        return;
+                    }
+
+                    it = p.first;
+                }
+                else
+                {
+                    it->second += credits;
+                }
+
+                LAGAS_(info).format(
+                    "primary_namespace::increment, raw({1}), refcnt({2})",
+                    lower, it->second);
+            }
         }
 
         if (&ec != &throws)
@@ -732,145 +957,191 @@ namespace hpx { namespace agas { namespace server {
     }    // }}}
 
     ///////////////////////////////////////////////////////////////////////////////
-    void primary_namespace::resolve_free_list(std::unique_lock<mutex_type>& l,
-        std::list<refcnt_table_type::iterator> const& free_list,
-        free_entry_list_type& free_entry_list,
-        naming::gid_type const& /* lower */,
-        naming::gid_type const& /* upper */, error_code& ec)
+    void primary_namespace::add_free_entry(std::unique_lock<mutex_type>& l,
+        naming::gid_type const& gid, resolved_type& r,
+        free_entry_list_type& free_entry_list, error_code& ec)
     {
-        HPX_ASSERT_OWNS_LOCK(l);
-
         using hpx::get;
 
-        typedef refcnt_table_type::iterator iterator;
+        auto unlock = [&]() {
+            if (l.owns_lock())
+            {
+                l.unlock();
+            }
+        };
 
-        for (iterator const& it : free_list)
+        naming::gid_type& raw = get<0>(r);
+        if (raw == naming::invalid_gid)
         {
-            typedef refcnt_table_type::key_type key_type;
+            unlock();
+
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_list",
+                "primary_namespace::resolve_free_list, failed to resolve "
+                "gid, gid({1})",
+                gid);
+            return;    // couldn't resolve this one
+        }
 
-            // The mapping's key space.
-            key_type gid = it->first;
+        // Make sure the GVA is valid.
+        gva& g = get<1>(r);
 
-            if (naming::detail::is_migratable(gid))
-            {
-                // wait for any migration to be completed
-                wait_for_migration_locked(l, gid, ec);
-            }
+        // REVIEW: Should we do more to make sure the GVA is valid?
+        if (HPX_UNLIKELY(components::component_invalid == g.type))
+        {
+            unlock();
 
-            // Resolve the query GID.
-            resolved_type r = resolve_gid_locked(l, gid, ec);
-            if (ec)
-                return;
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_list",
+                "encountered a GVA with an invalid type while performing a "
+                "decrement, gid({1}), gva({2})",
+                gid, g);
+            return;
+        }
+        else if (HPX_UNLIKELY(0 == g.count))
+        {
+            unlock();
 
-            naming::gid_type& raw = get<0>(r);
-            if (raw == naming::invalid_gid)
-            {
-                l.unlock();
+            HPX_THROWS_IF(ec, internal_server_error,
+                "primary_namespace::resolve_free_list",
+                "encountered a GVA with a count of zero while performing a "
+                "decrement, gid({1}), gva({2})",
+                gid, g);
+            return;
+        }
 
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "primary_namespace::resolve_free_list, failed to resolve "
-                    "gid, gid({1})",
-                    gid);
-                return;    // couldn't resolve this one
-            }
+        LAGAS_(info).format(
+            "primary_namespace::resolve_free_list, resolved match, "
+            "gid({1}), gva({2})",
+            gid, g);
+
+        // Fully resolve the range.
+        gva const resolved = g.resolve(gid, raw);
+
+        // Add the information needed to destroy these components to the
+        // free list.
+        free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
 
-            // Make sure the GVA is valid.
-            gva& g = get<1>(r);
+        if (&ec != &throws)
+            ec = make_success_code();
+    }
 
-            // REVIEW: Should we do more to make sure the GVA is valid?
-            if (HPX_UNLIKELY(components::component_invalid == g.type))
+    // Resolve the objects which could not be resolved while their reference
+    // count was decremented (objects being migrated and objects bound as part
+    // of a range spanning several blocks of GIDs).
+    void primary_namespace::resolve_free_list(
+        std::vector<naming::gid_type> const& free_list,
+        free_entry_list_type& free_entry_list, error_code& ec)
+    {
+        for (naming::gid_type const& gid : free_list)
+        {
+            resolved_type r;
+            if (naming::detail::is_migratable(gid))
             {
-                l.unlock();
+                // wait for any migration to be completed
+                std::unique_lock<mutex_type> l(mutex_);
+                wait_for_migration_locked(l, gid, ec);
+                if (ec)
+                    return;
 
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with an invalid type while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
+                // Resolve the query GID.
+                r = resolve_gid_impl(gid, ec);
             }
-            else if (HPX_UNLIKELY(0 == g.count))
+            else
             {
-                l.unlock();
-
-                HPX_THROWS_IF(ec, internal_server_error,
-                    "primary_namespace::resolve_free_list",
-                    "encountered a GVA with a count of zero while performing a "
-                    "decrement, gid({1}), gva({2})",
-                    gid, g);
-                return;
+                r = resolve_gid_impl(gid, ec);
             }
+            if (ec)
+                return;
 
-            LAGAS_(info).format(
-                "primary_namespace::resolve_free_list, resolved match, "
-                "gid({1}), gva({2})",
-                gid, g);
-
-            // Fully resolve the range.
-            gva const resolved = g.resolve(gid, raw);
-
-            // Add the information needed to destroy these components to the
-            // free list.
-            free_entry_list.push_back(free_entry(resolved, gid, get<2>(r)));
+            std::unique_lock<mutex_type> l;
+            add_free_entry(l, gid, r, free_entry_list, ec);
+            if (ec)
+                return;
 
             // remove this entry from the refcnt table
-            refcnts_.erase(it);
+            table& s = shard_for(gid);
+            l = lock_table(s);
+
+            refcnt_table_type::iterator it = s.refcnts_.find(gid);
+            if (it != s.refcnts_.end() && it->second == 0)
+            {
+                s.refcnts_.erase(it);
+            }
         }
     }
 
     ///////////////////////////////////////////////////////////////////////////////
     void primary_namespace::decrement_sweep(
-        free_entry_list_type& free_entry_list, naming::gid_type const& lower,
-        naming::gid_type const& upper, std::int64_t credits, error_code& ec)
+        free_entry_list_type& free_entry_list,
+        std::vector<hpx::tuple<std::int64_t, naming::gid_type,
+            naming::gid_type>> const& requests,
+        error_code& ec)
     {    // {{{ decrement_sweep implementation
-        LAGAS_(info).format(
-            "primary_namespace::decrement_sweep, lower({1}), upper({2}), "
-            "credits({3})",
-            lower, upper, credits);
-
         free_entry_list.clear();
 
+        ///////////////////////////////////////////////////////////////////////
+        // Apply the decrements across the entire key space (e.g. [lower,
+        // upper]) of all requests, grouped by the shard responsible for the
+        // affected GIDs.
+        struct decrement_request
         {
-            std::unique_lock<mutex_type> l(mutex_);
+            table* shard_;
+            naming::gid_type raw_;
+            std::int64_t credits_;
+        };
 
-#if defined(HPX_HAVE_AGAS_DUMP_REFCNT_ENTRIES)
-            if (LAGAS_ENABLED(debug))
-            {
-                typedef refcnt_table_type::iterator iterator;
+        std::vector<decrement_request> decrements;
+        decrements.reserve(requests.size());
 
-                // Find the mappings that we just added or modified.
-                refcnt_table_type::iterator lower_it = refcnts_.find(lower);
-                refcnt_table_type::iterator upper_it;
-                if (lower != upper)
-                {
-                    upper_it = refcnts_.find(upper);
-                }
-                else
-                {
-                    upper_it = lower_it;
-                    ++upper_it;
-                }
+        for (auto const& req : requests)
+        {
+            naming::gid_type lower = hpx::get<1>(req);
+            naming::gid_type upper = hpx::get<2>(req);
 
-                dump_refcnt_matches(lower_it, upper_it, lower, upper, l,
-                    "primary_namespace::decrement_sweep");
-            }
-#endif
+            naming::detail::strip_internal_bits_from_gid(lower);
+            naming::detail::strip_internal_bits_from_gid(upper);
 
-            ///////////////////////////////////////////////////////////////////////
-            // Apply the decrement across the entire key space (e.g. [lower, upper]).
+            if (lower == upper)
+                ++upper;
 
-            // The third parameter we pass here is the default data to use in case
-            // the key is not mapped. We don't insert GIDs into the refcnt table
-            // when we allocate/bind them, so if a GID is not in the refcnt table,
-            // we know that it's global reference count is the initial global
-            // reference count.
+            LAGAS_(info).format(
+                "primary_namespace::decrement_sweep, lower({1}), upper({2}), "
+                "credits({3})",
+                lower, upper, -hpx::get<0>(req));
 
-            std::list<refcnt_table_type::iterator> free_list;
             for (naming::gid_type raw = lower; raw != upper; ++raw)
             {
-                refcnt_table_type::iterator it = refcnts_.find(raw);
-                if (it == refcnts_.end())
+                decrements.push_back(
+                    decrement_request{&shard_for(raw), raw, -hpx::get<0>(req)});
+            }
+        }
+
+        std::stable_sort(decrements.begin(), decrements.end(),
+            [](decrement_request const& lhs, decrement_request const& rhs) {
+                return lhs.shard_ < rhs.shard_;
+            });
+
+        // objects which need to be resolved without holding a shard lock
+        std::vector<naming::gid_type> free_list;
+
+        for (auto req = decrements.begin(); req != decrements.end(); /**/)
+        {
+            table& s = *req->shard_;
+            std::unique_lock<mutex_type> l = lock_table(s);
+
+            for (/**/; req != decrements.end() && req->shard_ == &s; ++req)
+            {
+                naming::gid_type const& raw = req->raw_;
+                std::int64_t const credits = req->credits_;
+
+                // The third parameter we pass here is the default data to use
+                // in case the key is not mapped. We don't insert GIDs into the
+                // refcnt table when we allocate/bind them, so if a GID is not
+                // in the refcnt table, we know that it's global reference
+                // count is the initial global reference count.
+                refcnt_table_type::iterator it = s.refcnts_.find(raw);
+                if (it == s.refcnts_.end())
                 {
                     if (credits > std::int64_t(HPX_GLOBALCREDIT_INITIAL))
                     {
@@ -889,7 +1160,7 @@ namespace hpx { namespace agas { namespace server {
                         std::int64_t(HPX_GLOBALCREDIT_INITIAL) - credits;
 
                     std::pair<refcnt_table_type::iterator, bool> p =
-                        refcnts_.insert(
+                        s.refcnts_.insert(
                             refcnt_table_type::value_type(raw, count));
                     if (!p.second)
                     {
@@ -923,24 +1194,46 @@ namespace hpx { namespace agas { namespace server {
                     return;
                 }
 
-                // this objects needs to be deleted
-                if (it->second == 0)
-                    free_list.push_back(it);
-            }
+                if (it->second != 0)
+                    continue;
 
-            // Resolve the objects which have to be deleted.
-            resolve_free_list(l, free_list, free_entry_list, lower, upper, ec);
+                // This object needs to be deleted. Objects bound in this
+                // shard can be resolved right away, unless they might be
+                // in the process of being migrated.
+                if (!naming::detail::is_migratable(raw) &&
+                    !(naming::refers_to_local_lva(raw) &&
+                        !naming::refers_to_virtual_memory(raw)))
+                {
+                    gva_table_type::iterator git = find_binding(s.gvas_, raw);
+                    if (git != s.gvas_.end())
+                    {
+                        resolved_type r(
+                            git->first, git->second.first, git->second.second);
+                        add_free_entry(l, raw, r, free_entry_list, ec);
+                        if (ec)
+                            return;
+
+                        s.refcnts_.erase(it);
+                        continue;
+                    }
+                }
 
+                free_list.push_back(raw);
+            }
         }    // Unlock the mutex.
 
+        // Resolve the remaining objects which have to be deleted.
+        resolve_free_list(free_list, free_entry_list, ec);
+        if (ec)
+            return;
+
         if (&ec != &throws)
             ec = make_success_code();
     }
 
     ///////////////////////////////////////////////////////////////////////////////
     void primary_namespace::free_components_sync(
-        free_entry_list_type& free_list, naming::gid_type const& lower,
-        naming::gid_type const& upper, error_code& ec)
+        free_entry_list_type& free_list, error_code& ec)
     {    // {{{ free_components_sync implementation
         using hpx::get;
 
@@ -954,16 +1247,16 @@ namespace hpx { namespace agas { namespace server {
             {
                 LAGAS_(info).format(
                     "primary_namespace::free_components_sync, cancelling free "
-                    "operation because the threadmanager is down, lower({1}), "
-                    "upper({2}), base({3}), gva({4}), locality({5})",
-                    lower, upper, e.gid_, e.gva_, e.locality_);
+                    "operation because the threadmanager is down, "
+                    "base({1}), gva({2}), locality({3})",
+                    e.gid_, e.gva_, e.locality_);
                 continue;
             }
 
             LAGAS_(info).format(
                 "primary_namespace::free_components_sync, freeing component, "
-                "lower({1}), upper({2}), base({3}), gva({4}), locality({5})",
-                lower, upper, e.gid_, e.gva_, e.locality_);
+                "base({1}), gva({2}), locality({3})",
+                e.gid_, e.gva_, e.locality_);
 
             // Destroy the component.
             HPX_ASSERT(e.locality_ == e.gva_.prefix);
@@ -992,11 +1285,9 @@ namespace hpx { namespace agas { namespace server {
             ec = make_success_code();
     }    // }}}
 
-    primary_namespace::resolved_type primary_namespace::resolve_gid_locked(
-        std::unique_lock<mutex_type>& l, naming::gid_type const& gid,
-        error_code& ec)
-    {    // {{{ resolve_gid_locked implementation
-        HPX_ASSERT_OWNS_LOCK(l);
+    primary_namespace::resolved_type primary_namespace::resolve_gid_impl(
+        naming::gid_type const& gid, error_code& ec)
+    {    // {{{ resolve_gid_impl implementation
 
         // handle (non-migratable) components located on this locality first
         if (naming::refers_to_local_lva(gid) &&
@@ -1013,13 +1304,14 @@ namespace hpx { namespace agas { namespace server {
         naming::gid_type id = gid;
         naming::detail::strip_internal_bits_from_gid(id);
 
-        gva_table_type::const_iterator it = gvas_.lower_bound(id),
-                                       begin = gvas_.begin(), end = gvas_.end();
-
-        if (it != end)
+        // bindings which are fully contained in the block of the given id
+        // are stored in the shard responsible for the block
         {
-            // Check for exact match
-            if (it->first == id)
+            table& s = shard_for(id);
+            std::unique_lock<mutex_type> l = lock_table(s);
+
+            gva_table_type::const_iterator it = find_binding(s.gvas_, id);
+            if (it != s.gvas_.end())
             {
                 if (&ec != &throws)
                     ec = make_success_code();
@@ -1027,51 +1319,26 @@ namespace hpx { namespace agas { namespace server {
                 gva_table_data_type const& data = it->second;
                 return resolved_type(it->first, data.first, data.second);
             }
-
-            // We need to decrement the iterator, first we check that it's safe
-            // to do this.
-            else if (it != begin)
-            {
-                --it;
-
-                // Found the GID in a range
-                gva_table_data_type const& data = it->second;
-                if ((it->first + data.first.count) > id)
-                {
-                    if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
-                    {
-                        l.unlock();
-
-                        HPX_THROWS_IF(ec, internal_server_error,
-                            "primary_namespace::resolve_gid_locked",
-                            "MSBs of lower and upper range bound do not "
-                            "match");
-                        return resolved_type(
-                            naming::invalid_gid, gva(), naming::invalid_gid);
-                    }
-
-                    if (&ec != &throws)
-                        ec = make_success_code();
-
-                    return resolved_type(it->first, data.first, data.second);
-                }
-            }
         }
 
-        else if (HPX_LIKELY(!gvas_.empty()))
+        // This read is not ordered with concurrent (un)binding of ranges.
+        // That is benign, it has the same effect as resolving the id just
+        // before or after the range was bound or unbound.
+        if (num_ranges_.load(std::memory_order_acquire) != 0)
         {
-            --it;
+            std::unique_lock<mutex_type> l = lock_table(ranges_);
 
-            // Found the GID in a range
-            gva_table_data_type const& data = it->second;
-            if ((it->first + data.first.count) > id)
+            gva_table_type::const_iterator it =
+                find_binding(ranges_.gvas_, id);
+            if (it != ranges_.gvas_.end())
             {
+                // Found the GID in a range
                 if (HPX_UNLIKELY(id.get_msb() != it->first.get_msb()))
                 {
                     l.unlock();
 
                     HPX_THROWS_IF(ec, internal_server_error,
-                        "primary_namespace::resolve_gid_locked",
+                        "primary_namespace::resolve_gid_impl",
                         "MSBs of lower and upper range bound do not match");
                     return resolved_type(
                         naming::invalid_gid, gva(), naming::invalid_gid);
@@ -1080,6 +1347,7 @@ namespace hpx { namespace agas { namespace server {
                 if (&ec != &throws)
                     ec = make_success_code();
 
+                gva_table_data_type const& data = it->second;
                 return resolved_type(it->first, data.first, data.second);
             }
         }
@@ -27,6 +27,7 @@
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -86,6 +87,12 @@ namespace hpx { namespace agas { namespace server {
         }
     }
 
+    symbol_namespace::table& symbol_namespace::shard_for(
+        std::string const& name) const noexcept
+    {
+        return shards_[std::hash<std::string>()(name) % num_shards_].data_;
+    }
+
     bool symbol_namespace::bind(std::string key, naming::gid_type gid)
     {    // {{{ bind implementation
         // parameters
@@ -93,10 +100,11 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.bind_.time_, counter_data_.bind_.enabled_);
         counter_data_.increment_bind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        table& t = shard_for(key);
+        std::unique_lock<mutex_type> l(t.mtx_);
 
-        gid_table_type::iterator it = gids_.find(key);
-        gid_table_type::iterator end = gids_.end();
+        gid_table_type::iterator it = t.gids_.find(key);
+        gid_table_type::iterator end = t.gids_.end();
 
         if (it != end)
         {
@@ -139,7 +147,7 @@ namespace hpx { namespace agas { namespace server {
             return false;
         }
 
-        if (HPX_UNLIKELY(!util::insert_checked(gids_.insert(
+        if (HPX_UNLIKELY(!util::insert_checked(t.gids_.insert(
                 std::make_pair(key, std::make_shared<naming::gid_type>(gid))))))
         {
             l.unlock();
@@ -149,9 +157,11 @@ namespace hpx { namespace agas { namespace server {
                 "memory corruption");
         }
 
+        t.names_.insert(key);
+
         // handle registered events
         typedef on_event_data_map_type::iterator iterator;
-        std::pair<iterator, iterator> p = on_event_data_.equal_range(key);
+        std::pair<iterator, iterator> p = t.on_event_data_.equal_range(key);
 
         std::vector<hpx::id_type> lcos;
         if (p.first != p.second)
@@ -163,7 +173,7 @@ namespace hpx { namespace agas { namespace server {
                 ++it;
             }
 
-            on_event_data_.erase(p.first, p.second);
+            t.on_event_data_.erase(p.first, p.second);
 
             // notify all LCOS which were registered with this name
             for (hpx::id_type const& id : lcos)
@@ -171,8 +181,8 @@ namespace hpx { namespace agas { namespace server {
                 // re-locate the entry in the GID table for each LCO anew, as we
                 // need to unlock the mutex protecting the table for each iteration
                 // below
-                gid_table_type::iterator gid_it = gids_.find(key);
-                if (gid_it == gids_.end())
+                gid_table_type::iterator gid_it = t.gids_.find(key);
+                if (gid_it == t.gids_.end())
                 {
                     l.unlock();
 
@@ -218,13 +228,16 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.resolve_.time_, counter_data_.resolve_.enabled_);
         counter_data_.increment_resolve_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        table& t = shard_for(key);
+        std::unique_lock<mutex_type> l(t.mtx_);
 
-        gid_table_type::iterator it = gids_.find(key);
-        gid_table_type::iterator end = gids_.end();
+        gid_table_type::iterator it = t.gids_.find(key);
+        gid_table_type::iterator end = t.gids_.end();
 
         if (it == end)
         {
+            l.unlock();
+
             LAGAS_(info).format(
                 "symbol_namespace::resolve, key({1}), response(no_success)",
                 key);
@@ -253,13 +266,16 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.unbind_.time_, counter_data_.unbind_.enabled_);
         counter_data_.increment_unbind_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        table& t = shard_for(key);
+        std::unique_lock<mutex_type> l(t.mtx_);
 
-        gid_table_type::iterator it = gids_.find(key);
-        gid_table_type::iterator end = gids_.end();
+        gid_table_type::iterator it = t.gids_.find(key);
+        gid_table_type::iterator end = t.gids_.end();
 
         if (it == end)
         {
+            l.unlock();
+
             LAGAS_(info).format(
                 "symbol_namespace::unbind, key({1}), response(no_success)",
                 key);
@@ -269,7 +285,8 @@ namespace hpx { namespace agas { namespace server {
 
         naming::gid_type const gid = *(it->second);
 
-        gids_.erase(it);
+        t.gids_.erase(it);
+        t.names_.erase(key);
 
         l.unlock();
 
@@ -290,44 +307,62 @@ namespace hpx { namespace agas { namespace server {
 
         std::map<std::string, naming::gid_type> found;
 
-        if (pattern.find_first_of("*?[]") != std::string::npos)
+        // hold on to the entries while the maps are unlocked
+        std::vector<std::pair<std::string, std::shared_ptr<naming::gid_type>>>
+            entries;
+
+        // an exact name is looked up in the hash table only
+        std::string::size_type const wildcard = pattern.find_first_of("*?[\\");
+        if (!pattern.empty() && wildcard == std::string::npos)
         {
-            std::string str_rx(util::regex_from_pattern(pattern, throws));
-            std::regex rx(str_rx);
+            table& t = shard_for(pattern);
+            std::lock_guard<mutex_type> l(t.mtx_);
 
-            std::unique_lock<mutex_type> l(mutex_);
-            for (gid_table_type::iterator it = gids_.begin(); it != gids_.end();
-                 ++it)
+            gid_table_type::iterator it = t.gids_.find(pattern);
+            if (it != t.gids_.end())
             {
-                if (!std::regex_match(it->first, rx))
-                    continue;
-
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(it->second);
-                util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
-
-                found[it->first] =
-                    naming::detail::split_gid_if_needed(*current_gid).get();
+                entries.emplace_back(pattern, it->second);
             }
         }
         else
         {
-            std::unique_lock<mutex_type> l(mutex_);
-            for (gid_table_type::iterator it = gids_.begin(); it != gids_.end();
-                 ++it)
-            {
-                if (!pattern.empty() && pattern != it->first)
-                    continue;
+            // collect all names starting with the literal prefix of the
+            // pattern from all shards
+            std::string const prefix = pattern.substr(0, wildcard);
 
-                // hold on to entry while map is unlocked
-                std::shared_ptr<naming::gid_type> current_gid(it->second);
-                util::unlock_guard<std::unique_lock<mutex_type>> ul(l);
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                table& t = shards_[i].data_;
+                std::lock_guard<mutex_type> l(t.mtx_);
 
-                found[it->first] =
-                    naming::detail::split_gid_if_needed(*current_gid).get();
+                for (auto it = t.names_.lower_bound(prefix);
+                     it != t.names_.end() &&
+                     it->compare(0, prefix.size(), prefix) == 0;
+                     ++it)
+                {
+                    gid_table_type::iterator gid_it = t.gids_.find(*it);
+                    HPX_ASSERT(gid_it != t.gids_.end());
+                    entries.emplace_back(*it, gid_it->second);
+                }
             }
         }
 
+        std::regex rx;
+        bool const match = wildcard != std::string::npos;
+        if (match)
+        {
+            rx = std::regex(util::regex_from_pattern(pattern, throws));
+        }
+
+        for (auto& entry : entries)
+        {
+            if (match && !std::regex_match(entry.first, rx))
+                continue;
+
+            found[HPX_MOVE(entry.first)] =
+                naming::detail::split_gid_if_needed(*entry.second).get();
+        }
+
         LAGAS_(info).format("symbol_namespace::iterate");
 
         return found;
@@ -340,15 +375,16 @@ namespace hpx { namespace agas { namespace server {
             counter_data_.on_event_.time_, counter_data_.on_event_.enabled_);
         counter_data_.increment_on_event_count();
 
-        std::unique_lock<mutex_type> l(mutex_);
+        table& t = shard_for(name);
+        std::unique_lock<mutex_type> l(t.mtx_);
 
         bool handled = false;
         naming::gid_type new_gid;
 
         if (call_for_past_events)
         {
-            gid_table_type::iterator it = gids_.find(name);
-            if (it != gids_.end())
+            gid_table_type::iterator it = t.gids_.find(name);
+            if (it != t.gids_.end())
             {
                 // hold on to entry while map is unlocked
                 std::shared_ptr<naming::gid_type> current_gid(it->second);
@@ -376,12 +412,12 @@ namespace hpx { namespace agas { namespace server {
 
         if (!handled)
         {
-            on_event_data_map_type::iterator it = on_event_data_.insert(
+            on_event_data_map_type::iterator it = t.on_event_data_.insert(
                 on_event_data_map_type::value_type(name, lco));
 
             // This overload of insert always returns the iterator pointing
             // to the inserted value. It should never point to end
-            HPX_ASSERT(it != on_event_data_.end());
+            HPX_ASSERT(it != t.on_event_data_.end());
             HPX_UNUSED(it);
         }
         l.unlock();
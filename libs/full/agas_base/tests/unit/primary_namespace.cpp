@@ -0,0 +1,196 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/include/async.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using hpx::agas::gva;
+using hpx::agas::server::primary_namespace;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+gid_type const locality(1, 1);
+
+gva make_gva(std::uint64_t count, std::uint64_t lva)
+{
+    return gva(locality, 42, count, lva);
+}
+
+gid_type resolved_base(primary_namespace& pns, gid_type const& id)
+{
+    return hpx::get<0>(pns.resolve_gid(id));
+}
+
+template <typename F>
+bool throws_bad_parameter(F&& f)
+{
+    try
+    {
+        f();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        return true;
+    }
+    return false;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bind_resolve_unbind()
+{
+    primary_namespace pns;
+
+    gid_type const id(1, 0x1000);
+    HPX_TEST(pns.bind_gid(make_gva(1, 0x100), id, locality));
+    HPX_TEST(resolved_base(pns, id) == id);
+    HPX_TEST(hpx::get<1>(pns.resolve_gid(id)).lva() ==
+        reinterpret_cast<void*>(0x100));
+
+    // a range spanning many blocks
+    gid_type const base(1, 0x10000);
+    std::uint64_t const count = 5000;
+    HPX_TEST(pns.bind_gid(make_gva(count, 0x200), base, locality));
+    HPX_TEST(resolved_base(pns, base + 2500) == base);
+    HPX_TEST(resolved_base(pns, base + (count - 1)) == base);
+    HPX_TEST(resolved_base(pns, base + count) == hpx::naming::invalid_gid);
+
+    // bindings may not overlap
+    HPX_TEST(throws_bad_parameter(
+        [&] { pns.bind_gid(make_gva(1, 0x300), base + 1000, locality); }));
+    HPX_TEST(throws_bad_parameter(
+        [&] { pns.bind_gid(make_gva(4096, 0x300), id - 16, locality); }));
+    HPX_TEST(throws_bad_parameter([&] {
+        pns.bind_gid(make_gva(1000, 0x300), base - 500, locality);
+    }));
+
+    HPX_TEST(pns.unbind_gid(count, base).address_ ==
+        reinterpret_cast<void*>(0x200));
+    HPX_TEST(resolved_base(pns, base + 2500) == hpx::naming::invalid_gid);
+
+    pns.unbind_gid(1, id);
+    HPX_TEST(resolved_base(pns, id) == hpx::naming::invalid_gid);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Bind, resolve and unbind ids of many blocks (and therefore shards) from
+// concurrent threads while ranges are bound and unbound.
+void test_concurrent_bind_resolve_unbind()
+{
+    primary_namespace pns;
+
+    std::size_t const num_tasks = 64;
+    std::size_t const iterations = 100;
+
+    gid_type const range_base(1, 0x1000000);
+    std::uint64_t const range_count = 256 * 8;
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks + 1);
+    for (std::size_t k = 0; k != num_tasks; ++k)
+    {
+        futures.push_back(hpx::async([&, k]() {
+            gid_type const id(1, 0x10000 + 256 * k);
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                HPX_TEST(pns.bind_gid(make_gva(1, i + 1), id, locality));
+                HPX_TEST(resolved_base(pns, id) == id);
+
+                // ids of the range are either not bound or resolve to the
+                // range
+                gid_type const base =
+                    resolved_base(pns, range_base + 256 * (k % 8));
+                HPX_TEST(base == hpx::naming::invalid_gid ||
+                    base == range_base);
+
+                pns.unbind_gid(1, id);
+                HPX_TEST(resolved_base(pns, id) == hpx::naming::invalid_gid);
+            }
+        }));
+    }
+
+    futures.push_back(hpx::async([&]() {
+        for (std::size_t i = 0; i != iterations; ++i)
+        {
+            HPX_TEST(pns.bind_gid(
+                make_gva(range_count, 0x100), range_base, locality));
+            HPX_TEST(
+                resolved_base(pns, range_base + (range_count - 1)) ==
+                range_base);
+            pns.unbind_gid(range_count, range_base);
+        }
+    }));
+
+    hpx::wait_all(futures);
+
+    for (std::size_t k = 0; k != num_tasks; ++k)
+    {
+        HPX_TEST(resolved_base(pns, gid_type(1, 0x10000 + 256 * k)) ==
+            hpx::naming::invalid_gid);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Concurrently bind a range and single ids covered by it, either the range
+// or the single ids end up being bound.
+void test_concurrent_overlap()
+{
+    std::size_t const num_singles = 16;
+    gid_type const base(1, 0x100000);
+    std::uint64_t const count = 256 * num_singles;
+
+    for (int iteration = 0; iteration != 100; ++iteration)
+    {
+        primary_namespace pns;
+
+        std::atomic<std::size_t> singles_bound(0);
+        std::vector<hpx::future<void>> futures;
+        futures.reserve(num_singles);
+        for (std::size_t i = 0; i != num_singles; ++i)
+        {
+            futures.push_back(hpx::async([&, i]() {
+                gid_type const id = base + (256 * i + 17);
+                if (!throws_bad_parameter(
+                        [&] { pns.bind_gid(make_gva(1, i), id, locality); }))
+                {
+                    ++singles_bound;
+                }
+            }));
+        }
+
+        bool const range_bound = !throws_bad_parameter(
+            [&] { pns.bind_gid(make_gva(count, 0x100), base, locality); });
+        hpx::wait_all(futures);
+
+        HPX_TEST(range_bound != (singles_bound != 0));
+        for (std::size_t i = 0; i != num_singles; ++i)
+        {
+            gid_type const id = base + (256 * i + 17);
+            HPX_TEST(resolved_base(pns, id) == (range_bound ? base : id));
+        }
+    }
+}
+
+int main()
+{
+    test_bind_resolve_unbind();
+    test_concurrent_bind_resolve_unbind();
+    test_concurrent_overlap();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,103 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/include/async.hpp>
+#include <hpx/modules/agas_base.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using hpx::agas::server::symbol_namespace;
+using hpx::naming::gid_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_bind_resolve_iterate()
+{
+    symbol_namespace sns;
+
+    // the names are spread over all shards
+    for (std::uint64_t i = 0; i != 100; ++i)
+    {
+        HPX_TEST(sns.bind("/test/a/" + std::to_string(i), gid_type(1, i + 1)));
+        HPX_TEST(sns.bind("/test/b/" + std::to_string(i), gid_type(2, i + 1)));
+    }
+    HPX_TEST(!sns.bind("/test/a/0", gid_type(3, 1)));
+
+    HPX_TEST(sns.resolve("/test/a/42") == gid_type(1, 43));
+    HPX_TEST(sns.resolve("/test/c/42") == hpx::naming::invalid_gid);
+
+    // exact names, prefixes, and patterns
+    HPX_TEST_EQ(sns.iterate("/test/a/42").size(), std::size_t(1));
+    HPX_TEST_EQ(sns.iterate("/test/c/42").size(), std::size_t(0));
+    HPX_TEST_EQ(sns.iterate("/test/a/*").size(), std::size_t(100));
+    HPX_TEST_EQ(sns.iterate("/test/*").size(), std::size_t(200));
+    HPX_TEST_EQ(sns.iterate("/test/?/1?").size(), std::size_t(20));
+    HPX_TEST_EQ(sns.iterate("*/1").size(), std::size_t(2));
+
+    auto const found = sns.iterate("/test/b/*");
+    for (auto const& entry : found)
+    {
+        HPX_TEST(entry.second ==
+            gid_type(2, std::stoull(entry.first.substr(8)) + 1));
+    }
+
+    HPX_TEST(sns.unbind("/test/a/42") == gid_type(1, 43));
+    HPX_TEST(sns.unbind("/test/a/42") == hpx::naming::invalid_gid);
+    HPX_TEST_EQ(sns.iterate("/test/a/*").size(), std::size_t(99));
+    HPX_TEST_EQ(sns.iterate("/test/a/42").size(), std::size_t(0));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_concurrent_bind_unbind()
+{
+    symbol_namespace sns;
+
+    std::size_t const num_tasks = 16;
+    std::uint64_t const count = 100;
+
+    std::vector<hpx::future<void>> futures;
+    for (std::size_t k = 0; k != num_tasks; ++k)
+    {
+        futures.push_back(hpx::async([&, k]() {
+            std::string const prefix = "/task" + std::to_string(k) + "/";
+            for (std::uint64_t i = 0; i != count; ++i)
+            {
+                gid_type const id(k + 1, i + 1);
+                HPX_TEST(sns.bind(prefix + std::to_string(i), id));
+            }
+
+            // patterns see all names bound by this task
+            HPX_TEST_EQ(sns.iterate(prefix + "*").size(), count);
+
+            for (std::uint64_t i = 0; i != count; i += 2)
+            {
+                gid_type const id(k + 1, i + 1);
+                HPX_TEST(sns.unbind(prefix + std::to_string(i)) == id);
+            }
+            HPX_TEST_EQ(sns.iterate(prefix + "*").size(), count / 2);
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST_EQ(sns.iterate("*").size(), num_tasks * count / 2);
+}
+
+int main()
+{
+    test_bind_resolve_iterate();
+    test_concurrent_bind_unbind();
+
+    return hpx::util::report_errors();
+}
+#endif
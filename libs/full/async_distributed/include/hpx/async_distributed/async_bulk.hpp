@@ -0,0 +1,436 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file async_bulk.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/datastructures/tuple.hpp>
+#include <hpx/errors/throw_exception.hpp>
+#include <hpx/execution/executors/execution.hpp>
+#include <hpx/executors/parallel_executor.hpp>
+#include <hpx/functional/traits/is_action.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/futures/traits/promise_local_result.hpp>
+#include <hpx/iterator_support/counting_shape.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/preprocessor/cat.hpp>
+#include <hpx/preprocessor/expand.hpp>
+#include <hpx/preprocessor/nargs.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/type_support/pack.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx {
+
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The invocations targeting objects residing on the same locality,
+        // indices_ refers to the positions of the ids (and arguments) in the
+        // sequences passed to async_bulk.
+        struct async_bulk_partition
+        {
+            std::uint32_t locality_id_;
+            std::vector<std::size_t> indices_;
+        };
+
+        // Group the given ids by the locality they (most likely) reside on,
+        // this relies on the local AGAS cache only. Ids for which the cache
+        // gives no answer are attributed to the locality that created them.
+        HPX_EXPORT std::vector<async_bulk_partition>
+        partition_by_locality(std::vector<hpx::id_type> const& ids);
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename Action>
+        struct async_bulk_result
+        {
+            using action_result =
+                typename traits::promise_local_result<typename hpx::traits::
+                        extract_action<Action>::remote_result_type>::type;
+
+            using type = std::conditional_t<std::is_void_v<action_result>,
+                void, std::vector<action_result>>;
+        };
+
+        template <typename Action>
+        using async_bulk_result_t = typename async_bulk_result<Action>::type;
+
+        template <typename Action>
+        using async_bulk_arguments_t =
+            typename hpx::traits::extract_action<Action>::type::arguments_type;
+
+        ///////////////////////////////////////////////////////////////////////
+        // Invoke the action on one object. This runs on a thread created by
+        // the bulk executor already, thus local objects are invoked inline.
+        // Objects which were migrated away in the meantime are reached
+        // through the usual forwarding.
+        template <typename Action, typename Args, std::size_t... Is>
+        decltype(auto) async_bulk_invoke(hpx::id_type const& id,
+            Args const& args, util::index_pack<Is...>)
+        {
+            return hpx::async<Action>(
+                hpx::launch::sync, id, hpx::get<Is>(args)...)
+                .get();
+        }
+
+        template <typename Action>
+        decltype(auto) async_bulk_invoke(
+            hpx::id_type const& id, async_bulk_arguments_t<Action> const& args)
+        {
+            return async_bulk_invoke<Action>(id, args,
+                util::make_index_pack_t<
+                    hpx::tuple_size<async_bulk_arguments_t<Action>>::value>());
+        }
+
+        // Combine the futures representing the invocations performed on one
+        // locality into a single future.
+        template <typename Result>
+        hpx::future<std::vector<Result>> async_bulk_combine(
+            std::vector<hpx::future<Result>>&& futures)
+        {
+            return hpx::when_all(HPX_MOVE(futures))
+                .then(hpx::launch::sync,
+                    [](hpx::future<std::vector<hpx::future<Result>>>&& f) {
+                        std::vector<hpx::future<Result>> futures = f.get();
+
+                        std::vector<Result> results;
+                        results.reserve(futures.size());
+                        for (hpx::future<Result>& f : futures)
+                        {
+                            results.push_back(f.get());
+                        }
+                        return results;
+                    });
+        }
+
+        inline hpx::future<void> async_bulk_combine(
+            std::vector<hpx::future<void>>&& futures)
+        {
+            return hpx::when_all(HPX_MOVE(futures))
+                .then(hpx::launch::sync,
+                    [](hpx::future<std::vector<hpx::future<void>>>&& f) {
+                        for (hpx::future<void>& f : f.get())
+                        {
+                            f.get();    // propagate exceptions
+                        }
+                    });
+        }
+
+        // the bulk executor returns a single future for void functions
+        inline hpx::future<void> async_bulk_combine(hpx::future<void>&& f)
+        {
+            return HPX_MOVE(f);
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Executed on the locality the objects reside on. The invocations are
+        // scheduled using the bulk executor, which spawns the threads
+        // hierarchically and doesn't involve any parcels.
+        template <typename Action>
+        struct async_bulk_invoker
+        {
+            using result_type = hpx::future<async_bulk_result_t<Action>>;
+            using arguments_type = async_bulk_arguments_t<Action>;
+
+            // the same arguments are used for all invocations
+            static result_type call_shared(
+                std::vector<hpx::id_type> const& ids,
+                arguments_type const& args)
+            {
+                hpx::execution::parallel_executor exec;
+                return async_bulk_combine(
+                    hpx::parallel::execution::bulk_async_execute(
+                        exec,
+                        [](hpx::id_type const& id,
+                            arguments_type const& args) -> decltype(auto) {
+                            return async_bulk_invoke<Action>(id, args);
+                        },
+                        ids, args));
+            }
+
+            // each invocation uses its own set of arguments
+            static result_type call(std::vector<hpx::id_type> ids,
+                std::vector<arguments_type> args)
+            {
+                HPX_ASSERT(ids.size() == args.size());
+
+                // the invocations may outlive this call, they share the ids
+                // and the arguments
+                std::size_t const count = ids.size();
+                auto data = std::make_shared<std::pair<
+                    std::vector<hpx::id_type>, std::vector<arguments_type>>>(
+                    HPX_MOVE(ids), HPX_MOVE(args));
+
+                hpx::execution::parallel_executor exec;
+                return async_bulk_combine(
+                    hpx::parallel::execution::bulk_async_execute(
+                        exec,
+                        [data = HPX_MOVE(data)](
+                            std::size_t i) -> decltype(auto) {
+                            return async_bulk_invoke<Action>(
+                                data->first[i], data->second[i]);
+                        },
+                        hpx::util::detail::make_counting_shape(count)));
+            }
+        };
+
+        template <typename Action>
+        struct async_bulk_shared_action
+          : ::hpx::actions::action<
+                typename async_bulk_invoker<Action>::result_type (*)(
+                    std::vector<hpx::id_type> const&,
+                    async_bulk_arguments_t<Action> const&),
+                &async_bulk_invoker<Action>::call_shared,
+                async_bulk_shared_action<Action>>
+        {
+        };
+
+        template <typename Action>
+        struct async_bulk_action
+          : ::hpx::actions::action<
+                typename async_bulk_invoker<Action>::result_type (*)(
+                    std::vector<hpx::id_type>,
+                    std::vector<async_bulk_arguments_t<Action>>),
+                &async_bulk_invoker<Action>::call,
+                async_bulk_action<Action>>
+        {
+        };
+
+        ///////////////////////////////////////////////////////////////////////
+        template <typename T>
+        std::vector<T> async_bulk_select(std::vector<T> const& values,
+            std::vector<std::size_t> const& indices)
+        {
+            std::vector<T> result;
+            result.reserve(indices.size());
+            for (std::size_t i : indices)
+            {
+                result.push_back(values[i]);
+            }
+            return result;
+        }
+
+        // Send one parcel per locality, Invoke(locality, partition, ids)
+        // returns the future representing all invocations on that locality.
+        template <typename Action, typename Invoke>
+        hpx::future<async_bulk_result_t<Action>> async_bulk_dispatch(
+            std::vector<hpx::id_type> const& ids, Invoke&& invoke)
+        {
+            using result_type = async_bulk_result_t<Action>;
+
+            std::vector<async_bulk_partition> partitions =
+                partition_by_locality(ids);
+
+            std::vector<hpx::future<result_type>> futures;
+            futures.reserve(partitions.size());
+
+            for (async_bulk_partition const& p : partitions)
+            {
+                futures.push_back(
+                    invoke(p, async_bulk_select(ids, p.indices_)));
+            }
+
+            if constexpr (std::is_void_v<result_type>)
+            {
+                return async_bulk_combine(HPX_MOVE(futures));
+            }
+            else
+            {
+                std::size_t const count = ids.size();
+
+                // scatter the results received from the localities back into
+                // the order of the given ids
+                return hpx::when_all(HPX_MOVE(futures))
+                    .then(hpx::launch::sync,
+                        [count, partitions = HPX_MOVE(partitions)](
+                            hpx::future<std::vector<hpx::future<result_type>>>&&
+                                f) {
+                            std::vector<hpx::future<result_type>> futures =
+                                f.get();
+
+                            // remember where the result for each of the
+                            // ids is found
+                            std::vector<result_type> values;
+                            values.reserve(futures.size());
+                            std::vector<std::pair<std::size_t, std::size_t>>
+                                positions(count);
+                            for (std::size_t i = 0; i != futures.size(); ++i)
+                            {
+                                values.push_back(futures[i].get());
+                                std::vector<std::size_t> const& indices =
+                                    partitions[i].indices_;
+
+                                HPX_ASSERT(
+                                    values.back().size() == indices.size());
+                                for (std::size_t j = 0; j != indices.size();
+                                     ++j)
+                                {
+                                    positions[indices[j]] =
+                                        std::make_pair(i, j);
+                                }
+                            }
+
+                            // the results don't have to be default
+                            // constructible
+                            result_type results;
+                            results.reserve(count);
+                            for (auto const& p : positions)
+                            {
+                                results.emplace_back(
+                                    HPX_MOVE(values[p.first][p.second]));
+                            }
+                            return results;
+                        });
+            }
+        }
+
+        template <typename Action, typename... Ts>
+        inline constexpr bool is_async_bulk_arguments_range_v = false;
+
+        template <typename Action, typename T>
+        inline constexpr bool is_async_bulk_arguments_range_v<Action, T> =
+            std::is_same_v<std::decay_t<T>,
+                std::vector<async_bulk_arguments_t<Action>>>;
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// \brief Invoke the given action on all of the given objects, passing
+    ///        the same arguments to each of the invocations.
+    ///
+    /// The ids are grouped by the locality the referenced objects reside on
+    /// (as known to the local AGAS cache). Only one parcel is sent to each of
+    /// the involved localities, it carries the ids of all objects residing
+    /// there; the invocations themselves are scheduled on the target
+    /// locality.
+    ///
+    /// \param ids  The ids of the objects to invoke the action on.
+    /// \param vs   The arguments to pass to each invocation of the action.
+    ///
+    /// \returns A future that becomes ready once all invocations have
+    ///          finished. It holds the results of the invocations in the
+    ///          order of the given ids (if the action returns a value).
+    template <typename Action, typename... Ts>
+    std::enable_if_t<hpx::traits::is_action_v<Action> &&
+            !detail::is_async_bulk_arguments_range_v<Action, Ts...>,
+        hpx::future<detail::async_bulk_result_t<Action>>>
+    async_bulk(std::vector<hpx::id_type> const& ids, Ts&&... vs)
+    {
+        using arguments_type = detail::async_bulk_arguments_t<Action>;
+        using invoker_type = detail::async_bulk_invoker<Action>;
+
+        arguments_type args(HPX_FORWARD(Ts, vs)...);
+        return detail::async_bulk_dispatch<Action>(ids,
+            [&](detail::async_bulk_partition const& p,
+                std::vector<hpx::id_type>&& local_ids) ->
+            typename invoker_type::result_type {
+                if (p.locality_id_ == hpx::get_locality_id())
+                {
+                    return invoker_type::call_shared(local_ids, args);
+                }
+                return hpx::async<detail::async_bulk_shared_action<Action>>(
+                    naming::get_id_from_locality_id(p.locality_id_),
+                    HPX_MOVE(local_ids), args);
+            });
+    }
+
+    /// \brief Invoke the given action on all of the given objects, passing
+    ///        a different set of arguments to each of the invocations.
+    ///
+    /// \param ids  The ids of the objects to invoke the action on.
+    /// \param args The arguments to pass to the invocation of the action on
+    ///             the object with the corresponding id, must have the same
+    ///             size as \a ids.
+    ///
+    /// \returns A future that becomes ready once all invocations have
+    ///          finished. It holds the results of the invocations in the
+    ///          order of the given ids (if the action returns a value).
+    template <typename Action>
+    std::enable_if_t<hpx::traits::is_action_v<Action>,
+        hpx::future<detail::async_bulk_result_t<Action>>>
+    async_bulk(std::vector<hpx::id_type> const& ids,
+        std::vector<detail::async_bulk_arguments_t<Action>> const& args)
+    {
+        using invoker_type = detail::async_bulk_invoker<Action>;
+
+        if (ids.size() != args.size())
+        {
+            HPX_THROW_EXCEPTION(hpx::bad_parameter, "hpx::async_bulk",
+                "the number of arguments ({}) doesn't match the number of "
+                "ids ({})",
+                args.size(), ids.size());
+        }
+
+        return detail::async_bulk_dispatch<Action>(ids,
+            [&](detail::async_bulk_partition const& p,
+                std::vector<hpx::id_type>&& local_ids) ->
+            typename invoker_type::result_type {
+                auto local_args = detail::async_bulk_select(args, p.indices_);
+                if (p.locality_id_ == hpx::get_locality_id())
+                {
+                    return invoker_type::call(
+                        HPX_MOVE(local_ids), HPX_MOVE(local_args));
+                }
+                return hpx::async<detail::async_bulk_action<Action>>(
+                    naming::get_id_from_locality_id(p.locality_id_),
+                    HPX_MOVE(local_ids), HPX_MOVE(local_args));
+            });
+    }
+}    // namespace hpx
+
+///////////////////////////////////////////////////////////////////////////////
+// Register the actions sending the invocations of the given action to the
+// localities the objects reside on
+#define HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION(...)                        \
+    HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION_(__VA_ARGS__)                   \
+/**/
+#define HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION_(...)                       \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION_,      \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION_1(Action)                   \
+    HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION_2(Action, Action)               \
+/**/
+#define HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION_2(Action, Name)             \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        ::hpx::detail::async_bulk_action<Action>,                              \
+        HPX_PP_CAT(async_bulk_, Name))                                         \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        ::hpx::detail::async_bulk_shared_action<Action>,                       \
+        HPX_PP_CAT(async_bulk_shared_, Name))                                  \
+/**/
+
+///////////////////////////////////////////////////////////////////////////////
+#define HPX_REGISTER_ASYNC_BULK_ACTION(...)                                    \
+    HPX_REGISTER_ASYNC_BULK_ACTION_(__VA_ARGS__)                               \
+/**/
+#define HPX_REGISTER_ASYNC_BULK_ACTION_(...)                                   \
+    HPX_PP_EXPAND(HPX_PP_CAT(HPX_REGISTER_ASYNC_BULK_ACTION_,                  \
+        HPX_PP_NARGS(__VA_ARGS__))(__VA_ARGS__))                               \
+    /**/
+
+#define HPX_REGISTER_ASYNC_BULK_ACTION_1(Action)                               \
+    HPX_REGISTER_ASYNC_BULK_ACTION_2(Action, Action)                           \
+/**/
+#define HPX_REGISTER_ASYNC_BULK_ACTION_2(Action, Name)                         \
+    HPX_REGISTER_ACTION(::hpx::detail::async_bulk_action<Action>,              \
+        HPX_PP_CAT(async_bulk_, Name))                                         \
+    HPX_REGISTER_ACTION(::hpx::detail::async_bulk_shared_action<Action>,       \
+        HPX_PP_CAT(async_bulk_shared_, Name))                                  \
+/**/
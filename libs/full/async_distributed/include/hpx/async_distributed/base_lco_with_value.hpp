@@ -12,6 +12,7 @@
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/async_distributed/base_lco.hpp>
+#include <hpx/async_distributed/detail/response_table.hpp>
 #include <hpx/async_distributed/lcos_fwd.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -324,6 +325,12 @@ namespace hpx { namespace components { namespace detail {
     typedef ::hpx::lcos::base_lco_with_value<Value, RemoteValue,               \
         ::hpx::traits::detail::Tag>                                            \
         HPX_PP_CAT(HPX_PP_CAT(base_lco_with_value_, Name), Tag);               \
+    typedef ::hpx::lcos::detail::set_response_value_action<Value, RemoteValue, \
+        ::hpx::traits::detail::Tag>                                            \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag);         \
+    HPX_REGISTER_ACTION_DECLARATION(                                           \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag),         \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag))         \
     HPX_REGISTER_ACTION_DECLARATION(                                           \
         HPX_PP_CAT(                                                            \
             HPX_PP_CAT(base_lco_with_value_, Name), Tag)::set_value_action,    \
@@ -366,6 +373,12 @@ namespace hpx { namespace components { namespace detail {
     typedef ::hpx::lcos::base_lco_with_value<Value, RemoteValue,               \
         ::hpx::traits::detail::Tag>                                            \
         HPX_PP_CAT(HPX_PP_CAT(base_lco_with_value_, Name), Tag);               \
+    typedef ::hpx::lcos::detail::set_response_value_action<Value, RemoteValue, \
+        ::hpx::traits::detail::Tag>                                            \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag);         \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag),         \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag))         \
     HPX_REGISTER_ACTION(HPX_PP_CAT(HPX_PP_CAT(base_lco_with_value_, Name),     \
                             Tag)::set_value_action,                            \
         HPX_PP_CAT(HPX_PP_CAT(set_value_action_, Name), Tag))                  \
@@ -411,6 +424,12 @@ namespace hpx { namespace components { namespace detail {
     typedef ::hpx::lcos::base_lco_with_value<Value, RemoteValue,               \
         ::hpx::traits::detail::Tag>                                            \
         HPX_PP_CAT(HPX_PP_CAT(base_lco_with_value_, Name), Tag);               \
+    typedef ::hpx::lcos::detail::set_response_value_action<Value, RemoteValue, \
+        ::hpx::traits::detail::Tag>                                            \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag);         \
+    HPX_REGISTER_ACTION(                                                       \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag),         \
+        HPX_PP_CAT(HPX_PP_CAT(set_response_value_action_, Name), Tag))         \
     HPX_REGISTER_ACTION_ID(HPX_PP_CAT(HPX_PP_CAT(base_lco_with_value_, Name),  \
                                Tag)::set_value_action,                         \
         HPX_PP_CAT(HPX_PP_CAT(set_value_action_, Name), Tag), ActionIdSet)     \
@@ -455,3 +474,9 @@ HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(hpx::util::section, hpx_section)
 HPX_REGISTER_BASE_LCO_WITH_VALUE_DECLARATION(std::string, std_string)
 #endif
+
+///////////////////////////////////////////////////////////////////////////////
+// The values are delivered to response slots by the actions registered along
+// with the LCOs above, errors are delivered by this one
+HPX_REGISTER_ACTION_DECLARATION(
+    hpx::lcos::detail::set_response_error_action, set_response_error_action)
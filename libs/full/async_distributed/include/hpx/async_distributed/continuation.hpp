@@ -25,6 +25,7 @@
 #include <hpx/serialization/base_object.hpp>
 #include <hpx/serialization/serialize.hpp>
 
+#include <cstdint>
 #include <exception>
 #include <type_traits>
 #include <utility>
@@ -50,6 +51,10 @@ namespace hpx { namespace actions {
         continuation(hpx::id_type const& id, naming::address&& addr);
         continuation(hpx::id_type&& id, naming::address&& addr) noexcept;
 
+        // The result is delivered to the given response slot, get_id()
+        // refers to the locality the slot was registered on.
+        explicit continuation(response_slot const& slot) noexcept;
+
         continuation(continuation&& o) noexcept;
         continuation& operator=(continuation&& o) noexcept;
 
@@ -71,9 +76,15 @@ namespace hpx { namespace actions {
             return addr_;
         }
 
+        constexpr bool has_response_slot() const noexcept
+        {
+            return response_slot_ != 0;
+        }
+
     protected:
         hpx::id_type id_;
         naming::address addr_;
+        std::uint64_t response_slot_ = 0;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -99,6 +110,11 @@ namespace hpx { namespace actions {
         {
         }
 
+        explicit typed_continuation(response_slot const& slot) noexcept
+          : continuation(slot)
+        {
+        }
+
         template <typename F>
         typed_continuation(hpx::id_type const& id, F&& f)
           : continuation(id)
@@ -139,8 +155,11 @@ namespace hpx { namespace actions {
         }
 
         template <typename F,
-            typename Enable = typename std::enable_if<!std::is_same<
-                typename std::decay<F>::type, typed_continuation>::value>::type>
+            typename Enable = typename std::enable_if<
+                !std::is_same<typename std::decay<F>::type,
+                    typed_continuation>::value &&
+                !std::is_same<typename std::decay<F>::type,
+                    response_slot>::value>::type>
         explicit typed_continuation(F&& f)
           : f_(HPX_FORWARD(F, f))
         {
@@ -156,6 +175,12 @@ namespace hpx { namespace actions {
 
             if (f_.empty())
             {
+                if (this->has_response_slot())
+                {
+                    hpx::set_response_value(
+                        this->get_id(), this->response_slot_, HPX_MOVE(result));
+                    return;
+                }
                 if (!this->get_id())
                 {
                     HPX_THROW_EXCEPTION(invalid_status,
@@ -216,6 +241,11 @@ namespace hpx { namespace actions {
         {
         }
 
+        explicit typed_continuation(response_slot const& slot) noexcept
+          : base_type(slot)
+        {
+        }
+
         template <typename F>
         typed_continuation(hpx::id_type const& id, F&& f)
           : base_type(id, HPX_FORWARD(F, f))
@@ -252,8 +282,11 @@ namespace hpx { namespace actions {
         }
 
         template <typename F,
-            typename Enable = typename std::enable_if<!std::is_same<
-                typename std::decay<F>::type, typed_continuation>::value>::type>
+            typename Enable = typename std::enable_if<
+                !std::is_same<typename std::decay<F>::type,
+                    typed_continuation>::value &&
+                !std::is_same<typename std::decay<F>::type,
+                    response_slot>::value>::type>
         explicit typed_continuation(F&& f)
           : base_type(HPX_FORWARD(F, f))
         {
@@ -270,6 +303,12 @@ namespace hpx { namespace actions {
 
             if (this->f_.empty())
             {
+                if (this->has_response_slot())
+                {
+                    hpx::set_response_value(
+                        this->get_id(), this->response_slot_, HPX_MOVE(result));
+                    return;
+                }
                 if (!this->get_id())
                 {
                     HPX_THROW_EXCEPTION(invalid_status,
@@ -324,6 +363,11 @@ namespace hpx { namespace actions {
         {
         }
 
+        explicit typed_continuation(response_slot const& slot) noexcept
+          : continuation(slot)
+        {
+        }
+
         template <typename F>
         typed_continuation(hpx::id_type const& id, F&& f)
           : continuation(id)
@@ -364,8 +408,11 @@ namespace hpx { namespace actions {
         }
 
         template <typename F,
-            typename Enable = typename std::enable_if<!std::is_same<
-                typename std::decay<F>::type, typed_continuation>::value>::type>
+            typename Enable = typename std::enable_if<
+                !std::is_same<typename std::decay<F>::type,
+                    typed_continuation>::value &&
+                !std::is_same<typename std::decay<F>::type,
+                    response_slot>::value>::type>
         explicit typed_continuation(F&& f)
           : f_(HPX_FORWARD(F, f))
         {
@@ -9,10 +9,20 @@
 #include <hpx/config.hpp>
 #include <hpx/actions_base/traits/action_continuation.hpp>
 
+#include <cstdint>
+
 namespace hpx { namespace actions {
 
     class HPX_EXPORT continuation;
 
+    // Refers to the response slot (see lcos::detail::response_table) on the
+    // locality a result has to be delivered to.
+    struct response_slot
+    {
+        std::uint32_t locality_id_;
+        std::uint64_t slot_;
+    };
+
     template <typename Result, typename RemoteResult, typename F,
         typename... Ts>
     void trigger(
@@ -217,6 +217,30 @@ namespace hpx { namespace detail {
         }
     };
 
+    ///////////////////////////////////////////////////////////////////////////
+    // Remote invocations deliver their result to a response slot instead of
+    // a promise LCO. Direct actions targeting a local object are still
+    // handled by packaged_action as those are executed in place.
+    template <typename Action, typename Result, typename... Ts>
+    hpx::future<Result> async_remote_invoke(
+        hpx::id_type const& id, naming::address&& addr, Ts&&... vs)
+    {
+        if (Action::direct_execution::value && addr &&
+            naming::get_locality_id_from_gid(addr.locality_) ==
+                agas::get_locality_id())
+        {
+            lcos::packaged_action<Action, Result> p;
+            hpx::future<Result> f = p.get_future();
+            p.apply(HPX_MOVE(addr), id, HPX_FORWARD(Ts, vs)...);
+            return f;
+        }
+
+        lcos::detail::response_action<Action, Result> p;
+        hpx::future<Result> f = p.get_future();
+        p.apply(HPX_MOVE(addr), id, HPX_FORWARD(Ts, vs)...);
+        return f;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Action, typename... Ts>
     hpx::future<
@@ -230,9 +254,8 @@ namespace hpx { namespace detail {
         future<result_type> f;
         {
             handle_managed_target<result_type> hmt(id, f);
-            lcos::packaged_action<action_type, result_type> p;
-            f = p.get_future();
-            p.apply(HPX_MOVE(addr), hmt.get_id(), HPX_FORWARD(Ts, vs)...);
+            f = async_remote_invoke<action_type, result_type>(
+                hmt.get_id(), HPX_MOVE(addr), HPX_FORWARD(Ts, vs)...);
             f.wait();
         }
         return f;
@@ -250,9 +273,8 @@ namespace hpx { namespace detail {
         hpx::future<result_type> f;
         {
             handle_managed_target<result_type> hmt(id, f);
-            lcos::packaged_action<action_type, result_type> p;
-            f = p.get_future();
-            p.apply(HPX_MOVE(addr), hmt.get_id(), HPX_FORWARD(Ts, vs)...);
+            f = async_remote_invoke<action_type, result_type>(
+                hmt.get_id(), HPX_MOVE(addr), HPX_FORWARD(Ts, vs)...);
         }
         return f;
     }
@@ -0,0 +1,103 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/basic_action.hpp>
+#include <hpx/actions_base/plain_action.hpp>
+#include <hpx/components_base/traits/is_component.hpp>
+#include <hpx/futures/detail/future_data.hpp>
+#include <hpx/modules/memory.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <utility>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The shared states of the futures waiting for the results of remote
+    // action invocations are registered with this table. The returned slot
+    // (together with the id of this locality) is sent along with the action
+    // instead of the id of a promise LCO, the result is delivered by referring
+    // to the slot. This neither requires creating a component nor assigning
+    // a global id to it.
+    //
+    // A slot is released as soon as a value or an error is set. Slots are
+    // reused, each slot carries a generation count which prevents stale
+    // responses from being delivered to an unrelated shared state.
+    class HPX_EXPORT response_table
+    {
+    public:
+        using shared_state_type =
+            future_data_base<traits::detail::future_data_void>;
+        using set_value_function_type = void (*)(shared_state_type*, void*);
+
+        // Register the given shared state, f is used to store the (type
+        // erased) value of the response. The returned slot is never zero.
+        static std::uint64_t add(hpx::intrusive_ptr<shared_state_type> state,
+            set_value_function_type f);
+
+        // Deliver the value or the error to the shared state registered for
+        // the given slot and release the slot. Both return false if the slot
+        // has been released already.
+        static bool set_value(std::uint64_t slot, void* value);
+        static bool set_exception(
+            std::uint64_t slot, std::exception_ptr const& e);
+
+        // Return the number of slots currently in use.
+        static std::size_t size();
+    };
+
+    template <typename Result, typename RemoteResult>
+    void set_response_value(
+        response_table::shared_state_type* state, void* value)
+    {
+        static_cast<future_data<Result>*>(state)->set_remote_data(
+            HPX_MOVE(*static_cast<RemoteResult*>(value)));
+    }
+
+    template <typename Result, typename RemoteResult>
+    std::uint64_t add_response(
+        hpx::intrusive_ptr<future_data<Result>> const& state)
+    {
+        return response_table::add(
+            state.get(), &set_response_value<Result, RemoteResult>);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The actions delivering the response to the locality the remote action
+    // was invoked from.
+    template <typename RemoteResult>
+    void set_response_value_remote(std::uint64_t slot, RemoteResult&& value)
+    {
+        response_table::set_value(slot, &value);
+    }
+
+    // The action is parameterized on the same types as the corresponding
+    // base_lco_with_value, it is registered together with the actions of
+    // the LCO by HPX_REGISTER_BASE_LCO_WITH_VALUE.
+    template <typename Result, typename RemoteResult,
+        typename ComponentTag = traits::detail::managed_component_tag>
+    struct set_response_value_action
+      : hpx::actions::make_direct_action_t<void (*)(std::uint64_t,
+                                               RemoteResult&&),
+            &set_response_value_remote<RemoteResult>,
+            set_response_value_action<Result, RemoteResult, ComponentTag>>
+    {
+    };
+
+    HPX_EXPORT void set_response_error_remote(
+        std::uint64_t slot, std::exception_ptr const& e);
+
+    struct set_response_error_action
+      : hpx::actions::make_direct_action_t<decltype(&set_response_error_remote),
+            &set_response_error_remote, set_response_error_action>
+    {
+    };
+}}}    // namespace hpx::lcos::detail
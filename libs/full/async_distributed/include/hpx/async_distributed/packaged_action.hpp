@@ -15,10 +15,13 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_distributed/applier/apply.hpp>
 #include <hpx/async_distributed/applier/apply_callback.hpp>
+#include <hpx/async_distributed/detail/response_table.hpp>
 #include <hpx/async_distributed/promise.hpp>
 #include <hpx/components_base/component_type.hpp>
 #include <hpx/components_base/traits/component_supports_migration.hpp>
 #include <hpx/components_base/traits/component_type_is_compatible.hpp>
+#include <hpx/futures/detail/future_data.hpp>
+#include <hpx/futures/traits/future_access.hpp>
 #include <hpx/memory/intrusive_ptr.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/memory.hpp>
@@ -27,6 +30,7 @@
 #include <asio/error.hpp>
 #endif
 
+#include <cstdint>
 #include <exception>
 #include <memory>
 #include <system_error>
@@ -94,6 +98,127 @@ namespace hpx { namespace lcos {
     }    // namespace detail
 #endif
 
+    namespace detail {
+
+#if defined(HPX_HAVE_NETWORKING)
+        struct response_write_handler
+        {
+            std::uint64_t slot;
+
+            void operator()(
+                std::error_code const& ec, parcelset::parcel const& p)
+            {
+                // any error in the parcel layer will be stored in the future
+                // object (if the response has not been received yet)
+                if (ec)
+                {
+                    if (hpx::tolerate_node_faults())
+                    {
+                        if (ec ==
+                            asio::error::make_error_code(
+                                asio::error::connection_reset))
+                        {
+                            return;
+                        }
+                    }
+                    std::exception_ptr exception = HPX_GET_EXCEPTION(ec,
+                        "response_action::response_write_handler",
+                        parcelset::dump_parcel(p));
+                    response_table::set_exception(slot, exception);
+                }
+            }
+        };
+#endif
+
+        ///////////////////////////////////////////////////////////////////////
+        // A response_action invokes a (remote) action, the result is sent
+        // back directly to the shared state of the future returned from
+        // get_future(). Contrary to packaged_action, no promise LCO is
+        // created, the continuation refers to a slot in the response_table
+        // of this locality instead, which avoids allocating a component and
+        // assigning a global id to it for each invocation.
+        template <typename Action, typename Result>
+        class response_action
+        {
+            using action_type =
+                typename hpx::traits::extract_action<Action>::type;
+            using remote_result_type =
+                typename action_type::remote_result_type;
+
+            using allocator_type = hpx::util::internal_allocator<>;
+            using shared_state_type = traits::shared_state_allocator_t<
+                lcos::detail::future_data<Result>, allocator_type>;
+            using other_allocator = typename std::allocator_traits<
+                allocator_type>::template rebind_alloc<shared_state_type>;
+            using allocator_traits = std::allocator_traits<other_allocator>;
+
+        public:
+            response_action()
+            {
+                other_allocator alloc{allocator_type{}};
+                shared_state_type* p = allocator_traits::allocate(alloc, 1);
+                allocator_traits::construct(alloc, p,
+                    typename shared_state_type::init_no_addref{}, alloc);
+
+                shared_state_.reset(p, false);
+            }
+
+            hpx::future<Result> get_future()
+            {
+                return hpx::traits::future_access<hpx::future<Result>>::create(
+                    shared_state_);
+            }
+
+            template <typename... Ts>
+            void apply(naming::address&& addr, hpx::id_type const& id,
+                Ts&&... vs)
+            {
+                LLCO_(info).format("response_action::apply({}, {}) args({})",
+                    hpx::actions::detail::get_action_name<action_type>(), id,
+                    sizeof...(Ts));
+
+                std::uint64_t slot =
+                    add_response<Result, remote_result_type>(shared_state_);
+
+#if defined(HPX_HAVE_NETWORKING)
+                auto&& f = response_write_handler{slot};
+#else
+                auto&& f = []() {};
+#endif
+                actions::typed_continuation<Result, remote_result_type> cont(
+                    actions::response_slot{agas::get_locality_id(), slot});
+
+                try
+                {
+                    if (addr)
+                    {
+                        hpx::apply_p_cb<action_type>(HPX_MOVE(cont),
+                            HPX_MOVE(addr), id,
+                            actions::action_priority<action_type>(),
+                            HPX_MOVE(f), HPX_FORWARD(Ts, vs)...);
+                    }
+                    else
+                    {
+                        hpx::apply_p_cb<action_type>(HPX_MOVE(cont), id,
+                            actions::action_priority<action_type>(),
+                            HPX_MOVE(f), HPX_FORWARD(Ts, vs)...);
+                    }
+                }
+                catch (...)
+                {
+                    // release the slot
+                    response_table::set_exception(
+                        slot, std::current_exception());
+                    throw;
+                }
+            }
+
+        private:
+            hpx::intrusive_ptr<lcos::detail::future_data<Result>>
+                shared_state_;
+        };
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     /// A packaged_action can be used by a single \a thread to invoke a
     /// (remote) action and wait for the result. The result is expected to be
@@ -199,9 +199,21 @@ namespace hpx { namespace actions {
         data.timer_data = hpx::util::external_timer::new_task(
             data.description, data.parent_locality_id, data.parent_id);
 #endif
-        applier::detail::apply_helper<typename base_type::derived_type>::call(
-            HPX_MOVE(data), HPX_MOVE(cont_), target, lva, comptype,
-            this->priority_, HPX_MOVE(hpx::get<Is>(this->arguments_))...);
+        if constexpr (base_type::adaptive_execution::value)
+        {
+            using helper_type = applier::detail::adaptive_apply_helper<
+                typename base_type::derived_type>;
+            helper_type::call(this->adaptive_execution_data_, HPX_MOVE(data),
+                HPX_MOVE(cont_), target, lva, comptype, this->priority_,
+                HPX_MOVE(hpx::get<Is>(this->arguments_))...);
+        }
+        else
+        {
+            applier::detail::apply_helper<typename base_type::derived_type>::
+                call(HPX_MOVE(data), HPX_MOVE(cont_), target, lva, comptype,
+                    this->priority_,
+                    HPX_MOVE(hpx::get<Is>(this->arguments_))...);
+        }
     }
 
     template <typename Action>
@@ -243,9 +255,10 @@ namespace hpx { namespace actions {
 
         if (deferred_schedule)
         {
-            // If this is a direct action and deferred schedule was requested,
-            // that is we are not the last parcel, return immediately
-            if (base_type::direct_execution::value)
+            // If this is a direct action (or an action which will be executed
+            // directly) and deferred schedule was requested, that is we are
+            // not the last parcel, return immediately
+            if (base_type::executes_directly())
             {
                 return;
             }
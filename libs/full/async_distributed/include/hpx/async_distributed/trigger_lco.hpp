@@ -14,6 +14,7 @@
 #include <hpx/assert.hpp>
 #include <hpx/async_distributed/applier/detail/apply_implementations_fwd.hpp>
 #include <hpx/async_distributed/continuation_fwd.hpp>
+#include <hpx/async_distributed/detail/response_table.hpp>
 #include <hpx/async_distributed/lcos_fwd.hpp>
 #include <hpx/async_distributed/trigger_lco_fwd.hpp>
 #include <hpx/components_base/component_type.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <cstdint>
 #include <exception>
 #include <type_traits>
 #include <utility>
@@ -255,6 +257,34 @@ namespace hpx {
 #endif
     }
     /// \endcond
+    template <typename Result>
+    void set_response_value(
+        hpx::id_type const& locality, std::uint64_t slot, Result&& t)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        typedef typename std::decay<Result>::type remote_result_type;
+        typedef typename traits::promise_local_result<remote_result_type>::type
+            local_result_type;
+
+        // use the action registered along with the corresponding LCO
+        typedef lcos::detail::set_response_value_action<
+            std::conditional_t<std::is_void_v<local_result_type>,
+                util::unused_type, local_result_type>,
+            remote_result_type>
+            set_value_action;
+
+        naming::address addr(
+            locality.get_gid(), components::component_plain_function);
+        detail::apply_impl<set_value_action>(locality, HPX_MOVE(addr),
+            actions::action_priority<set_value_action>(), slot,
+            detail::make_rvalue<Result>(t));
+#else
+        HPX_UNUSED(locality);
+        HPX_UNUSED(slot);
+        HPX_UNUSED(t);
+        HPX_ASSERT(false);
+#endif
+    }
 }    // namespace hpx
 
 #include <hpx/async_distributed/applier/apply.hpp>
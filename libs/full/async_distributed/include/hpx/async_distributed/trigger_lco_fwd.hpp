@@ -14,6 +14,7 @@
 #include <hpx/naming_base/address.hpp>
 #include <hpx/naming_base/id_type.hpp>
 
+#include <cstdint>
 #include <exception>
 #include <type_traits>
 #include <utility>
@@ -307,4 +308,29 @@ namespace hpx {
     {
         set_lco_error(id, naming::address(), HPX_MOVE(e), cont, move_credits);
     }
+
+    /// \brief Deliver the result value to the response slot registered on
+    ///        the given locality
+    ///
+    /// \param locality [in] This represents the locality the response slot
+    ///                  was registered on.
+    /// \param slot [in] This is the response slot which should receive the
+    ///                  given value.
+    /// \param t    [in] This is the value which should be sent to the
+    ///                  response slot.
+    template <typename Result>
+    void set_response_value(
+        hpx::id_type const& locality, std::uint64_t slot, Result&& t);
+
+    /// \brief Deliver the error to the response slot registered on the given
+    ///        locality
+    ///
+    /// \param locality [in] This represents the locality the response slot
+    ///                  was registered on.
+    /// \param slot [in] This is the response slot which should receive the
+    ///                  given error value.
+    /// \param e    [in] This is the error value which should be sent to the
+    ///                  response slot.
+    HPX_EXPORT void set_response_error(hpx::id_type const& locality,
+        std::uint64_t slot, std::exception_ptr const& e);
 }    // namespace hpx
@@ -8,6 +8,7 @@
 
 #include <hpx/async_distributed/apply.hpp>
 #include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/async_bulk.hpp>
 #include <hpx/async_distributed/async_callback.hpp>
 #include <hpx/async_distributed/async_continue.hpp>
 #include <hpx/async_distributed/async_continue_callback.hpp>
@@ -0,0 +1,54 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_distributed/async_bulk.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/naming_base/address.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace detail {
+
+    std::vector<async_bulk_partition> partition_by_locality(
+        std::vector<hpx::id_type> const& ids)
+    {
+        std::map<std::uint32_t, std::vector<std::size_t>> localities;
+        for (std::size_t i = 0; i != ids.size(); ++i)
+        {
+            naming::gid_type const& gid = ids[i].get_gid();
+
+            std::uint32_t locality_id = naming::invalid_locality_id;
+
+            naming::address addr;
+            if (agas::resolve_cached(gid, addr))
+            {
+                locality_id = naming::get_locality_id_from_gid(addr.locality_);
+            }
+            else
+            {
+                locality_id = naming::get_locality_id_from_id(ids[i]);
+            }
+
+            localities[locality_id].push_back(i);
+        }
+
+        std::vector<async_bulk_partition> partitions;
+        partitions.reserve(localities.size());
+        for (auto& locality : localities)
+        {
+            partitions.push_back(async_bulk_partition{
+                locality.first, HPX_MOVE(locality.second)});
+        }
+        return partitions;
+    }
+}}    // namespace hpx::detail
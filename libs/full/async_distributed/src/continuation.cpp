@@ -9,11 +9,14 @@
 #include <hpx/actions/transfer_action.hpp>
 #include <hpx/actions_base/traits/action_priority.hpp>
 #include <hpx/actions_base/traits/extract_action.hpp>
+#include <hpx/assert.hpp>
 #include <hpx/async_distributed/continuation.hpp>
 #include <hpx/async_distributed/transfer_continuation_action.hpp>
 #include <hpx/async_distributed/trigger_lco.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/naming/credit_handling.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/unused.hpp>
 
 #include <exception>
 #include <utility>
@@ -56,6 +59,13 @@ namespace hpx { namespace actions {
     {
     }
 
+    continuation::continuation(response_slot const& slot) noexcept
+      : id_(naming::get_id_from_locality_id(slot.locality_id_))
+      , response_slot_(slot.slot_)
+    {
+        HPX_ASSERT(response_slot_ != 0);
+    }
+
     continuation::continuation(continuation&& o) noexcept = default;
 
     continuation& continuation::operator=(continuation&& o) noexcept = default;
@@ -71,6 +81,11 @@ namespace hpx { namespace actions {
         }
 
         LLCO_(info).format("continuation::trigger_error({})", id_);
+        if (has_response_slot())
+        {
+            set_response_error(id_, response_slot_, e);
+            return;
+        }
         set_lco_error(id_, this->get_addr(), e);
     }
 
@@ -84,6 +99,11 @@ namespace hpx { namespace actions {
         }
 
         LLCO_(info).format("continuation::trigger_error({})", id_);
+        if (has_response_slot())
+        {
+            set_response_error(id_, response_slot_, e);
+            return;
+        }
         set_lco_error(id_, this->get_addr(), HPX_MOVE(e));
     }
 
@@ -91,7 +111,7 @@ namespace hpx { namespace actions {
         hpx::serialization::input_archive& ar, unsigned)
     {
         // clang-format off
-        ar & id_ & addr_;
+        ar & id_ & addr_ & response_slot_;
         // clang-format on
     }
 
@@ -99,7 +119,7 @@ namespace hpx { namespace actions {
         hpx::serialization::output_archive& ar, unsigned)
     {
         // clang-format off
-        ar & id_ & addr_;
+        ar & id_ & addr_ & response_slot_;
         // clang-format on
     }
 
@@ -131,6 +151,12 @@ namespace hpx { namespace actions {
 
         if (f_.empty())
         {
+            if (has_response_slot())
+            {
+                set_response_value(
+                    this->get_id(), response_slot_, util::unused_type());
+                return;
+            }
             if (!this->get_id())
             {
                 HPX_THROW_EXCEPTION(invalid_status,
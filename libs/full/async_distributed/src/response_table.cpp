@@ -0,0 +1,220 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/actions/transfer_action.hpp>
+#include <hpx/actions_base/basic_action.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/base_lco_with_value.hpp>
+#include <hpx/async_distributed/detail/response_table.hpp>
+#include <hpx/async_distributed/transfer_continuation_action.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace lcos { namespace detail {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The slots are distributed over a number of shards to reduce
+        // contention, the shard is selected based on the worker thread
+        // registering the response. A slot consists of the shard index (lower
+        // 4 bits), the index of the entry in the shard (next 28 bits), and the
+        // generation of the entry (upper 32 bits).
+        class response_slots
+        {
+            using mutex_type = hpx::spinlock;
+            using shared_state_ptr =
+                hpx::intrusive_ptr<response_table::shared_state_type>;
+
+            struct entry
+            {
+                shared_state_ptr state_;
+                response_table::set_value_function_type f_ = nullptr;
+                std::uint32_t generation_ = 1;
+            };
+
+            struct shard
+            {
+                mutex_type mtx_;
+                std::vector<entry> entries_;
+                std::vector<std::uint32_t> free_entries_;
+                std::size_t size_ = 0;
+            };
+
+            using shard_type = hpx::util::cache_aligned_data<shard>;
+
+            static constexpr std::size_t num_shards = 16;
+            static constexpr std::size_t shard_bits = 4;
+            static constexpr std::uint64_t max_entries = 0x0fffffff;
+
+        public:
+            response_slots()
+              : shards_(new shard_type[num_shards])
+            {
+            }
+
+            static response_slots& get()
+            {
+                static response_slots slots;
+                return slots;
+            }
+
+            std::uint64_t add(shared_state_ptr&& state,
+                response_table::set_value_function_type f)
+            {
+                std::size_t const shard_index =
+                    hpx::get_worker_thread_num() % num_shards;
+
+                shard& s = shards_[shard_index].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                std::uint32_t index = 0;
+                if (!s.free_entries_.empty())
+                {
+                    index = s.free_entries_.back();
+                    s.free_entries_.pop_back();
+                }
+                else
+                {
+                    HPX_ASSERT(s.entries_.size() < max_entries);
+                    index = static_cast<std::uint32_t>(s.entries_.size());
+                    s.entries_.emplace_back();
+                }
+
+                entry& e = s.entries_[index];
+                e.state_ = HPX_MOVE(state);
+                e.f_ = f;
+                ++s.size_;
+
+                return (std::uint64_t(e.generation_) << 32) |
+                    (std::uint64_t(index) << shard_bits) | shard_index;
+            }
+
+            // release the slot, returns the registered shared state (if the
+            // slot was still in use)
+            shared_state_ptr release(std::uint64_t slot,
+                response_table::set_value_function_type& f)
+            {
+                std::size_t const shard_index = slot & (num_shards - 1);
+                std::size_t const index = (slot >> shard_bits) & max_entries;
+                std::uint32_t const generation =
+                    static_cast<std::uint32_t>(slot >> 32);
+
+                shard& s = shards_[shard_index].data_;
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                if (index >= s.entries_.size())
+                {
+                    return shared_state_ptr();
+                }
+
+                entry& e = s.entries_[index];
+                if (e.generation_ != generation || !e.state_)
+                {
+                    return shared_state_ptr();    // stale response
+                }
+
+                // the generation is never zero, which ensures a slot is
+                // never zero either
+                if (++e.generation_ == 0)
+                {
+                    e.generation_ = 1;
+                }
+
+                f = e.f_;
+                e.f_ = nullptr;
+                s.free_entries_.push_back(static_cast<std::uint32_t>(index));
+                --s.size_;
+
+                return HPX_MOVE(e.state_);
+            }
+
+            std::size_t size() const
+            {
+                std::size_t result = 0;
+                for (std::size_t i = 0; i != num_shards; ++i)
+                {
+                    shard& s = shards_[i].data_;
+                    std::lock_guard<mutex_type> l(s.mtx_);
+                    result += s.size_;
+                }
+                return result;
+            }
+
+        private:
+            std::unique_ptr<shard_type[]> shards_;
+        };
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::uint64_t response_table::add(
+        hpx::intrusive_ptr<shared_state_type> state, set_value_function_type f)
+    {
+        return response_slots::get().add(HPX_MOVE(state), f);
+    }
+
+    bool response_table::set_value(std::uint64_t slot, void* value)
+    {
+        set_value_function_type f = nullptr;
+        auto state = response_slots::get().release(slot, f);
+        if (!state)
+        {
+            LLCO_(warning).format(
+                "response_table::set_value: ignoring response for released "
+                "slot {}",
+                slot);
+            return false;
+        }
+
+        HPX_ASSERT(f != nullptr);
+        f(state.get(), value);
+        return true;
+    }
+
+    bool response_table::set_exception(
+        std::uint64_t slot, std::exception_ptr const& e)
+    {
+        set_value_function_type f = nullptr;
+        auto state = response_slots::get().release(slot, f);
+        if (!state)
+        {
+            LLCO_(warning).format(
+                "response_table::set_exception: ignoring response for "
+                "released slot {}",
+                slot);
+            return false;
+        }
+
+        state->set_exception(e);
+        return true;
+    }
+
+    std::size_t response_table::size()
+    {
+        return response_slots::get().size();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    void set_response_error_remote(
+        std::uint64_t slot, std::exception_ptr const& e)
+    {
+        response_table::set_exception(slot, e);
+    }
+}}}    // namespace hpx::lcos::detail
+
+HPX_REGISTER_ACTION_ID(hpx::lcos::detail::set_response_error_action,
+    set_response_error_action, hpx::actions::set_response_error_action_id)
@@ -16,6 +16,7 @@
 #include <hpx/async_distributed/base_lco_with_value.hpp>
 #endif
 
+#include <cstdint>
 #include <exception>
 #include <utility>
 
@@ -232,6 +233,24 @@ namespace hpx {
 #endif
     }
 
+    void set_response_error(hpx::id_type const& locality, std::uint64_t slot,
+        std::exception_ptr const& e)
+    {
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+        typedef lcos::detail::set_response_error_action set_action;
+
+        naming::address addr(
+            locality.get_gid(), components::component_plain_function);
+        detail::apply_impl<set_action>(locality, HPX_MOVE(addr),
+            actions::action_priority<set_action>(), slot, e);
+#else
+        HPX_ASSERT(false);
+        HPX_UNUSED(locality);
+        HPX_UNUSED(slot);
+        HPX_UNUSED(e);
+#endif
+    }
+
 #if defined(HPX_MSVC) && !defined(HPX_DEBUG)
     ///////////////////////////////////////////////////////////////////////////
     // Explicitly instantiate specific apply needed for set_lco_value for MSVC
@@ -0,0 +1,93 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that remote invocations of short running actions marked as
+// non-blocking are eventually executed directly.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/lcos.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+int increment(int i)
+{
+    return i + 1;
+}
+HPX_DECLARE_ACTION(increment, increment_action)
+HPX_ACTION_IS_NON_BLOCKING(increment_action)
+HPX_PLAIN_ACTION(increment, increment_action)
+
+std::int64_t get_direct_execution_count()
+{
+    return hpx::actions::transfer_base_action<
+        increment_action>::get_direct_execution_count(false);
+}
+HPX_PLAIN_ACTION(get_direct_execution_count, get_direct_execution_count_action)
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+    int increment(int i) const
+    {
+        return i + 1;
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, increment, increment_action)
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+using component_increment_action = test_server::increment_action;
+HPX_ACTION_IS_NON_BLOCKING(component_increment_action)
+HPX_REGISTER_ACTION(component_increment_action)
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        // test async (with continuation)
+        for (int i = 0; i != 1000; ++i)
+        {
+            HPX_TEST_EQ(hpx::async<increment_action>(id, i).get(), i + 1);
+        }
+
+        // test apply (without continuation)
+        for (int i = 0; i != 1000; ++i)
+        {
+            hpx::apply<increment_action>(id, i);
+        }
+
+        HPX_TEST_NEQ(get_direct_execution_count_action()(id), 0);
+
+        hpx::id_type c = hpx::new_<test_server>(id).get();
+
+        std::vector<hpx::future<int>> calls;
+        calls.reserve(1000);
+        for (int i = 0; i != 1000; ++i)
+        {
+            calls.push_back(hpx::async<component_increment_action>(c, i));
+        }
+
+        for (int i = 0; i != 1000; ++i)
+        {
+            HPX_TEST_EQ(calls[i].get(), i + 1);
+        }
+    }
+
+    return hpx::util::report_errors();
+}
+#endif
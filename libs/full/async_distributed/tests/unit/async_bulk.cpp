@@ -0,0 +1,181 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int32_t> accumulated(0);
+
+struct test_server : hpx::components::component_base<test_server>
+{
+    std::int32_t add(std::int32_t i, std::int32_t j) const
+    {
+        return i + j;
+    }
+
+    void accumulate(std::int32_t i) const
+    {
+        accumulated += i;
+    }
+
+    std::uint32_t locality() const
+    {
+        return hpx::get_locality_id();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, add)
+    HPX_DEFINE_COMPONENT_ACTION(test_server, accumulate)
+    HPX_DEFINE_COMPONENT_ACTION(test_server, locality)
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::add_action add_action;
+HPX_REGISTER_ACTION_DECLARATION(add_action)
+HPX_REGISTER_ACTION(add_action)
+HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION(add_action)
+HPX_REGISTER_ASYNC_BULK_ACTION(add_action)
+
+typedef test_server::accumulate_action accumulate_action;
+HPX_REGISTER_ACTION_DECLARATION(accumulate_action)
+HPX_REGISTER_ACTION(accumulate_action)
+HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION(accumulate_action)
+HPX_REGISTER_ASYNC_BULK_ACTION(accumulate_action)
+
+typedef test_server::locality_action locality_action;
+HPX_REGISTER_ACTION_DECLARATION(locality_action)
+HPX_REGISTER_ACTION(locality_action)
+HPX_REGISTER_ASYNC_BULK_ACTION_DECLARATION(locality_action)
+HPX_REGISTER_ASYNC_BULK_ACTION(locality_action)
+
+std::int32_t get_accumulated()
+{
+    return accumulated.exchange(0);
+}
+HPX_PLAIN_ACTION(get_accumulated)
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<hpx::id_type> create_objects(std::size_t count)
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    std::vector<hpx::id_type> ids;
+    ids.reserve(count);
+    for (std::size_t i = 0; i != count; ++i)
+    {
+        ids.push_back(hpx::new_<test_server>(localities[i % localities.size()])
+                          .get());
+    }
+    return ids;
+}
+
+void test_async_bulk_shared(std::vector<hpx::id_type> const& ids)
+{
+    std::vector<std::int32_t> results =
+        hpx::async_bulk<add_action>(ids, 40, 2).get();
+
+    HPX_TEST_EQ(results.size(), ids.size());
+    for (std::int32_t r : results)
+    {
+        HPX_TEST_EQ(r, 42);
+    }
+
+    // the results have to be delivered in the order of the ids
+    std::vector<hpx::id_type> all_localities = hpx::find_all_localities();
+    std::vector<std::uint32_t> localities =
+        hpx::async_bulk<locality_action>(ids).get();
+
+    HPX_TEST_EQ(localities.size(), ids.size());
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        HPX_TEST_EQ(localities[i],
+            hpx::naming::get_locality_id_from_id(
+                all_localities[i % all_localities.size()]));
+    }
+}
+
+void test_async_bulk_args(std::vector<hpx::id_type> const& ids)
+{
+    std::vector<hpx::tuple<std::int32_t, std::int32_t>> args;
+    args.reserve(ids.size());
+    for (std::size_t i = 0; i != ids.size(); ++i)
+    {
+        args.emplace_back(std::int32_t(i), std::int32_t(i));
+    }
+
+    std::vector<std::int32_t> results =
+        hpx::async_bulk<add_action>(ids, args).get();
+
+    HPX_TEST_EQ(results.size(), ids.size());
+    for (std::size_t i = 0; i != results.size(); ++i)
+    {
+        HPX_TEST_EQ(results[i], std::int32_t(2 * i));
+    }
+
+    // mismatching number of arguments
+    args.pop_back();
+    bool caught_exception = false;
+    try
+    {
+        hpx::async_bulk<add_action>(ids, args).get();
+    }
+    catch (hpx::exception const&)
+    {
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_async_bulk_void(std::vector<hpx::id_type> const& ids)
+{
+    hpx::async_bulk<accumulate_action>(ids, 1).get();
+
+    std::int32_t sum = 0;
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        sum += hpx::async<get_accumulated_action>(locality).get();
+    }
+    HPX_TEST_EQ(sum, std::int32_t(ids.size()));
+}
+
+int hpx_main()
+{
+    std::vector<hpx::id_type> ids = create_objects(100);
+
+    test_async_bulk_shared(ids);
+    test_async_bulk_args(ids);
+    test_async_bulk_void(ids);
+
+    // empty sequence of targets
+    std::vector<std::int32_t> results =
+        hpx::async_bulk<add_action>(std::vector<hpx::id_type>(), 1, 2).get();
+    HPX_TEST(results.empty());
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,162 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that the results of remote invocations are delivered through the
+// response table (instead of a promise LCO).
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/async_distributed/detail/response_table.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::atomic<std::int32_t> accumulated(0);
+
+std::int32_t add(std::int32_t i, std::int32_t j)
+{
+    return i + j;
+}
+HPX_PLAIN_ACTION(add)
+
+void accumulate(std::int32_t i)
+{
+    accumulated += i;
+}
+HPX_PLAIN_ACTION(accumulate)
+
+std::int32_t get_accumulated()
+{
+    return accumulated.exchange(0);
+}
+HPX_PLAIN_ACTION(get_accumulated)
+
+std::string concatenate(std::string const& lhs, std::string const& rhs)
+{
+    return lhs + rhs;
+}
+HPX_PLAIN_ACTION(concatenate)
+
+hpx::future<std::int32_t> add_async(std::int32_t i, std::int32_t j)
+{
+    return hpx::make_ready_future(i + j);
+}
+HPX_PLAIN_ACTION(add_async)
+
+std::int32_t throw_error(std::int32_t)
+{
+    HPX_THROW_EXCEPTION(
+        hpx::invalid_status, "throw_error", "this function always throws");
+    return 0;
+}
+HPX_PLAIN_ACTION(throw_error)
+
+void throw_error_void()
+{
+    HPX_THROW_EXCEPTION(
+        hpx::invalid_status, "throw_error_void", "this function always throws");
+}
+HPX_PLAIN_ACTION(throw_error_void)
+
+///////////////////////////////////////////////////////////////////////////////
+void test_remote_response(hpx::id_type const& locality)
+{
+    HPX_TEST_EQ(hpx::async<add_action>(locality, 40, 2).get(), 42);
+    HPX_TEST_EQ(hpx::async<add_action>(hpx::launch::sync, locality, 40, 2)
+                    .get(),
+        42);
+
+    // the returned future is unwrapped implicitly
+    hpx::future<std::int32_t> f =
+        hpx::async<add_async_action>(locality, 40, 2);
+    HPX_TEST_EQ(f.get(), 42);
+
+    HPX_TEST_EQ(hpx::async<concatenate_action>(locality, std::string("4"),
+                    std::string("2"))
+                    .get(),
+        std::string("42"));
+
+    hpx::async<accumulate_action>(locality, 42).get();
+    HPX_TEST_EQ(hpx::async<get_accumulated_action>(locality).get(), 42);
+}
+
+void test_remote_error(hpx::id_type const& locality)
+{
+    bool caught_exception = false;
+    try
+    {
+        hpx::async<throw_error_action>(locality, 42).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST(e.get_error() == hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    caught_exception = false;
+    try
+    {
+        hpx::async<throw_error_void_action>(locality).get();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST(e.get_error() == hpx::invalid_status);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_many_responses(hpx::id_type const& locality)
+{
+    constexpr std::int32_t count = 1000;
+
+    std::vector<hpx::future<std::int32_t>> futures;
+    futures.reserve(count);
+    for (std::int32_t i = 0; i != count; ++i)
+    {
+        futures.push_back(hpx::async<add_action>(locality, i, i));
+    }
+
+    for (std::int32_t i = 0; i != count; ++i)
+    {
+        HPX_TEST_EQ(futures[i].get(), 2 * i);
+    }
+}
+
+int hpx_main()
+{
+    for (hpx::id_type const& locality : hpx::find_all_localities())
+    {
+        test_remote_response(locality);
+        test_remote_error(locality);
+        test_many_responses(locality);
+    }
+
+    // all responses have been delivered, no slot is in use anymore
+    HPX_TEST_EQ(hpx::lcos::detail::response_table::size(), std::size_t(0));
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // Initialize and run HPX
+    HPX_TEST_EQ_MSG(
+        hpx::init(argc, argv), 0, "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -22,16 +22,21 @@
 #include <hpx/components/get_ptr.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
 #include <hpx/modules/naming.hpp>
 #include <hpx/runtime_components/new.hpp>
 #include <hpx/runtime_distributed/find_here.hpp>
 #include <hpx/serialization/serialize.hpp>
+#include <hpx/serialization/stream_buffer.hpp>
 #include <hpx/serialization/vector.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
-#include <iosfwd>
+#include <functional>
+#include <istream>
 #include <memory>
+#include <ostream>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -570,6 +575,97 @@ namespace hpx { namespace util {
     }
     /// \endcond
 
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        struct save_to_stream_funct_obj
+        {
+            template <typename... Ts>
+            void operator()(
+                std::reference_wrapper<std::ostream> ost, Ts&&... ts) const
+            {
+                std::ostream& os = ost.get();
+
+                // Write the size of the checkpoint first, this keeps the
+                // stream compatible with operator>>
+                std::int64_t size = static_cast<std::int64_t>(
+                    hpx::util::prepare_checkpoint_data(ts...));
+                os.write(
+                    reinterpret_cast<char const*>(&size), sizeof(std::int64_t));
+
+                // Stream the data as it is being serialized
+                auto sink = [&os](char const* data, std::size_t count) {
+                    if (!os.write(data, count))
+                    {
+                        HPX_THROW_EXCEPTION(filesystem_error,
+                            "hpx::util::save_checkpoint_to",
+                            "failed to write checkpoint data to stream");
+                    }
+                };
+
+                hpx::serialization::output_stream_buffer<decltype(sink)>
+                    buffer(sink);
+                hpx::util::save_checkpoint_data(
+                    buffer, HPX_FORWARD(Ts, ts)...);
+                buffer.flush();
+            }
+        };
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_to - Stream the checkpoint data
+    ///
+    /// \tparam Ts           Containers passed to save_checkpoint_to to be
+    ///                      serialized and written to the stream.
+    ///
+    /// \param ost           The stream to write the checkpoint data to. The
+    ///                      stream has to stay valid until the returned future
+    ///                      has become ready.
+    ///
+    /// \param ts            The containers to store.
+    ///
+    /// Save_checkpoint_to serializes the given objects directly into the
+    /// given stream instead of into a checkpoint object. The data is written
+    /// in segments while the serialization is in progress, i.e. the full
+    /// checkpoint is never held in memory. The data written is identical to
+    /// the data written by operator<< for a checkpoint holding the same
+    /// objects, it can be read by either operator>> or restore_checkpoint_from.
+    ///
+    /// \returns Save_checkpoint_to returns a future that becomes ready once
+    ///          all of the data has been written to the stream.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_to(std::ostream& ost, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_to_stream_funct_obj{},
+            std::ref(ost), detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_to - Policy overload
+    ///
+    /// \tparam Ts           Containers passed to save_checkpoint_to to be
+    ///                      serialized and written to the stream.
+    ///
+    /// \param p             Takes an HPX launch policy. Allows the user
+    ///                      to change the way the function is launched
+    ///                      i.e. async, sync, etc.
+    ///
+    /// \param ost           The stream to write the checkpoint data to. The
+    ///                      stream has to stay valid until the returned future
+    ///                      has become ready.
+    ///
+    /// \param ts            The containers to store.
+    ///
+    /// \returns Save_checkpoint_to returns a future that becomes ready once
+    ///          all of the data has been written to the stream.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_to(
+        hpx::launch p, std::ostream& ost, Ts&&... ts)
+    {
+        return hpx::dataflow(p, detail::save_to_stream_funct_obj{},
+            std::ref(ost), detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     namespace detail {
 
@@ -849,4 +945,62 @@ namespace hpx { namespace util {
     inline void restore_checkpoint(checkpoint const&) {}
     /// \endcond
 
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_from
+    ///
+    /// Restore_checkpoint_from reads the checkpoint data directly from the
+    /// given stream and fills the given containers (in the same order as they
+    /// were placed in save_checkpoint_to or save_checkpoint). The data is read
+    /// in segments while the de-serialization is in progress, i.e. the full
+    /// checkpoint is never held in memory. The stream is expected to contain
+    /// data as written by save_checkpoint_to or by operator<< for a
+    /// checkpoint, a filesystem_error is thrown if the size of the
+    /// checkpoint can't be read from the stream.
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore. Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// \param ist          The stream to read the checkpoint data from.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore Containers
+    ///                     must be in the same order that they were
+    ///                     inserted into the checkpoint.
+    ///
+    /// \returns Restore_checkpoint_from returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint_from(std::istream& ist, T& t, Ts&... ts)
+    {
+        // Read in the size of the checkpoint
+        std::int64_t remaining = 0;
+        if (!ist.read(reinterpret_cast<char*>(&remaining),
+                sizeof(std::int64_t)) ||
+            remaining < 0)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::restore_checkpoint_from",
+                "failed to read the size of the checkpoint from the stream");
+        }
+
+        // Never read past the end of this checkpoint
+        auto source = [&ist, &remaining](
+                          char* data, std::size_t count) -> std::size_t {
+            count = (std::min)(count, static_cast<std::size_t>(remaining));
+            ist.read(data, static_cast<std::streamsize>(count));
+
+            auto received = static_cast<std::size_t>(ist.gcount());
+            remaining -= static_cast<std::int64_t>(received);
+            return received;
+        };
+
+        hpx::serialization::input_stream_buffer<decltype(source)> buffer(
+            source);
+        hpx::util::restore_checkpoint_data_func(
+            buffer, detail::restore_impl{}, t, ts...);
+    }
+
 }}    // namespace hpx::util
@@ -0,0 +1,319 @@
+// Copyright (c) 2026 agent
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines save_checkpoint_async and restore_checkpoint_from_file.
+/// These functions write checkpoints directly to (and read them directly
+/// from) files, divided into blocks. Incremental checkpoints append only
+/// those blocks to the file whose content has changed since the checkpoint
+/// stored last.
+
+/// \file hpx/checkpoint/checkpoint_file.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/functional/function.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/serialization/stream_buffer.hpp>
+#include <hpx/type_support/unwrap_ref.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    /// Default size of the blocks a checkpoint file is divided into.
+    inline constexpr std::size_t default_checkpoint_block_size = 1024 * 1024;
+
+    /// Maximal size of the blocks a checkpoint file is divided into.
+    inline constexpr std::size_t max_checkpoint_block_size = 1024 * 1024 * 1024;
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Options controlling how checkpoints are written to and read from files
+    /// by save_checkpoint_async and restore_checkpoint_from_file.
+    struct checkpoint_file_options
+    {
+        /// Append the checkpoint to an existing checkpoint file, writing only
+        /// the blocks whose content has changed since the checkpoint stored
+        /// last. All other blocks refer to the data already in the file. A
+        /// full checkpoint is written if the file does not exist yet. Full
+        /// checkpoints are written to a temporary file first, which replaces
+        /// the given file once the checkpoint is complete.
+        bool incremental = false;
+
+        /// The size of the blocks the serialized data is divided into. The
+        /// blocks are the unit of change detection and of compression, the
+        /// size may not exceed max_checkpoint_block_size.
+        std::size_t block_size = default_checkpoint_block_size;
+
+        /// The maximal number of blocks being compressed or waiting to be
+        /// written at any point in time. This bounds the memory used while
+        /// saving a checkpoint to about max_blocks_in_flight * block_size.
+        std::size_t max_blocks_in_flight = 8;
+
+        /// Optional compression applied to the blocks written to the file,
+        /// invoked as compress(data, size). Blocks are compressed
+        /// concurrently to the serialization and to each other. Blocks that
+        /// do not become smaller are stored uncompressed.
+        hpx::function<std::vector<char>(char const*, std::size_t)> compress;
+
+        /// Decompression corresponding to 'compress', invoked as
+        /// decompress(data, size, dest, dest_size) to restore compressed
+        /// blocks, where dest_size is the size of the original block.
+        hpx::function<void(char const*, std::size_t, char*, std::size_t)>
+            decompress;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Location and content hash of a block stored in a checkpoint file
+        struct checkpoint_file_block
+        {
+            std::uint64_t offset = 0;
+            std::uint64_t stored_size = 0;
+            std::uint64_t size = 0;
+            std::uint64_t hash = 0;
+            std::uint64_t compressed = 0;
+        };
+
+        // The blocks making up the checkpoint stored last in a file
+        struct checkpoint_file_index
+        {
+            std::uint64_t size = 0;
+            std::vector<checkpoint_file_block> blocks;
+        };
+
+        // Read the index of the checkpoint stored last in the given file,
+        // returns false if the file does not hold a valid checkpoint. Falls
+        // back to the checkpoint stored before if the last one was not
+        // completely written.
+        HPX_EXPORT bool read_checkpoint_file_index(
+            std::istream& file, checkpoint_file_index& index);
+
+        HPX_EXPORT std::uint64_t checkpoint_block_hash(
+            char const* data, std::size_t size) noexcept;
+
+        // The sink used for streaming the serialized data into a file
+        class HPX_EXPORT checkpoint_file_writer
+        {
+        public:
+            checkpoint_file_writer(std::string const& file_path,
+                checkpoint_file_options const& options);
+
+            checkpoint_file_writer(checkpoint_file_writer const&) = delete;
+            checkpoint_file_writer& operator=(
+                checkpoint_file_writer const&) = delete;
+
+            void write(char const* data, std::size_t size);
+            void finish();
+
+        private:
+            struct stored_block
+            {
+                std::vector<char> data;
+                bool compressed = false;
+            };
+
+            struct pending_block
+            {
+                std::size_t index;
+                hpx::future<stored_block> data;
+            };
+
+            void submit_block();
+            void write_pending_block();
+
+            checkpoint_file_options options_;
+            std::string file_path_;
+            std::string temp_path_;    // empty if appending to file_path_
+            std::fstream file_;
+            std::uint64_t end_;
+            std::uint64_t size_;
+            checkpoint_file_index previous_;
+            std::vector<checkpoint_file_block> blocks_;
+            std::vector<char> current_;
+            std::deque<pending_block> pending_;
+        };
+
+        // The source used for streaming the serialized data from a file
+        class HPX_EXPORT checkpoint_file_reader
+        {
+        public:
+            checkpoint_file_reader(std::string const& file_path,
+                checkpoint_file_options const& options);
+
+            checkpoint_file_reader(checkpoint_file_reader const&) = delete;
+            checkpoint_file_reader& operator=(
+                checkpoint_file_reader const&) = delete;
+
+            std::size_t read(char* data, std::size_t size);
+
+        private:
+            void read_block(checkpoint_file_block const& block, char* dest);
+
+            checkpoint_file_options options_;
+            std::ifstream file_;
+            checkpoint_file_index index_;
+            std::size_t next_block_;
+            std::vector<char> current_;
+            std::size_t pos_;
+            std::vector<char> stored_;
+        };
+
+        struct save_to_file_funct_obj
+        {
+            template <typename... Ts>
+            void operator()(std::string const& file_path,
+                checkpoint_file_options const& options, Ts&&... ts) const
+            {
+                checkpoint_file_writer writer(file_path, options);
+
+                auto sink = [&writer](char const* data, std::size_t size) {
+                    writer.write(data, size);
+                };
+
+                hpx::serialization::output_stream_buffer<decltype(sink)>
+                    buffer(sink, options.block_size);
+                hpx::util::save_checkpoint_data(
+                    buffer, hpx::util::unwrap_ref(ts)...);
+                buffer.flush();
+
+                writer.finish();
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_async - Write a checkpoint to a file
+    ///
+    /// \tparam Ts           Containers passed to save_checkpoint_async to be
+    ///                      serialized and written to the file.
+    ///
+    /// \param file_path     The file to write the checkpoint to.
+    ///
+    /// \param options       Options controlling how the checkpoint is
+    ///                      written, see checkpoint_file_options.
+    ///
+    /// \param ts            The containers to store.
+    ///
+    /// Save_checkpoint_async serializes the given objects on a new HPX thread
+    /// and streams the data to the file in blocks while the serialization is
+    /// in progress, i.e. the full checkpoint is never held in memory. The
+    /// objects are copied before the function returns unless they are
+    /// passed as std::ref(t), in which case they must not be modified until
+    /// the returned future has become ready. Components can be stored by
+    /// passing their client instances.
+    ///
+    /// \returns Save_checkpoint_async returns a future that becomes ready
+    ///          once the checkpoint has been completely written to the file.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_async(std::string const& file_path,
+        checkpoint_file_options const& options, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_to_file_funct_obj{}, file_path,
+            options, detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_async - Write a checkpoint to a file
+    ///
+    /// \tparam T            A container passed to save_checkpoint_async to be
+    ///                      serialized and written to the file.
+    ///
+    /// \tparam Ts           More containers passed to save_checkpoint_async
+    ///                      to be serialized and written to the file.
+    ///
+    /// \tparam U            This parameter is used to make sure that T is
+    ///                      not a checkpoint_file_options. This forces the
+    ///                      compiler to choose the correct overload.
+    ///
+    /// \param file_path     The file to write the checkpoint to, an existing
+    ///                      file is overwritten.
+    ///
+    /// \param t             A container to store.
+    ///
+    /// \param ts            Other containers to store.
+    ///
+    /// \returns Save_checkpoint_async returns a future that becomes ready
+    ///          once the checkpoint has been completely written to the file.
+    template <typename T, typename... Ts,
+        typename U = std::enable_if_t<
+            !std::is_same_v<std::decay_t<T>, checkpoint_file_options>>>
+    hpx::future<void> save_checkpoint_async(
+        std::string const& file_path, T&& t, Ts&&... ts)
+    {
+        return save_checkpoint_async(file_path, checkpoint_file_options{},
+            HPX_FORWARD(T, t), HPX_FORWARD(Ts, ts)...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_from_file
+    ///
+    /// Restore_checkpoint_from_file restores the given containers (in the
+    /// same order as they were placed in save_checkpoint_async) from the
+    /// checkpoint written last to the given file. The blocks of the file are
+    /// read (and decompressed) one at a time while the de-serialization is
+    /// in progress.
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore.
+    ///
+    /// \param file_path    The file to read the checkpoint from.
+    ///
+    /// \param options      Options used for reading the checkpoint, this
+    ///                     has to provide the decompression function if the
+    ///                     checkpoint was written using compression.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore.
+    ///
+    /// \returns Restore_checkpoint_from_file returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint_from_file(std::string const& file_path,
+        checkpoint_file_options const& options, T& t, Ts&... ts)
+    {
+        detail::checkpoint_file_reader reader(file_path, options);
+
+        auto source = [&reader](char* data, std::size_t size) {
+            return reader.read(data, size);
+        };
+
+        hpx::serialization::input_stream_buffer<decltype(source)> buffer(
+            source, options.block_size);
+        hpx::util::restore_checkpoint_data_func(
+            buffer, detail::restore_impl{}, t, ts...);
+    }
+
+    /// \cond NOINTERNAL
+    template <typename T, typename... Ts,
+        typename U = std::enable_if_t<
+            !std::is_same_v<std::decay_t<T>, checkpoint_file_options>>>
+    void restore_checkpoint_from_file(
+        std::string const& file_path, T& t, Ts&... ts)
+    {
+        restore_checkpoint_from_file(
+            file_path, checkpoint_file_options{}, t, ts...);
+    }
+    /// \endcond
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,388 @@
+// Copyright (c) 2026 agent
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// This header defines save_checkpoint_records, mapped_checkpoint, and
+/// restore_checkpoint_records. These store each object of a checkpoint as a
+/// separately addressable record in a file. Restoring maps the file into
+/// memory and de-serializes records only when they are asked for, arrays of
+/// bitwise serializable elements can be accessed without copying them.
+
+/// \file hpx/checkpoint/mapped_checkpoint.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/checkpoint/checkpoint.hpp>
+#include <hpx/checkpoint_base/checkpoint_data.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+#include <hpx/serialization/stream_buffer.hpp>
+#include <hpx/serialization/traits/is_bitwise_serializable.hpp>
+#include <hpx/type_support/unwrap_ref.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <hpx/config/warnings_prefix.hpp>
+
+namespace hpx { namespace util {
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // The records of a checkpoint file start at offsets which are a
+        // multiple of this value. This guarantees the proper alignment of
+        // arrays accessed in place.
+        inline constexpr std::size_t checkpoint_record_alignment = 64;
+
+        // Location of a record stored in a checkpoint file. Records holding
+        // an array of bitwise serializable elements store the raw elements
+        // (element_size != 0), all other records store the serialized object.
+        struct checkpoint_record
+        {
+            std::uint64_t offset = 0;
+            std::uint64_t size = 0;
+            std::uint64_t element_size = 0;
+        };
+
+        // Arrays whose elements are stored in the file as they are
+        template <typename T>
+        struct is_bitwise_checkpoint_array : std::false_type
+        {
+        };
+
+        template <typename T, typename Allocator>
+        struct is_bitwise_checkpoint_array<std::vector<T, Allocator>>
+          : std::integral_constant<bool,
+                hpx::traits::is_bitwise_serializable_v<T> &&
+                    !std::is_pointer_v<T> && !std::is_same_v<T, bool>>
+        {
+        };
+
+        // Writes the records of a checkpoint to a file
+        class HPX_EXPORT checkpoint_record_writer
+        {
+        public:
+            explicit checkpoint_record_writer(std::string const& file_path);
+
+            checkpoint_record_writer(checkpoint_record_writer const&) = delete;
+            checkpoint_record_writer& operator=(
+                checkpoint_record_writer const&) = delete;
+
+            void begin_record();
+            void write(char const* data, std::size_t size);
+            void end_record(std::size_t element_size = 0);
+
+            void finish();
+
+        private:
+            std::ofstream file_;
+            std::uint64_t end_;
+            std::vector<checkpoint_record> records_;
+        };
+
+        // The file mapped into memory. The pages of the file are mapped
+        // copy-on-write, i.e. modifying the data in memory does not change
+        // the file.
+        class HPX_EXPORT checkpoint_file_mapping
+        {
+        public:
+            explicit checkpoint_file_mapping(std::string const& file_path);
+            ~checkpoint_file_mapping();
+
+            checkpoint_file_mapping(checkpoint_file_mapping const&) = delete;
+            checkpoint_file_mapping& operator=(
+                checkpoint_file_mapping const&) = delete;
+
+            char* data() const noexcept
+            {
+                return data_;
+            }
+
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            std::vector<checkpoint_record> const& records() const noexcept
+            {
+                return records_;
+            }
+
+            // Ask the operating system to page in the given range
+            void prefetch(std::size_t offset, std::size_t size) const noexcept;
+
+        private:
+            char* data_;
+            std::size_t size_;
+            std::vector<checkpoint_record> records_;
+#if defined(HPX_WINDOWS)
+            void* mapping_;
+#endif
+        };
+
+        // Non-owning view of the serialized data of a record, used as the
+        // container of the input archive
+        struct checkpoint_record_data
+        {
+            std::size_t size() const noexcept
+            {
+                return size_;
+            }
+
+            char const& operator[](std::size_t i) const noexcept
+            {
+                return data_[i];
+            }
+
+            char const* data_;
+            std::size_t size_;
+        };
+
+        struct save_records_funct_obj
+        {
+            template <typename T>
+            static void save_record(
+                checkpoint_record_writer& writer, T const& t)
+            {
+                writer.begin_record();
+                if constexpr (is_bitwise_checkpoint_array<T>::value)
+                {
+                    using value_type = typename T::value_type;
+                    writer.write(reinterpret_cast<char const*>(t.data()),
+                        t.size() * sizeof(value_type));
+                    writer.end_record(sizeof(value_type));
+                }
+                else
+                {
+                    auto sink = [&writer](char const* data, std::size_t size) {
+                        writer.write(data, size);
+                    };
+
+                    hpx::serialization::output_stream_buffer<decltype(sink)>
+                        buffer(sink);
+                    hpx::util::save_checkpoint_data(buffer, t);
+                    buffer.flush();
+                    writer.end_record();
+                }
+            }
+
+            template <typename... Ts>
+            void operator()(std::string const& file_path, Ts&&... ts) const
+            {
+                checkpoint_record_writer writer(file_path);
+                (save_record(writer, hpx::util::unwrap_ref(ts)), ...);
+                writer.finish();
+            }
+        };
+        /// \endcond
+    }    // namespace detail
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Save_checkpoint_records - Write a checkpoint consisting of separately
+    /// addressable records to a file
+    ///
+    /// \tparam Ts           Containers passed to save_checkpoint_records to be
+    ///                      written to the file.
+    ///
+    /// \param file_path     The file to write the checkpoint to, an existing
+    ///                      file is overwritten.
+    ///
+    /// \param ts            The containers to store.
+    ///
+    /// Save_checkpoint_records writes each of the given objects as a
+    /// separate record to the file, followed by an index of all records.
+    /// Vectors of bitwise serializable elements are stored as raw arrays,
+    /// all other objects are serialized and streamed to the file. The
+    /// records are written on a new HPX thread. The objects are copied
+    /// before the function returns unless they are passed as std::ref(t), in
+    /// which case they must not be modified until the returned future has
+    /// become ready. Components can be stored by passing their client
+    /// instances.
+    ///
+    /// \returns Save_checkpoint_records returns a future that becomes ready
+    ///          once the checkpoint has been completely written to the file.
+    template <typename... Ts>
+    hpx::future<void> save_checkpoint_records(
+        std::string const& file_path, Ts&&... ts)
+    {
+        return hpx::dataflow(detail::save_records_funct_obj{}, file_path,
+            detail::prepare_client(HPX_FORWARD(Ts, ts))...);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// A mapped_checkpoint gives access to the records of a checkpoint file
+    /// written by save_checkpoint_records. The file is mapped into memory,
+    /// opening it reads the index of the records only. Records are
+    /// de-serialized when they are restored and the operating system pages
+    /// in only the parts of the file that are actually accessed. Copies of
+    /// a mapped_checkpoint refer to the same mapping.
+    class mapped_checkpoint
+    {
+    public:
+        /// Map the given checkpoint file into memory, throws a
+        /// filesystem_error if the file does not hold a checkpoint written
+        /// by save_checkpoint_records.
+        explicit mapped_checkpoint(std::string const& file_path)
+          : mapping_(std::make_shared<detail::checkpoint_file_mapping>(
+                file_path))
+        {
+        }
+
+        /// Return the number of records stored in the checkpoint
+        std::size_t size() const noexcept
+        {
+            return mapping_->records().size();
+        }
+
+        /// Return the number of bytes occupied by the given record
+        std::size_t record_size(std::size_t i) const
+        {
+            return static_cast<std::size_t>(record(i).size);
+        }
+
+        /// Return whether the given record holds a raw array, i.e. whether
+        /// it can be accessed using \a array
+        bool is_array(std::size_t i) const
+        {
+            return record(i).element_size != 0;
+        }
+
+        /// Ask the operating system to start paging in the given record.
+        /// This does not wait for the data to become available.
+        void prefetch(std::size_t i) const
+        {
+            detail::checkpoint_record const& r = record(i);
+            mapping_->prefetch(static_cast<std::size_t>(r.offset),
+                static_cast<std::size_t>(r.size));
+        }
+
+        /// Restore the given record into \a t. The type of \a t has to
+        /// correspond to the type of the object the record was written from.
+        template <typename T>
+        void restore(std::size_t i, T& t) const
+        {
+            detail::checkpoint_record const& r = record(i);
+            char const* data = mapping_->data() + r.offset;
+
+            if constexpr (detail::is_bitwise_checkpoint_array<T>::value)
+            {
+                using value_type = typename T::value_type;
+                check_array(r, sizeof(value_type));
+
+                value_type const* begin =
+                    reinterpret_cast<value_type const*>(data);
+                t.assign(begin, begin + r.size / sizeof(value_type));
+            }
+            else
+            {
+                if (r.element_size != 0)
+                {
+                    HPX_THROW_EXCEPTION(bad_parameter,
+                        "hpx::util::mapped_checkpoint::restore",
+                        "the record holds an array of bitwise serializable "
+                        "elements");
+                }
+
+                detail::checkpoint_record_data const cont{
+                    data, static_cast<std::size_t>(r.size)};
+                hpx::util::restore_checkpoint_data_func(
+                    cont, detail::restore_impl{}, t);
+            }
+        }
+
+        /// Return the elements of the given record without copying them.
+        /// The returned buffer refers to the mapped file directly and keeps
+        /// the mapping alive. Its elements are paged in when they are first
+        /// accessed, modifying them does not change the file.
+        template <typename T>
+        hpx::serialization::serialize_buffer<T> array(std::size_t i) const
+        {
+            static_assert(
+                detail::is_bitwise_checkpoint_array<std::vector<T>>::value,
+                "mapped_checkpoint::array requires bitwise serializable "
+                "elements");
+
+            detail::checkpoint_record const& r = record(i);
+            check_array(r, sizeof(T));
+
+            using buffer_type = hpx::serialization::serialize_buffer<T>;
+            return buffer_type(
+                reinterpret_cast<T*>(mapping_->data() + r.offset),
+                static_cast<std::size_t>(r.size / sizeof(T)),
+                buffer_type::reference, [mapping = mapping_](T*) noexcept {});
+        }
+
+    private:
+        detail::checkpoint_record const& record(std::size_t i) const
+        {
+            std::vector<detail::checkpoint_record> const& records =
+                mapping_->records();
+            if (i >= records.size())
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::util::mapped_checkpoint::record",
+                    "the checkpoint does not hold a record with the given "
+                    "index");
+            }
+            return records[i];
+        }
+
+        static void check_array(
+            detail::checkpoint_record const& r, std::size_t element_size)
+        {
+            if (r.element_size != element_size)
+            {
+                HPX_THROW_EXCEPTION(bad_parameter,
+                    "hpx::util::mapped_checkpoint::array",
+                    "the record does not hold an array of elements of the "
+                    "requested size");
+            }
+        }
+
+        std::shared_ptr<detail::checkpoint_file_mapping> mapping_;
+    };
+
+    ///////////////////////////////////////////////////////////////////////////
+    /// Restore_checkpoint_records
+    ///
+    /// Restore_checkpoint_records restores the given containers (in the same
+    /// order as they were placed in save_checkpoint_records) from the
+    /// records of the given checkpoint file. Use mapped_checkpoint to
+    /// restore selected records only.
+    ///
+    /// \tparam T           A container to restore.
+    ///
+    /// \tparam Ts          Other containers to restore.
+    ///
+    /// \param file_path    The file to read the checkpoint from.
+    ///
+    /// \param t            A container to restore.
+    ///
+    /// \param ts           Other containers to restore.
+    ///
+    /// \returns Restore_checkpoint_records returns void.
+    template <typename T, typename... Ts>
+    void restore_checkpoint_records(
+        std::string const& file_path, T& t, Ts&... ts)
+    {
+        mapped_checkpoint const checkpoint(file_path);
+
+        std::size_t i = 0;
+        checkpoint.restore(i++, t);
+        (checkpoint.restore(i++, ts), ...);
+    }
+}}    // namespace hpx::util
+
+#include <hpx/config/warnings_suffix.hpp>
@@ -0,0 +1,528 @@
+// Copyright (c) 2026 agent
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/async_local/async.hpp>
+#include <hpx/checkpoint/checkpoint_file.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/modules/filesystem.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <ios>
+#include <istream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace util { namespace detail {
+
+    // A checkpoint file starts with a header, followed by the stored blocks.
+    // Each checkpoint written to the file is completed by its index (the
+    // list of blocks it consists of) and a footer referring to that index.
+    // Incremental checkpoints append their changed blocks, their index and
+    // their footer to the file, the footer at the end of the file always
+    // refers to the checkpoint stored last. Nothing stored by a previous
+    // checkpoint is ever overwritten, if saving an incremental checkpoint
+    // fails halfway the reader falls back to the last footer referring to
+    // a valid index. All numbers are stored in the native byte order.
+    constexpr char checkpoint_file_magic[8] = {
+        'H', 'P', 'X', 'C', 'K', 'P', 'T', '1'};
+    constexpr char checkpoint_index_magic[8] = {
+        'H', 'P', 'X', 'C', 'K', 'I', 'D', 'X'};
+
+    constexpr std::size_t checkpoint_footer_size =
+        sizeof(std::uint64_t) + sizeof(checkpoint_index_magic);
+    constexpr std::size_t checkpoint_index_header_size =
+        2 * sizeof(std::uint64_t);
+    constexpr std::size_t checkpoint_block_record_size =
+        5 * sizeof(std::uint64_t);
+
+    // The size of the chunks read while searching for a valid footer
+    constexpr std::size_t checkpoint_scan_size = 64 * 1024;
+
+    namespace {
+
+        void write_value(std::ostream& os, std::uint64_t value)
+        {
+            os.write(reinterpret_cast<char const*>(&value), sizeof(value));
+        }
+
+        bool read_value(std::istream& is, std::uint64_t& value)
+        {
+            return static_cast<bool>(
+                is.read(reinterpret_cast<char*>(&value), sizeof(value)));
+        }
+
+        // The blocks have to be stored in front of the index referring to
+        // them, uncompressed blocks are stored as they are.
+        bool valid_checkpoint_block(
+            checkpoint_file_block const& block, std::uint64_t index_offset)
+        {
+            if (block.offset < sizeof(checkpoint_file_magic) ||
+                block.offset > index_offset ||
+                block.stored_size > index_offset - block.offset ||
+                block.size == 0 || block.size > max_checkpoint_block_size)
+            {
+                return false;
+            }
+            if (block.compressed == 0)
+            {
+                return block.stored_size == block.size;
+            }
+            return block.compressed == 1;
+        }
+
+        // Read the index referred to by the footer stored at the given
+        // position in the file, returns false if either is not valid.
+        bool read_checkpoint_file_index_at(std::istream& file,
+            std::uint64_t footer_offset, checkpoint_file_index& index)
+        {
+            char magic[sizeof(checkpoint_index_magic)];
+            std::uint64_t index_offset = 0;
+
+            file.clear();
+            if (!file.seekg(static_cast<std::streamoff>(footer_offset)) ||
+                !read_value(file, index_offset) ||
+                !file.read(magic, sizeof(magic)) ||
+                std::memcmp(magic, checkpoint_index_magic, sizeof(magic)) !=
+                    0 ||
+                index_offset < sizeof(checkpoint_file_magic) ||
+                index_offset > footer_offset ||
+                footer_offset - index_offset < checkpoint_index_header_size)
+            {
+                return false;
+            }
+
+            // the index fills the space up to the footer exactly
+            std::uint64_t const index_size =
+                footer_offset - index_offset - checkpoint_index_header_size;
+
+            std::uint64_t count = 0;
+            if (index_size % checkpoint_block_record_size != 0 ||
+                !file.seekg(static_cast<std::streamoff>(index_offset)) ||
+                !read_value(file, index.size) || !read_value(file, count) ||
+                count != index_size / checkpoint_block_record_size)
+            {
+                return false;
+            }
+
+            // the blocks hold the serialized data of the checkpoint in order
+            std::uint64_t size = 0;
+            index.blocks.resize(count);
+            for (checkpoint_file_block& block : index.blocks)
+            {
+                if (!read_value(file, block.offset) ||
+                    !read_value(file, block.stored_size) ||
+                    !read_value(file, block.size) ||
+                    !read_value(file, block.hash) ||
+                    !read_value(file, block.compressed) ||
+                    !valid_checkpoint_block(block, index_offset))
+                {
+                    return false;
+                }
+                size += block.size;
+            }
+            return size == index.size;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    bool read_checkpoint_file_index(
+        std::istream& file, checkpoint_file_index& index)
+    {
+        char magic[sizeof(checkpoint_file_magic)];
+        if (!file.seekg(0, std::ios::beg) ||
+            !file.read(magic, sizeof(magic)) ||
+            std::memcmp(magic, checkpoint_file_magic, sizeof(magic)) != 0 ||
+            !file.seekg(0, std::ios::end))
+        {
+            return false;
+        }
+
+        auto const file_size = static_cast<std::uint64_t>(file.tellg());
+        if (file_size < sizeof(checkpoint_file_magic) + checkpoint_footer_size)
+        {
+            return false;
+        }
+
+        // usually, the footer at the end of the file refers to the index of
+        // the checkpoint stored last
+        if (read_checkpoint_file_index_at(
+                file, file_size - checkpoint_footer_size, index))
+        {
+            return true;
+        }
+
+        // otherwise the file ends with the remains of a checkpoint that was
+        // not completely written, search backwards for the footer of the
+        // checkpoint stored before
+        std::uint64_t const first_magic =
+            sizeof(checkpoint_file_magic) + sizeof(std::uint64_t);
+
+        std::vector<char> buffer;
+        std::uint64_t end = file_size - 1;
+        while (end - first_magic >= sizeof(checkpoint_index_magic))
+        {
+            std::uint64_t const begin =
+                end - first_magic > checkpoint_scan_size ?
+                end - checkpoint_scan_size :
+                first_magic;
+
+            buffer.resize(static_cast<std::size_t>(end - begin));
+            file.clear();
+            if (!file.seekg(static_cast<std::streamoff>(begin)) ||
+                !file.read(buffer.data(),
+                    static_cast<std::streamsize>(buffer.size())))
+            {
+                return false;
+            }
+
+            for (std::size_t i =
+                     buffer.size() - sizeof(checkpoint_index_magic) + 1;
+                 i-- != 0;
+                 /**/)
+            {
+                if (std::memcmp(buffer.data() + i, checkpoint_index_magic,
+                        sizeof(checkpoint_index_magic)) == 0 &&
+                    read_checkpoint_file_index_at(
+                        file, begin + i - sizeof(std::uint64_t), index))
+                {
+                    return true;
+                }
+            }
+
+            // the chunks overlap to find footers crossing their boundary
+            end = begin + sizeof(checkpoint_index_magic) - 1;
+        }
+        return false;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Hash the block data in words of 64 bits, this is used for detecting
+    // changed blocks only.
+    std::uint64_t checkpoint_block_hash(
+        char const* data, std::size_t size) noexcept
+    {
+        constexpr std::uint64_t prime = 0x100000001b3ull;
+        std::uint64_t hash = 0xcbf29ce484222325ull ^ size;
+
+        std::size_t i = 0;
+        for (/**/; i + sizeof(std::uint64_t) <= size;
+             i += sizeof(std::uint64_t))
+        {
+            std::uint64_t word;
+            std::memcpy(&word, data + i, sizeof(word));
+            hash = (hash ^ word) * prime;
+            hash ^= hash >> 29;
+        }
+        for (/**/; i != size; ++i)
+        {
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * prime;
+        }
+
+        hash ^= hash >> 32;
+        hash *= 0xd6e8feb86659fd93ull;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_writer::checkpoint_file_writer(
+        std::string const& file_path, checkpoint_file_options const& options)
+      : options_(options)
+      , file_path_(file_path)
+      , end_(0)
+      , size_(0)
+    {
+        if (options_.block_size == 0)
+        {
+            options_.block_size = default_checkpoint_block_size;
+        }
+        else if (options_.block_size > max_checkpoint_block_size)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::util::save_checkpoint_async",
+                "the block size exceeds max_checkpoint_block_size");
+        }
+        if (options_.max_blocks_in_flight == 0)
+        {
+            options_.max_blocks_in_flight = 1;
+        }
+
+        // incremental checkpoints are appended to the file, the data of the
+        // checkpoint stored before stays untouched
+        if (options_.incremental)
+        {
+            file_.open(file_path,
+                std::ios::in | std::ios::out | std::ios::binary);
+            if (file_.is_open() &&
+                read_checkpoint_file_index(file_, previous_) &&
+                file_.seekp(0, std::ios::end))
+            {
+                end_ = static_cast<std::uint64_t>(file_.tellp());
+            }
+            else
+            {
+                previous_ = checkpoint_file_index();
+                file_.close();
+            }
+        }
+
+        // full checkpoints replace the file only once they are complete
+        if (!file_.is_open())
+        {
+            temp_path_ = file_path + ".tmp";
+            file_.open(temp_path_,
+                std::ios::out | std::ios::trunc | std::ios::binary);
+            if (!file_.write(
+                    checkpoint_file_magic, sizeof(checkpoint_file_magic)))
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::util::save_checkpoint_async",
+                    "failed to create checkpoint file: " + temp_path_);
+            }
+            end_ = sizeof(checkpoint_file_magic);
+        }
+
+        current_.reserve(options_.block_size);
+    }
+
+    void checkpoint_file_writer::write(char const* data, std::size_t size)
+    {
+        size_ += size;
+        while (size != 0)
+        {
+            std::size_t const count =
+                (std::min)(size, options_.block_size - current_.size());
+            current_.insert(current_.end(), data, data + count);
+            data += count;
+            size -= count;
+
+            if (current_.size() == options_.block_size)
+            {
+                submit_block();
+            }
+        }
+    }
+
+    void checkpoint_file_writer::submit_block()
+    {
+        std::size_t const index = blocks_.size();
+
+        checkpoint_file_block block;
+        block.size = current_.size();
+        block.hash = checkpoint_block_hash(current_.data(), current_.size());
+
+        // unchanged blocks refer to the data stored by a previous checkpoint
+        if (index < previous_.blocks.size() &&
+            previous_.blocks[index].size == block.size &&
+            previous_.blocks[index].hash == block.hash)
+        {
+            blocks_.push_back(previous_.blocks[index]);
+            current_.clear();
+            return;
+        }
+
+        blocks_.push_back(block);
+
+        std::vector<char> data;
+        data.reserve(options_.block_size);
+        std::swap(data, current_);
+
+        if (options_.compress)
+        {
+            pending_.push_back(pending_block{index,
+                hpx::async([compress = options_.compress,
+                               data = HPX_MOVE(data)]() mutable {
+                    std::vector<char> compressed =
+                        compress(data.data(), data.size());
+                    if (compressed.size() < data.size())
+                    {
+                        return stored_block{HPX_MOVE(compressed), true};
+                    }
+                    return stored_block{HPX_MOVE(data), false};
+                })});
+        }
+        else
+        {
+            pending_.push_back(pending_block{index,
+                hpx::make_ready_future(stored_block{HPX_MOVE(data), false})});
+        }
+
+        // the blocks are written in order, this limits the amount of memory
+        // held by blocks not written yet
+        while (pending_.size() >= options_.max_blocks_in_flight)
+        {
+            write_pending_block();
+        }
+    }
+
+    void checkpoint_file_writer::write_pending_block()
+    {
+        pending_block pending = HPX_MOVE(pending_.front());
+        pending_.pop_front();
+
+        stored_block stored = pending.data.get();
+
+        checkpoint_file_block& block = blocks_[pending.index];
+        block.offset = end_;
+        block.stored_size = stored.data.size();
+        block.compressed = stored.compressed ? 1 : 0;
+
+        if (!file_.write(stored.data.data(),
+                static_cast<std::streamsize>(stored.data.size())))
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::save_checkpoint_async",
+                "failed to write checkpoint data to file");
+        }
+        end_ += block.stored_size;
+    }
+
+    void checkpoint_file_writer::finish()
+    {
+        if (!current_.empty())
+        {
+            submit_block();
+        }
+        while (!pending_.empty())
+        {
+            write_pending_block();
+        }
+
+        // write the index of this checkpoint followed by the footer
+        std::uint64_t const index_offset = end_;
+        write_value(file_, size_);
+        write_value(file_, blocks_.size());
+        for (checkpoint_file_block const& block : blocks_)
+        {
+            write_value(file_, block.offset);
+            write_value(file_, block.stored_size);
+            write_value(file_, block.size);
+            write_value(file_, block.hash);
+            write_value(file_, block.compressed);
+        }
+
+        write_value(file_, index_offset);
+        file_.write(checkpoint_index_magic, sizeof(checkpoint_index_magic));
+
+        if (!file_.flush())
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::save_checkpoint_async",
+                "failed to write checkpoint index to file");
+        }
+        file_.close();
+
+        if (!temp_path_.empty())
+        {
+            try
+            {
+                filesystem::rename(temp_path_, file_path_);
+            }
+            catch (std::exception const& e)
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::util::save_checkpoint_async",
+                    "failed to replace checkpoint file: " + file_path_ +
+                        " (" + e.what() + ")");
+            }
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_file_reader::checkpoint_file_reader(
+        std::string const& file_path, checkpoint_file_options const& options)
+      : options_(options)
+      , file_(file_path, std::ios::in | std::ios::binary)
+      , next_block_(0)
+      , pos_(0)
+    {
+        if (!file_.is_open() || !read_checkpoint_file_index(file_, index_))
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::restore_checkpoint_from_file",
+                "not a valid checkpoint file: " + file_path);
+        }
+    }
+
+    void checkpoint_file_reader::read_block(
+        checkpoint_file_block const& block, char* dest)
+    {
+        file_.seekg(static_cast<std::streamoff>(block.offset));
+        if (!block.compressed)
+        {
+            if (!file_.read(dest, static_cast<std::streamsize>(block.size)))
+            {
+                HPX_THROW_EXCEPTION(filesystem_error,
+                    "hpx::util::restore_checkpoint_from_file",
+                    "failed to read checkpoint data from file");
+            }
+            return;
+        }
+
+        if (!options_.decompress)
+        {
+            HPX_THROW_EXCEPTION(bad_parameter,
+                "hpx::util::restore_checkpoint_from_file",
+                "the checkpoint file holds compressed data, but no "
+                "decompression function was given");
+        }
+
+        stored_.resize(block.stored_size);
+        if (!file_.read(
+                stored_.data(), static_cast<std::streamsize>(stored_.size())))
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::restore_checkpoint_from_file",
+                "failed to read checkpoint data from file");
+        }
+        options_.decompress(stored_.data(), stored_.size(), dest, block.size);
+    }
+
+    std::size_t checkpoint_file_reader::read(char* data, std::size_t size)
+    {
+        std::size_t received = 0;
+        while (received != size)
+        {
+            if (pos_ == current_.size())
+            {
+                if (next_block_ == index_.blocks.size())
+                {
+                    break;    // end of checkpoint
+                }
+
+                checkpoint_file_block const& block =
+                    index_.blocks[next_block_++];
+
+                // read whole blocks directly into the destination
+                if (size - received >= block.size)
+                {
+                    read_block(block, data + received);
+                    received += block.size;
+                    continue;
+                }
+
+                current_.resize(block.size);
+                read_block(block, current_.data());
+                pos_ = 0;
+            }
+
+            std::size_t const count =
+                (std::min)(size - received, current_.size() - pos_);
+            std::memcpy(data + received, current_.data() + pos_, count);
+            pos_ += count;
+            received += count;
+        }
+        return received;
+    }
+}}}    // namespace hpx::util::detail
@@ -0,0 +1,329 @@
+// Copyright (c) 2026 agent
+//
+// SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/checkpoint/mapped_checkpoint.hpp>
+#include <hpx/modules/errors.hpp>
+#include <hpx/topology/topology.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <ios>
+#include <string>
+#include <vector>
+
+#if defined(HPX_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace hpx { namespace util { namespace detail {
+
+    // A record file starts with a header, followed by the records. The
+    // index of the records (their number followed by the offset, the size,
+    // and the element size of each of them) is stored after the last record
+    // and is referred to by the footer at the end of the file. All numbers
+    // are stored in the native byte order.
+    constexpr char checkpoint_records_magic[8] = {
+        'H', 'P', 'X', 'C', 'K', 'R', 'E', 'C'};
+    constexpr char checkpoint_records_index_magic[8] = {
+        'H', 'P', 'X', 'C', 'K', 'R', 'I', 'X'};
+
+    constexpr std::size_t checkpoint_records_footer_size =
+        sizeof(std::uint64_t) + sizeof(checkpoint_records_index_magic);
+
+    namespace {
+
+        void write_value(std::ostream& os, std::uint64_t value)
+        {
+            os.write(reinterpret_cast<char const*>(&value), sizeof(value));
+        }
+
+        std::uint64_t read_value(char const* data) noexcept
+        {
+            std::uint64_t value;
+            std::memcpy(&value, data, sizeof(value));
+            return value;
+        }
+
+        // Parse the index of the records stored in the given (mapped) file,
+        // returns false if the data does not hold a valid checkpoint.
+        bool read_records_index(char const* data, std::size_t size,
+            std::vector<checkpoint_record>& records)
+        {
+            if (size < sizeof(checkpoint_records_magic) +
+                        checkpoint_records_footer_size ||
+                std::memcmp(data, checkpoint_records_magic,
+                    sizeof(checkpoint_records_magic)) != 0)
+            {
+                return false;
+            }
+
+            char const* footer = data + size - checkpoint_records_footer_size;
+            std::uint64_t const index_offset = read_value(footer);
+            if (std::memcmp(footer + sizeof(std::uint64_t),
+                    checkpoint_records_index_magic,
+                    sizeof(checkpoint_records_index_magic)) != 0 ||
+                index_offset > size - checkpoint_records_footer_size -
+                        sizeof(std::uint64_t))
+            {
+                return false;
+            }
+
+            constexpr std::size_t entry_size = 3 * sizeof(std::uint64_t);
+
+            char const* index = data + index_offset;
+            std::uint64_t const count = read_value(index);
+            if (count > (size - checkpoint_records_footer_size - index_offset -
+                            sizeof(std::uint64_t)) /
+                    entry_size)
+            {
+                return false;
+            }
+            index += sizeof(std::uint64_t);
+
+            records.resize(count);
+            for (checkpoint_record& record : records)
+            {
+                record.offset = read_value(index);
+                record.size = read_value(index + sizeof(std::uint64_t));
+                record.element_size =
+                    read_value(index + 2 * sizeof(std::uint64_t));
+                index += entry_size;
+
+                if (record.offset > index_offset ||
+                    record.size > index_offset - record.offset ||
+                    (record.element_size != 0 &&
+                        record.size % record.element_size != 0))
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+    }    // namespace
+
+    ///////////////////////////////////////////////////////////////////////////
+    checkpoint_record_writer::checkpoint_record_writer(
+        std::string const& file_path)
+      : file_(file_path, std::ios::out | std::ios::trunc | std::ios::binary)
+      , end_(0)
+    {
+        if (!file_.write(
+                checkpoint_records_magic, sizeof(checkpoint_records_magic)))
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::save_checkpoint_records",
+                "failed to create checkpoint file: " + file_path);
+        }
+        end_ = sizeof(checkpoint_records_magic);
+    }
+
+    void checkpoint_record_writer::begin_record()
+    {
+        // pad the file such that the record is properly aligned
+        constexpr char padding[checkpoint_record_alignment] = {};
+        std::size_t const misalignment =
+            static_cast<std::size_t>(end_ % checkpoint_record_alignment);
+        if (misalignment != 0)
+        {
+            write(padding, checkpoint_record_alignment - misalignment);
+        }
+
+        checkpoint_record record;
+        record.offset = end_;
+        records_.push_back(record);
+    }
+
+    void checkpoint_record_writer::write(char const* data, std::size_t size)
+    {
+        if (!file_.write(data, static_cast<std::streamsize>(size)))
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::save_checkpoint_records",
+                "failed to write checkpoint data to file");
+        }
+        end_ += size;
+    }
+
+    void checkpoint_record_writer::end_record(std::size_t element_size)
+    {
+        checkpoint_record& record = records_.back();
+        record.size = end_ - record.offset;
+        record.element_size = element_size;
+    }
+
+    void checkpoint_record_writer::finish()
+    {
+        // write the index of the records followed by the footer
+        std::uint64_t const index_offset = end_;
+        write_value(file_, records_.size());
+        for (checkpoint_record const& record : records_)
+        {
+            write_value(file_, record.offset);
+            write_value(file_, record.size);
+            write_value(file_, record.element_size);
+        }
+
+        write_value(file_, index_offset);
+        file_.write(checkpoint_records_index_magic,
+            sizeof(checkpoint_records_index_magic));
+
+        if (!file_.flush())
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::save_checkpoint_records",
+                "failed to write checkpoint index to file");
+        }
+        file_.close();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+#if defined(HPX_WINDOWS)
+    checkpoint_file_mapping::checkpoint_file_mapping(
+        std::string const& file_path)
+      : data_(nullptr)
+      , size_(0)
+      , mapping_(nullptr)
+    {
+        HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ,
+            FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+            nullptr);
+
+        LARGE_INTEGER file_size;
+        if (file == INVALID_HANDLE_VALUE || !GetFileSizeEx(file, &file_size) ||
+            file_size.QuadPart == 0)
+        {
+            if (file != INVALID_HANDLE_VALUE)
+                CloseHandle(file);
+
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::mapped_checkpoint",
+                "failed to open checkpoint file: " + file_path);
+        }
+        size_ = static_cast<std::size_t>(file_size.QuadPart);
+
+        // the mapping keeps the file open
+        mapping_ =
+            CreateFileMappingA(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+
+        if (mapping_ != nullptr)
+        {
+            data_ = static_cast<char*>(
+                MapViewOfFile(mapping_, FILE_MAP_COPY, 0, 0, size_));
+        }
+
+        if (data_ == nullptr)
+        {
+            if (mapping_ != nullptr)
+                CloseHandle(mapping_);
+
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::mapped_checkpoint",
+                "failed to map checkpoint file: " + file_path);
+        }
+
+        if (!read_records_index(data_, size_, records_))
+        {
+            UnmapViewOfFile(data_);
+            CloseHandle(mapping_);
+
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::mapped_checkpoint",
+                "not a valid checkpoint file: " + file_path);
+        }
+    }
+
+    checkpoint_file_mapping::~checkpoint_file_mapping()
+    {
+        UnmapViewOfFile(data_);
+        CloseHandle(mapping_);
+    }
+
+    void checkpoint_file_mapping::prefetch(
+        std::size_t offset, std::size_t size) const noexcept
+    {
+#if defined(_WIN32_WINNT) && _WIN32_WINNT >= 0x0602
+        WIN32_MEMORY_RANGE_ENTRY range;
+        range.VirtualAddress = data_ + offset;
+        range.NumberOfBytes = size;
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+#else
+        HPX_UNUSED(offset);
+        HPX_UNUSED(size);
+#endif
+    }
+#else
+    checkpoint_file_mapping::checkpoint_file_mapping(
+        std::string const& file_path)
+      : data_(nullptr)
+      , size_(0)
+    {
+        int const fd = ::open(file_path.c_str(), O_RDONLY);
+
+        struct stat st;
+        if (fd == -1 || ::fstat(fd, &st) != 0 || st.st_size == 0)
+        {
+            if (fd != -1)
+                ::close(fd);
+
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::mapped_checkpoint",
+                "failed to open checkpoint file: " + file_path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+
+        // the mapping keeps the file open
+        void* data = ::mmap(
+            nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+
+        if (data == MAP_FAILED)
+        {
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::mapped_checkpoint",
+                "failed to map checkpoint file: " + file_path);
+        }
+        data_ = static_cast<char*>(data);
+
+        if (!read_records_index(data_, size_, records_))
+        {
+            ::munmap(data_, size_);
+
+            HPX_THROW_EXCEPTION(filesystem_error,
+                "hpx::util::mapped_checkpoint",
+                "not a valid checkpoint file: " + file_path);
+        }
+    }
+
+    checkpoint_file_mapping::~checkpoint_file_mapping()
+    {
+        ::munmap(data_, size_);
+    }
+
+    void checkpoint_file_mapping::prefetch(
+        std::size_t offset, std::size_t size) const noexcept
+    {
+        if (size == 0)
+        {
+            return;
+        }
+
+        // the advice has to be given for whole pages
+        std::size_t const page_size = hpx::threads::get_memory_page_size();
+        std::size_t const begin = offset - offset % page_size;
+        ::posix_madvise(
+            data_ + begin, offset + size - begin, POSIX_MADV_WILLNEED);
+    }
+#endif
+}}}    // namespace hpx::util::detail
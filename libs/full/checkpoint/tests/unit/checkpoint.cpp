@@ -14,6 +14,7 @@
 #include <hpx/modules/testing.hpp>
 
 #include <fstream>
+#include <sstream>
 #include <string>
 #include <utility>
 #include <vector>
@@ -21,7 +22,9 @@
 using hpx::util::checkpoint;
 using hpx::util::prepare_checkpoint;
 using hpx::util::restore_checkpoint;
+using hpx::util::restore_checkpoint_from;
 using hpx::util::save_checkpoint;
+using hpx::util::save_checkpoint_to;
 
 // Main
 int main()
@@ -233,6 +236,60 @@ int main()
     // Cleanup
     std::remove("test_file_10.txt");
 
+    // Test 11
+    //  test streaming checkpoints directly to/from a file
+    std::vector<double> vec11(100000, 3.14);
+    std::string str11 = "I am streamed";
+    {
+        std::ofstream test_file_11("test_file_11.txt", std::ios::binary);
+        save_checkpoint_to(test_file_11, vec11, str11).get();
+    }
+
+    {
+        std::vector<double> vec11_1;
+        std::string str11_1;
+        std::ifstream test_file_11_1("test_file_11.txt", std::ios::binary);
+        restore_checkpoint_from(test_file_11_1, vec11_1, str11_1);
+
+        HPX_TEST(vec11 == vec11_1);
+        HPX_TEST_EQ(str11, str11_1);
+    }
+
+    {
+        // the streamed data is compatible with operator>>
+        std::vector<double> vec11_2;
+        std::string str11_2;
+        checkpoint archive11;
+        std::ifstream test_file_11_2("test_file_11.txt", std::ios::binary);
+        test_file_11_2 >> archive11;
+        restore_checkpoint(archive11, vec11_2, str11_2);
+
+        HPX_TEST(vec11 == vec11_2);
+        HPX_TEST_EQ(str11, str11_2);
+    }
+
+    // Cleanup
+    std::remove("test_file_11.txt");
+
+    // streams not starting with a valid checkpoint size are rejected
+    for (std::string const& data : {std::string("abc"),
+             std::string("\xff\xff\xff\xff\xff\xff\xff\xff", 8)})
+    {
+        bool caught_exception = false;
+        try
+        {
+            std::vector<double> vec11_3;
+            std::istringstream test_stream_11(data);
+            restore_checkpoint_from(test_stream_11, vec11_3);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
     // test nullary versions of the API
     {
         hpx::future<checkpoint> f = save_checkpoint();
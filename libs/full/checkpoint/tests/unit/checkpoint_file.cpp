@@ -0,0 +1,372 @@
+// Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint_async and
+// restore_checkpoint_from_file.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <vector>
+
+using hpx::util::checkpoint_file_options;
+using hpx::util::restore_checkpoint_from_file;
+using hpx::util::save_checkpoint_async;
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t file_size(std::string const& file_path)
+{
+    std::ifstream file(file_path, std::ios::binary | std::ios::ate);
+    return static_cast<std::size_t>(file.tellg());
+}
+
+// A simple run-length encoding used to test the compression of blocks
+std::vector<char> compress_rle(char const* data, std::size_t size)
+{
+    std::vector<char> result;
+    for (std::size_t i = 0; i != size; /**/)
+    {
+        std::size_t run = 1;
+        while (i + run != size && run != 255 && data[i + run] == data[i])
+        {
+            ++run;
+        }
+        result.push_back(static_cast<char>(run));
+        result.push_back(data[i]);
+        i += run;
+    }
+    return result;
+}
+
+void decompress_rle(
+    char const* data, std::size_t size, char* dest, std::size_t dest_size)
+{
+    std::size_t pos = 0;
+    for (std::size_t i = 0; i + 1 < size; i += 2)
+    {
+        std::size_t run = static_cast<unsigned char>(data[i]);
+        HPX_TEST(pos + run <= dest_size);
+        for (std::size_t j = 0; j != run && pos != dest_size; ++j)
+        {
+            dest[pos++] = data[i + 1];
+        }
+    }
+    HPX_TEST_EQ(pos, dest_size);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_save_restore()
+{
+    std::string const file_path = "test_checkpoint_file_1.ckp";
+
+    std::vector<int> vec(100000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<int>(i);
+    }
+    std::string str = "I am a string of characters";
+    double dbl = 42.0;
+
+    checkpoint_file_options options;
+    options.block_size = 4096;
+
+    save_checkpoint_async(file_path, options, vec, str, dbl).get();
+
+    {
+        std::vector<int> vec1;
+        std::string str1;
+        double dbl1 = 0.0;
+        restore_checkpoint_from_file(file_path, vec1, str1, dbl1);
+
+        HPX_TEST(vec == vec1);
+        HPX_TEST_EQ(str, str1);
+        HPX_TEST_EQ(dbl, dbl1);
+    }
+
+    // the default options, objects passed by reference
+    save_checkpoint_async(file_path, std::ref(vec), std::cref(str)).get();
+
+    {
+        std::vector<int> vec1;
+        std::string str1;
+        restore_checkpoint_from_file(file_path, vec1, str1);
+
+        HPX_TEST(vec == vec1);
+        HPX_TEST_EQ(str, str1);
+    }
+
+    // empty checkpoint data
+    save_checkpoint_async(file_path, std::vector<int>()).get();
+
+    {
+        std::vector<int> vec1(10);
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(vec1.empty());
+    }
+
+    std::remove(file_path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_incremental()
+{
+    std::string const file_path = "test_checkpoint_file_2.ckp";
+
+    std::vector<double> vec(100000, 1.0);
+
+    checkpoint_file_options options;
+    options.incremental = true;
+    options.block_size = 4096;
+
+    // the file does not exist yet, this writes a full checkpoint
+    std::remove(file_path.c_str());
+    save_checkpoint_async(file_path, options, vec).get();
+
+    std::size_t const full_size = file_size(file_path);
+    HPX_TEST_LT(vec.size() * sizeof(double), full_size);
+
+    // modify a single block, only this block is appended to the file
+    vec[vec.size() / 2] = 2.0;
+    save_checkpoint_async(file_path, options, vec).get();
+
+    std::size_t const incremental_size = file_size(file_path) - full_size;
+    HPX_TEST_LT(incremental_size, full_size / 2);
+
+    {
+        std::vector<double> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    // growing the data appends the new blocks (and the first block, as it
+    // holds the size of the vector)
+    vec.resize(150000, 3.0);
+    save_checkpoint_async(file_path, options, vec).get();
+
+    {
+        std::vector<double> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    // shrinking the data writes the first and the last (partial) block only
+    vec.resize(50000);
+    save_checkpoint_async(file_path, options, vec).get();
+
+    {
+        std::vector<double> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    // a full checkpoint replaces the file
+    options.incremental = false;
+    save_checkpoint_async(file_path, options, vec).get();
+    HPX_TEST_LT(file_size(file_path), full_size);
+
+    {
+        std::vector<double> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    std::remove(file_path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+std::string read_file(std::string const& file_path)
+{
+    std::ifstream file(file_path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file),
+        std::istreambuf_iterator<char>());
+}
+
+void write_file(std::string const& file_path, std::string const& data)
+{
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    file.write(data.data(), static_cast<std::streamsize>(data.size()));
+}
+
+void test_interrupted_save()
+{
+    std::string const file_path = "test_checkpoint_file_5.ckp";
+
+    std::vector<double> vec(100000, 1.0);
+
+    checkpoint_file_options options;
+    options.incremental = true;
+    options.block_size = 4096;
+
+    std::remove(file_path.c_str());
+    save_checkpoint_async(file_path, options, vec).get();
+
+    // full checkpoints are moved into place once they are complete
+    HPX_TEST(!std::ifstream(file_path + ".tmp").is_open());
+
+    std::vector<double> const saved = vec;
+    std::size_t const saved_size = file_size(file_path);
+
+    vec[vec.size() / 2] = 2.0;
+    save_checkpoint_async(file_path, options, vec).get();
+
+    // cut off the end of the incremental checkpoint as if saving it was
+    // interrupted, this restores the checkpoint stored before
+    std::string const data = read_file(file_path);
+    for (std::size_t cut : {std::size_t(1), std::size_t(24),
+             (data.size() - saved_size) / 2, data.size() - saved_size - 1})
+    {
+        write_file(file_path, data.substr(0, data.size() - cut));
+
+        std::vector<double> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(saved == vec1);
+    }
+
+    // the next incremental checkpoint is appended after the incomplete one
+    save_checkpoint_async(file_path, options, vec).get();
+
+    {
+        std::vector<double> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    std::remove(file_path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_compression()
+{
+    std::string const file_path = "test_checkpoint_file_3.ckp";
+
+    std::vector<std::int64_t> vec(100000, 0);
+    for (std::size_t i = 0; i != vec.size(); i += 1000)
+    {
+        vec[i] = static_cast<std::int64_t>(i);
+    }
+
+    checkpoint_file_options options;
+    options.block_size = 8192;
+    options.max_blocks_in_flight = 4;
+    options.compress = &compress_rle;
+    options.decompress = &decompress_rle;
+
+    save_checkpoint_async(file_path, options, vec).get();
+    HPX_TEST_LT(file_size(file_path), vec.size() * sizeof(std::int64_t) / 4);
+
+    {
+        std::vector<std::int64_t> vec1;
+        restore_checkpoint_from_file(file_path, options, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    // the compressed data can't be restored without decompression
+    {
+        bool caught_exception = false;
+        try
+        {
+            std::vector<std::int64_t> vec1;
+            restore_checkpoint_from_file(file_path, vec1);
+        }
+        catch (hpx::exception const& e)
+        {
+            HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+            caught_exception = true;
+        }
+        HPX_TEST(caught_exception);
+    }
+
+    std::remove(file_path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_invalid_file()
+{
+    std::string const file_path = "test_checkpoint_file_4.ckp";
+
+    {
+        std::ofstream file(file_path, std::ios::binary);
+        file << "this is not a checkpoint file";
+    }
+
+    bool caught_exception = false;
+    try
+    {
+        std::vector<int> vec;
+        restore_checkpoint_from_file(file_path, vec);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    // an incremental checkpoint overwrites files not holding a checkpoint
+    checkpoint_file_options options;
+    options.incremental = true;
+
+    std::vector<int> vec(1000, 42);
+    save_checkpoint_async(file_path, options, vec).get();
+
+    {
+        std::vector<int> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    // the sizes of the blocks stored in the index have to be consistent
+    options.incremental = false;
+    save_checkpoint_async(file_path, options, vec).get();
+
+    std::string data = read_file(file_path);
+
+    std::uint64_t index_offset = 0;
+    std::memcpy(&index_offset, data.data() + data.size() - 16, 8);
+
+    // the size of the first block (see the index layout in
+    // checkpoint_file.cpp)
+    std::uint64_t const block_size = std::uint64_t(1) << 62;
+    std::memcpy(&data[index_offset + 32], &block_size, 8);
+    write_file(file_path, data);
+
+    caught_exception = false;
+    try
+    {
+        std::vector<int> vec1;
+        restore_checkpoint_from_file(file_path, vec1);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::filesystem_error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    std::remove(file_path.c_str());
+}
+
+int main()
+{
+    test_save_restore();
+    test_incremental();
+    test_interrupted_save();
+    test_compression();
+    test_invalid_file();
+
+    return hpx::util::report_errors();
+}
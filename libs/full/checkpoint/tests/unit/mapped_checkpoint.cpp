@@ -0,0 +1,204 @@
+// Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This example tests the functionality of save_checkpoint_records,
+// mapped_checkpoint, and restore_checkpoint_records.
+//
+
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/modules/checkpoint.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
+
+using hpx::util::mapped_checkpoint;
+using hpx::util::restore_checkpoint_records;
+using hpx::util::save_checkpoint_records;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_restore_records()
+{
+    std::string const file_path = "test_mapped_checkpoint_1.ckp";
+
+    std::vector<double> vec(100000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<double>(i);
+    }
+    std::string str = "I am a string of characters";
+    std::map<int, std::string> m = {{1, "one"}, {2, "two"}};
+    int i = 42;
+
+    save_checkpoint_records(file_path, std::cref(vec), str, m, i).get();
+
+    mapped_checkpoint const checkpoint(file_path);
+    HPX_TEST_EQ(checkpoint.size(), std::size_t(4));
+
+    HPX_TEST(checkpoint.is_array(0));
+    HPX_TEST(!checkpoint.is_array(1));
+    HPX_TEST_EQ(checkpoint.record_size(0), vec.size() * sizeof(double));
+
+    // records can be restored in any order
+    {
+        std::map<int, std::string> m1;
+        checkpoint.restore(2, m1);
+        HPX_TEST(m == m1);
+
+        int i1 = 0;
+        checkpoint.restore(3, i1);
+        HPX_TEST_EQ(i, i1);
+
+        std::string str1;
+        checkpoint.restore(1, str1);
+        HPX_TEST_EQ(str, str1);
+
+        checkpoint.prefetch(0);
+
+        std::vector<double> vec1;
+        checkpoint.restore(0, vec1);
+        HPX_TEST(vec == vec1);
+    }
+
+    {
+        std::vector<double> vec1;
+        std::string str1;
+        std::map<int, std::string> m1;
+        int i1 = 0;
+        restore_checkpoint_records(file_path, vec1, str1, m1, i1);
+
+        HPX_TEST(vec == vec1);
+        HPX_TEST_EQ(str, str1);
+        HPX_TEST(m == m1);
+        HPX_TEST_EQ(i, i1);
+    }
+
+    std::remove(file_path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void test_zero_copy_array()
+{
+    std::string const file_path = "test_mapped_checkpoint_2.ckp";
+
+    std::vector<char> chars = {'a', 'b', 'c'};
+    std::vector<int> vec(100000);
+    for (std::size_t i = 0; i != vec.size(); ++i)
+    {
+        vec[i] = static_cast<int>(i);
+    }
+
+    save_checkpoint_records(file_path, chars, vec, std::vector<int>()).get();
+
+    {
+        hpx::serialization::serialize_buffer<int> data;
+
+        {
+            mapped_checkpoint const checkpoint(file_path);
+            data = checkpoint.array<int>(1);
+
+            HPX_TEST(checkpoint.array<int>(2).size() == 0);
+        }
+
+        // the buffer keeps the mapping alive
+        HPX_TEST_EQ(data.size(), vec.size());
+        for (std::size_t i = 0; i != vec.size(); ++i)
+        {
+            HPX_TEST_EQ(data[i], vec[i]);
+        }
+
+        // modifying the data does not change the file
+        data[0] = -1;
+    }
+
+    {
+        mapped_checkpoint const checkpoint(file_path);
+        HPX_TEST_EQ(checkpoint.array<int>(1)[0], 0);
+
+        hpx::serialization::serialize_buffer<char> data =
+            checkpoint.array<char>(0);
+        HPX_TEST_EQ(data.size(), chars.size());
+        HPX_TEST_EQ(data[2], 'c');
+    }
+
+    std::remove(file_path.c_str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+void test_throws(F&& f, hpx::error error)
+{
+    bool caught_exception = false;
+    try
+    {
+        f();
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), error);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+}
+
+void test_errors()
+{
+    std::string const file_path = "test_mapped_checkpoint_3.ckp";
+
+    {
+        std::ofstream file(file_path, std::ios::binary);
+        file << "this is not a checkpoint file";
+    }
+
+    test_throws([&] { mapped_checkpoint checkpoint(file_path); },
+        hpx::filesystem_error);
+
+    std::vector<int> vec(1000, 42);
+    std::string str = "I am a string of characters";
+    save_checkpoint_records(file_path, vec, str).get();
+
+    mapped_checkpoint const checkpoint(file_path);
+
+    // the record does not exist
+    test_throws(
+        [&] {
+            int i = 0;
+            checkpoint.restore(2, i);
+        },
+        hpx::bad_parameter);
+
+    // the records hold different types
+    test_throws(
+        [&] {
+            std::string str1;
+            checkpoint.restore(0, str1);
+        },
+        hpx::bad_parameter);
+    test_throws(
+        [&] {
+            std::vector<double> vec1;
+            checkpoint.restore(0, vec1);
+        },
+        hpx::bad_parameter);
+    test_throws([&] { checkpoint.array<int>(1); }, hpx::bad_parameter);
+
+    std::remove(file_path.c_str());
+}
+
+int main()
+{
+    test_restore_records();
+    test_zero_copy_array();
+    test_errors();
+
+    return hpx::util::report_errors();
+}
@@ -105,6 +105,43 @@ namespace hpx { namespace collectives {
     all_gather(communicator comm, T&& result,
         generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllGather a set of values from different call sites
+    ///
+    /// This function exchanges the values directly between the sites of the
+    /// given channel communicator instead of collecting them on a single
+    /// site. Small values are exchanged using recursive doubling (log(N)
+    /// steps, if the number of sites is a power of two), large values are
+    /// forwarded around a ring of all sites.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_gather operation performed on the
+    ///                     given communicator. This is optional, if not given
+    ///                     the communicator counts the invocations itself.
+    ///                     The generation number (if given) must be a positive
+    ///                     number greater than zero.
+    /// \param  algorithm   The algorithm to use (default: selected based on
+    ///                     the number of sites and the size of the values,
+    ///                     see hpx.lcos.collectives.ring_threshold).
+    ///
+    /// \returns    This function returns a future holding a vector with all
+    ///             values send by all participating sites. It will become
+    ///             ready once the all_gather operation has been completed.
+    ///
+    /// \note       The messages exchanged by this operation use tags derived
+    ///             from the generation number. Those should not be mixed
+    ///             with explicit calls to \a set and \a get on the same
+    ///             communicator.
+    ///
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>>
+    all_gather(channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -117,7 +154,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/type_support/unused.hpp>
@@ -210,6 +249,37 @@ namespace hpx { namespace collectives {
             HPX_MOVE(fid), HPX_FORWARD(T, local_result), this_site, generation);
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    // all_gather on a channel communicator, no central site involved
+    template <typename T>
+    hpx::future<std::vector<std::decay_t<T>>> all_gather(
+        channel_communicator comm, T&& local_result,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<std::vector<arg_type>>(
+                HPX_GET_EXCEPTION(hpx::bad_parameter,
+                    "hpx::collectives::all_gather",
+                    "the generation number shouldn't be zero"));
+        }
+        if (generation == std::size_t(-1))
+        {
+            generation = comm.next_generation();
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              generation,
+                              algorithm]() mutable -> std::vector<arg_type> {
+            return detail::all_gather(
+                comm, HPX_MOVE(local_result), generation, algorithm);
+        });
+    }
+
     template <typename T>
     hpx::future<std::vector<std::decay_t<T>>> all_gather(char const* basename,
         T&& local_result, num_sites_arg num_sites = num_sites_arg(),
@@ -110,6 +110,54 @@ namespace hpx { namespace collectives {
     all_reduce(communicator comm,
         T&& result, F&& op, generation_arg generation,
         this_site_arg this_site = this_site_arg());
+
+    /// AllReduce a set of values from different call sites
+    ///
+    /// This function exchanges the values directly between the sites of the
+    /// given channel communicator instead of collecting them on a single
+    /// site. Small values are combined using recursive doubling (log(N)
+    /// steps), large vectors are split into segments which are reduced using
+    /// a ring based reduce-scatter followed by an all-gather. Vectors of
+    /// trivially copyable elements are additionally split into pipeline
+    /// segments (see hpx.lcos.collectives.segment_size) which are sent
+    /// without copying the data and reduced while the next segments are
+    /// still being communicated.
+    ///
+    /// \param  comm        A channel communicator object returned from
+    ///                     \a create_channel_communicator
+    /// \param  local_result The value to transmit to all
+    ///                     participating sites from this call site.
+    /// \param  op          Reduction operation to apply to all values supplied
+    ///                     from all participating sites. The ring algorithm
+    ///                     applies the operation to the elements of the
+    ///                     vectors, in which case the operation has to be
+    ///                     commutative. The segmented ring algorithm
+    ///                     applies the operation using a parallel unsequenced
+    ///                     execution policy.
+    /// \param  generation  The generational counter identifying the sequence
+    ///                     number of the all_reduce operation performed on the
+    ///                     given communicator. This is optional, if not given
+    ///                     the communicator counts the invocations itself.
+    ///                     The generation number (if given) must be a positive
+    ///                     number greater than zero.
+    /// \param  algorithm   The algorithm to use (default: selected based on
+    ///                     the number of sites and the size of the value,
+    ///                     see hpx.lcos.collectives.ring_threshold).
+    ///
+    /// \returns    This function returns a future holding the reduced value.
+    ///             It will become ready once the all_reduce operation has
+    ///             been completed.
+    ///
+    /// \note       The messages exchanged by this operation use tags derived
+    ///             from the generation number. Those should not be mixed
+    ///             with explicit calls to \a set and \a get on the same
+    ///             communicator.
+    ///
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>>
+    all_reduce(channel_communicator comm, T&& local_result, F&& op,
+        generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic);
 }}    // namespace hpx::collectives
 
 // clang-format on
@@ -123,7 +171,9 @@ namespace hpx { namespace collectives {
 #include <hpx/async_base/launch_policy.hpp>
 #include <hpx/async_distributed/async.hpp>
 #include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/create_communicator.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/parallel/algorithms/reduce.hpp>
@@ -229,6 +279,35 @@ namespace hpx { namespace collectives {
             HPX_FORWARD(F, op), this_site, generation);
     }
 
+    ////////////////////////////////////////////////////////////////////////////
+    // all_reduce on a channel communicator, no central site involved
+    template <typename T, typename F>
+    hpx::future<std::decay_t<T>> all_reduce(channel_communicator comm,
+        T&& local_result, F&& op, generation_arg generation = generation_arg(),
+        collective_algorithm algorithm = collective_algorithm::automatic)
+    {
+        using arg_type = std::decay_t<T>;
+
+        if (generation == 0)
+        {
+            return hpx::make_exceptional_future<arg_type>(HPX_GET_EXCEPTION(
+                hpx::bad_parameter, "hpx::collectives::all_reduce",
+                "the generation number shouldn't be zero"));
+        }
+        if (generation == std::size_t(-1))
+        {
+            generation = comm.next_generation();
+        }
+
+        return hpx::async([comm = HPX_MOVE(comm),
+                              local_result = HPX_FORWARD(T, local_result),
+                              op = HPX_FORWARD(F, op), generation,
+                              algorithm]() mutable -> arg_type {
+            return detail::all_reduce(
+                comm, HPX_MOVE(local_result), op, generation, algorithm);
+        });
+    }
+
     template <typename T, typename F>
     hpx::future<std::decay_t<T>> all_reduce(char const* basename,
         T&& local_result, F&& op, num_sites_arg num_sites = num_sites_arg(),
@@ -145,4 +145,15 @@ namespace hpx { namespace collectives {
 
         std::size_t tag_;
     };
+
+    /// The algorithms available for the collective operations performed on a
+    /// \a channel_communicator. By default, the algorithm is selected based
+    /// on the number of sites and the size of the exchanged data.
+    enum class collective_algorithm
+    {
+        automatic,             ///< select based on the message size
+        recursive_doubling,    ///< log(N) steps, for small messages
+        ring,                  ///< 2(N-1) steps, for large messages
+        segmented_ring         ///< ring, pipelining segments of large vectors
+    };
 }}    // namespace hpx::collectives
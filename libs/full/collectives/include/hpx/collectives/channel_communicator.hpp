@@ -58,6 +58,56 @@ namespace hpx { namespace collectives {
         num_sites_arg num_sites = num_sites_arg(),
         this_site_arg this_site = this_site_arg());
 
+    /// Create a new persistent communicator object usable with peer-to-peer
+    /// channel-based operations
+    ///
+    /// A persistent communicator is meant for collective operations that are
+    /// invoked many times (for instance in iterative solvers). It resolves
+    /// the addresses of all peers once while it is created and preallocates
+    /// the channels for the given number of generations. The operations
+    /// performed on it don't have to look up any addresses and don't
+    /// allocate channels as long as no more than \a generations operations
+    /// are in flight concurrently.
+    ///
+    /// \param basename     The base name identifying the collective operation
+    /// \param num_sites    The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param generations  The number of generations to preallocate the
+    ///                     channels for (default: 2).
+    ///
+    /// \returns    This function returns a future to a new communicator object
+    ///             usable with the collective operation.
+    ///
+    hpx::future<channel_communicator> create_persistent_channel_communicator(
+        char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::size_t generations = 2);
+
+    /// Create a new persistent communicator object usable with peer-to-peer
+    /// channel-based operations
+    ///
+    /// \param basename     The base name identifying the collective operation
+    /// \param num_sites    The number of participating sites (default: all
+    ///                     localities).
+    /// \param this_site    The sequence number of this invocation (usually
+    ///                     the locality id). This value is optional and
+    ///                     defaults to whatever hpx::get_locality_id() returns.
+    /// \param generations  The number of generations to preallocate the
+    ///                     channels for (default: 2).
+    ///
+    /// \returns    This function returns a new communicator object usable
+    ///             with the collective operation.
+    ///
+    channel_communicator create_persistent_channel_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::size_t generations = 2);
+
     /// Send a value to the given site
     ///
     /// This function sends a value to the given site based on the given
@@ -135,6 +185,11 @@ namespace hpx { namespace collectives {
         create_channel_communicator(char const* basename,
             num_sites_arg num_sites, this_site_arg this_site);
 
+        friend HPX_EXPORT hpx::future<channel_communicator>
+        create_persistent_channel_communicator(char const* basename,
+            num_sites_arg num_sites, this_site_arg this_site,
+            std::size_t generations);
+
         template <typename T>
         friend hpx::future<T> get(channel_communicator, that_site_arg, tag_arg);
 
@@ -145,7 +200,8 @@ namespace hpx { namespace collectives {
     private:
         HPX_EXPORT channel_communicator(char const* basename,
             num_sites_arg num_sites, this_site_arg this_site,
-            components::client<detail::channel_communicator_server>&& here);
+            components::client<detail::channel_communicator_server>&& here,
+            std::size_t generations = 0);
 
     public:
         HPX_EXPORT channel_communicator();
@@ -160,6 +216,15 @@ namespace hpx { namespace collectives {
 
         HPX_EXPORT void free();
 
+        /// \cond NOINTERNAL
+        // return the number of sites and the index of this site
+        HPX_EXPORT std::pair<std::size_t, std::size_t> get_info() const;
+
+        // return the generation to use for the next collective operation
+        // that was invoked without an explicit generation
+        HPX_EXPORT std::size_t next_generation();
+        /// \endcond
+
     private:
         std::shared_ptr<detail::channel_communicator> comm_;
     };
@@ -174,6 +239,18 @@ namespace hpx { namespace collectives {
         num_sites_arg num_sites = num_sites_arg(),
         this_site_arg this_site = this_site_arg());
 
+    HPX_EXPORT hpx::future<channel_communicator>
+    create_persistent_channel_communicator(char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::size_t generations = 2);
+
+    HPX_EXPORT channel_communicator create_persistent_channel_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites = num_sites_arg(),
+        this_site_arg this_site = this_site_arg(),
+        std::size_t generations = 2);
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename T>
     hpx::future<T> get(
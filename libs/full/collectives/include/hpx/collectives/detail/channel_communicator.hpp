@@ -12,23 +12,39 @@
 
 #include <hpx/actions_base/component_action.hpp>
 #include <hpx/assert.hpp>
+#include <hpx/async_distributed/detail/async_implementations.hpp>
 #include <hpx/components/client.hpp>
 #include <hpx/components_base/server/component_base.hpp>
 #include <hpx/datastructures/any.hpp>
 #include <hpx/futures/future.hpp>
 #include <hpx/lcos_local/channel.hpp>
 #include <hpx/lock_registration/detail/register_locks.hpp>
+#include <hpx/naming_base/address.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <exception>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
 
 namespace hpx { namespace collectives { namespace detail {
 
+    ///////////////////////////////////////////////////////////////////////////
+    // The tags used by the collective operations hold the generation in the
+    // upper half of the bits and the step of the operation in the lower half
+    // of the bits.
+    inline constexpr std::size_t collective_tag_bits = sizeof(std::size_t) * 4;
+
+    // The maximal number of segments a large value is split into when it is
+    // pipelined through a ring of sites. The segments of one operation use
+    // disjoint ranges of 2 * num_sites steps each.
+    inline constexpr std::size_t max_pipelined_segments = 8;
+
     ///////////////////////////////////////////////////////////////////////////
     class channel_communicator_server
       : public hpx::components::component_base<channel_communicator_server>
@@ -40,12 +56,24 @@ namespace hpx { namespace collectives { namespace detail {
     public:
         channel_communicator_server()    //-V730
           : data_()
+          , generations_(0)
+          , steps_(0)
         {
             HPX_ASSERT(false);    // shouldn't ever be called
         }
 
-        explicit channel_communicator_server(std::size_t num_sites)
+        // A persistent communicator preallocates the channels for the given
+        // number of generations, each with the given number of steps, for
+        // each site it receives messages from. The channels for a site are
+        // allocated when the first message from that site arrives, as most
+        // algorithms receive from a few of the sites only. Messages that
+        // don't fit into the preallocated channels fall back to dynamically
+        // allocated ones.
+        explicit channel_communicator_server(std::size_t num_sites,
+            std::size_t generations = 0, std::size_t steps = 0)
           : data_(num_sites)
+          , generations_(generations)
+          , steps_(steps)
         {
             HPX_ASSERT(num_sites != 0);
         }
@@ -60,12 +88,16 @@ namespace hpx { namespace collectives { namespace detail {
                 util::ignore_while_checking il(&l);
                 HPX_UNUSED(il);
 
-                channel_type& c = data_[which].channels_[tag];
-                f = c.get();
+                channel_data& c = find_channel(data_[which], tag);
+                ++c.pending_;
+                f = c.channel_.get();
             }
 
-            return f.then(
-                hpx::launch::sync, [](hpx::future<unique_any_nonser>&& f) -> T {
+            // the value has been consumed, release the share of the get and
+            // the share of the value
+            return f.then(hpx::launch::sync,
+                [this, which, tag](hpx::future<unique_any_nonser>&& f) -> T {
+                    release_channel(which, tag, 2);
                     return hpx::any_cast<T const&>(f.get());
                 });
         }
@@ -83,11 +115,33 @@ namespace hpx { namespace collectives { namespace detail {
         template <typename T>
         void set(std::size_t which, T value, std::size_t tag)
         {
-            std::unique_lock l(data_[which].mtx_);
-            util::ignore_while_checking il(&l);
-            HPX_UNUSED(il);
+            channel_data* c = nullptr;
+
+            {
+                std::unique_lock l(data_[which].mtx_);
+                util::ignore_while_checking il(&l);
+                HPX_UNUSED(il);
 
-            data_[which].channels_[tag].set(HPX_MOVE(value));
+                // one share for the value (released once it is consumed)
+                // and one share for this call
+                c = &find_channel(data_[which], tag);
+                c->pending_ += 2;
+            }
+
+            // Setting the value may run the continuation of a pending get
+            // inline, which releases its shares of the channel. The lock
+            // must not be held here. The share of this call keeps the
+            // channel alive until the channel has returned from set.
+            try
+            {
+                c->channel_.set(HPX_MOVE(value));
+            }
+            catch (...)
+            {
+                release_channel(which, tag, 1);
+                throw;
+            }
+            release_channel(which, tag, 1);
         }
 
         template <typename T>
@@ -100,13 +154,98 @@ namespace hpx { namespace collectives { namespace detail {
         };
 
     private:
+        struct channel_data
+        {
+            channel_type channel_;
+            std::size_t tag_ = std::size_t(-1);
+            // number of outstanding shares: each get holds one until its
+            // value has been delivered, each set holds one until it has
+            // returned and one for its value until that has been consumed
+            std::size_t pending_ = 0;
+        };
+
         struct locality_data
         {
             hpx::spinlock mtx_;
-            std::map<std::size_t, channel_type> channels_;
+            std::map<std::size_t, channel_data> channels_;
+            std::vector<channel_data> slots_;
         };
 
+        std::size_t slot_index(std::size_t tag) const noexcept
+        {
+            std::size_t const step =
+                tag & ((std::size_t(1) << collective_tag_bits) - 1);
+            if (generations_ == 0 || step >= steps_)
+            {
+                return std::size_t(-1);
+            }
+            return ((tag >> collective_tag_bits) % generations_) * steps_ +
+                step;
+        }
+
+        // A tag is handled by the preallocated channel it maps to as long as
+        // that is not in use for a different tag.
+        channel_data& find_channel(locality_data& data, std::size_t tag) const
+        {
+            auto it = data.channels_.find(tag);
+            if (it != data.channels_.end())
+            {
+                return it->second;
+            }
+
+            std::size_t const index = slot_index(tag);
+            if (index != std::size_t(-1))
+            {
+                if (data.slots_.empty())
+                {
+                    data.slots_ =
+                        std::vector<channel_data>(generations_ * steps_);
+                }
+
+                channel_data& slot = data.slots_[index];
+                if (slot.pending_ == 0 || slot.tag_ == tag)
+                {
+                    slot.tag_ = tag;
+                    return slot;
+                }
+            }
+
+            channel_data& c = data.channels_[tag];
+            c.tag_ = tag;
+            return c;
+        }
+
+        // Release the given number of shares, the channel is released once
+        // there are no outstanding shares left.
+        void release_channel(
+            std::size_t which, std::size_t tag, std::size_t shares) const
+        {
+            locality_data& data = data_[which];
+
+            std::unique_lock l(data.mtx_);
+            util::ignore_while_checking il(&l);
+            HPX_UNUSED(il);
+
+            auto it = data.channels_.find(tag);
+            if (it != data.channels_.end())
+            {
+                HPX_ASSERT(it->second.pending_ >= shares);
+                it->second.pending_ -= shares;
+                if (it->second.pending_ == 0)
+                {
+                    data.channels_.erase(it);
+                }
+                return;
+            }
+
+            channel_data& slot = data.slots_[slot_index(tag)];
+            HPX_ASSERT(slot.tag_ == tag && slot.pending_ >= shares);
+            slot.pending_ -= shares;
+        }
+
         mutable std::vector<locality_data> data_;
+        std::size_t const generations_;
+        std::size_t const steps_;
     };
 
     ///////////////////////////////////////////////////////////////////////////
@@ -124,12 +263,20 @@ namespace hpx { namespace collectives { namespace detail {
             channel_communicator&& rhs) noexcept = delete;
 
     public:
+        // A persistent communicator (generations != 0) resolves the peer
+        // addresses once during construction.
         HPX_EXPORT channel_communicator(char const* basename,
-            std::size_t num_sites, std::size_t this_site, client_type here);
+            std::size_t num_sites, std::size_t this_site, client_type here,
+            std::size_t generations = 0);
 
         template <typename T>
         hpx::future<T> get(std::size_t site, std::size_t tag) const
         {
+            if (!servers_.empty())
+            {
+                return servers_[this_site_]->template get<T>(site, tag);
+            }
+
             // all get operations refer to the channels located on this site
             using action_type =
                 channel_communicator_server::template get_action<T>;
@@ -144,6 +291,32 @@ namespace hpx { namespace collectives { namespace detail {
             using action_type =
                 channel_communicator_server::template set_action<
                     std::decay_t<T>>;
+
+            if (!servers_.empty())
+            {
+                // the target has been resolved already, directly invoke the
+                // local server or send the parcel to the known address
+                if (servers_[site])
+                {
+                    try
+                    {
+                        servers_[site]->template set<std::decay_t<T>>(
+                            this_site_, HPX_FORWARD(T, value), tag);
+                        return hpx::make_ready_future();
+                    }
+                    catch (...)
+                    {
+                        return hpx::make_exceptional_future<void>(
+                            std::current_exception());
+                    }
+                }
+
+                return hpx::detail::async_remote_impl<action_type>(
+                    hpx::launch::async, clients_[site].get_id(),
+                    naming::address(addresses_[site]), this_site_,
+                    HPX_FORWARD(T, value), tag);
+            }
+
             return hpx::async(action_type(), clients_[site], this_site_,
                 HPX_FORWARD(T, value), tag);
         }
@@ -153,9 +326,20 @@ namespace hpx { namespace collectives { namespace detail {
             return std::make_pair(clients_.size(), this_site_);
         }
 
+        std::size_t next_generation() noexcept
+        {
+            return ++generation_;
+        }
+
     private:
         std::size_t this_site_;
         std::vector<client_type> clients_;
+        std::atomic<std::size_t> generation_{0};
+
+        // resolved peers of a persistent communicator, either the server
+        // instance (if local) or its address
+        std::vector<std::shared_ptr<channel_communicator_server>> servers_;
+        std::vector<naming::address> addresses_;
     };
 }}}    // namespace hpx::collectives::detail
 
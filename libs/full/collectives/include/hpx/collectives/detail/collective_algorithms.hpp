@@ -0,0 +1,553 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/async.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/channel_communicator.hpp>
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/parallel/algorithms/transform.hpp>
+#include <hpx/serialization/serialize_buffer.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// The collective operations performed on a channel_communicator exchange
+// data directly between the participating sites (instead of funneling all
+// data through a single site).
+namespace hpx { namespace collectives { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // The tags used for the messages of one collective operation are derived
+    // from its generation (upper half of the bits) and the step of the
+    // algorithm (lower half of the bits), see collective_tag_bits.
+    constexpr tag_arg collective_tag(
+        std::size_t generation, std::size_t step) noexcept
+    {
+        return tag_arg((generation << collective_tag_bits) + step);
+    }
+
+    // Select the algorithm to use, ring_supported is false if the data
+    // can't be split into segments, segmented_supported is false if the
+    // data is not stored in a contiguous buffer of trivially copyable
+    // elements.
+    HPX_EXPORT collective_algorithm select_algorithm(
+        collective_algorithm algorithm, std::size_t num_sites,
+        std::size_t size_in_bytes, bool ring_supported,
+        bool segmented_supported);
+
+    // The maximal size (in bytes) of the segments the data is split into by
+    // the segmented_ring algorithm.
+    HPX_EXPORT std::size_t get_segment_size();
+
+    ///////////////////////////////////////////////////////////////////////////
+    // A vector can be split into segments which are reduced separately if
+    // the reduction operation can be applied to its elements.
+    template <typename T, typename F, typename Enable = void>
+    struct is_segmentable : std::false_type
+    {
+    };
+
+    template <typename T, typename Allocator, typename F>
+    struct is_segmentable<std::vector<T, Allocator>, F,
+        std::enable_if_t<std::is_invocable_r_v<T, F&, T const&, T const&>>>
+      : std::true_type
+    {
+    };
+
+    template <typename T, typename F>
+    inline constexpr bool is_segmentable_v = is_segmentable<T, F>::value;
+
+    // Segments of a vector can be sent without copying the data if the
+    // elements are trivially copyable.
+    template <typename T, typename F, typename Enable = void>
+    struct is_contiguous_segmentable : std::false_type
+    {
+    };
+
+    template <typename T, typename Allocator, typename F>
+    struct is_contiguous_segmentable<std::vector<T, Allocator>, F,
+        std::enable_if_t<is_segmentable_v<std::vector<T, Allocator>, F> &&
+            std::is_trivially_copyable_v<T> && !std::is_same_v<T, bool>>>
+      : std::true_type
+    {
+    };
+
+    template <typename T, typename F>
+    inline constexpr bool is_contiguous_segmentable_v =
+        is_contiguous_segmentable<T, F>::value;
+
+    template <typename T>
+    constexpr std::size_t approximate_size(T const&) noexcept
+    {
+        return sizeof(T);
+    }
+
+    template <typename T, typename Allocator>
+    std::size_t approximate_size(
+        std::vector<T, Allocator> const& value) noexcept
+    {
+        if constexpr (std::is_trivially_copyable_v<T>)
+        {
+            return value.size() * sizeof(T);
+        }
+        else
+        {
+            return value.size() * sizeof(T) + sizeof(value);
+        }
+    }
+
+    // Combine the values received from two sites, lhs is the value of the
+    // site with the lower index.
+    template <typename T, typename F>
+    T combine(F& op, T const& lhs, T const& rhs)
+    {
+        if constexpr (is_segmentable_v<T, F>)
+        {
+            HPX_ASSERT(lhs.size() == rhs.size());
+
+            T result(lhs.size());
+            std::transform(
+                lhs.begin(), lhs.end(), rhs.begin(), result.begin(), op);
+            return result;
+        }
+        else
+        {
+            return op(lhs, rhs);
+        }
+    }
+
+    inline void wait_for_sends(std::vector<hpx::future<void>>& futures)
+    {
+        for (hpx::future<void>& f : futures)
+        {
+            f.get();    // propagate exceptions
+        }
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recursive doubling: in each of the log(N) steps each site exchanges
+    // its partial result with the site whose index differs in one bit. If
+    // the number of sites is not a power of two, the surplus sites first
+    // hand their values to a neighbor and receive the result at the end.
+    template <typename T, typename F>
+    T recursive_doubling_all_reduce(
+        collectives::channel_communicator& comm, std::size_t num_sites,
+        std::size_t this_site, std::size_t generation, T value, F& op)
+    {
+        std::size_t pof2 = 1;
+        std::size_t num_steps = 0;
+        while (pof2 * 2 <= num_sites)
+        {
+            pof2 *= 2;
+            ++num_steps;
+        }
+
+        std::size_t const rem = num_sites - pof2;
+        std::size_t const last_step = num_steps + 1;
+
+        std::vector<hpx::future<void>> sends;
+        sends.reserve(num_steps + 2);
+
+        if (this_site < 2 * rem)
+        {
+            if (this_site % 2 == 0)
+            {
+                sends.push_back(set(comm, that_site_arg(this_site + 1), value,
+                    collective_tag(generation, 0)));
+
+                T result = get<T>(comm, that_site_arg(this_site + 1),
+                    collective_tag(generation, last_step))
+                               .get();
+
+                wait_for_sends(sends);
+                return result;
+            }
+
+            value = combine(op,
+                get<T>(comm, that_site_arg(this_site - 1),
+                    collective_tag(generation, 0))
+                    .get(),
+                value);
+        }
+
+        std::size_t const new_site =
+            this_site < 2 * rem ? this_site / 2 : this_site - rem;
+
+        std::size_t step = 1;
+        for (std::size_t mask = 1; mask < pof2; mask <<= 1, ++step)
+        {
+            std::size_t const new_partner = new_site ^ mask;
+            std::size_t const partner =
+                new_partner < rem ? 2 * new_partner + 1 : new_partner + rem;
+
+            sends.push_back(set(comm, that_site_arg(partner), value,
+                collective_tag(generation, step)));
+
+            T received = get<T>(comm, that_site_arg(partner),
+                collective_tag(generation, step))
+                             .get();
+
+            value = new_partner < new_site ? combine(op, received, value) :
+                                             combine(op, value, received);
+        }
+
+        if (this_site < 2 * rem)
+        {
+            sends.push_back(set(comm, that_site_arg(this_site - 1), value,
+                collective_tag(generation, last_step)));
+        }
+
+        wait_for_sends(sends);
+        return value;
+    }
+
+    // Ring: a reduce-scatter followed by an all-gather, each consisting of
+    // N-1 steps. Every site sends and receives about 2 * size / N elements
+    // per step independently of the number of sites. Requires the reduction
+    // operation to be commutative.
+    template <typename T, typename F>
+    T ring_all_reduce(collectives::channel_communicator& comm,
+        std::size_t num_sites, std::size_t this_site, std::size_t generation,
+        T value, F& op)
+    {
+        std::size_t const size = value.size();
+        auto offset = [&](std::size_t i) {
+            return i * (size / num_sites) + (std::min)(i, size % num_sites);
+        };
+        auto segment = [&](std::size_t i) {
+            return T(value.begin() + offset(i), value.begin() + offset(i + 1));
+        };
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<hpx::future<void>> sends;
+        sends.reserve(2 * (num_sites - 1));
+
+        // reduce-scatter, afterwards this site holds the final value of
+        // the segment (this_site + 1) % num_sites
+        std::size_t step = 0;
+        for (std::size_t i = 0; i != num_sites - 1; ++i, ++step)
+        {
+            std::size_t const send_segment =
+                (this_site + num_sites - i) % num_sites;
+            std::size_t const recv_segment =
+                (this_site + 2 * num_sites - i - 1) % num_sites;
+
+            sends.push_back(set(comm, that_site_arg(right),
+                segment(send_segment),
+                collective_tag(generation, step)));
+
+            T received = get<T>(comm, that_site_arg(left),
+                collective_tag(generation, step))
+                             .get();
+
+            auto it = value.begin() + offset(recv_segment);
+            std::transform(received.begin(), received.end(), it, it, op);
+        }
+
+        // all-gather the final segments
+        for (std::size_t i = 0; i != num_sites - 1; ++i, ++step)
+        {
+            std::size_t const send_segment =
+                (this_site + 1 + num_sites - i) % num_sites;
+            std::size_t const recv_segment =
+                (this_site + num_sites - i) % num_sites;
+
+            sends.push_back(set(comm, that_site_arg(right),
+                segment(send_segment),
+                collective_tag(generation, step)));
+
+            T received = get<T>(comm, that_site_arg(left),
+                collective_tag(generation, step))
+                             .get();
+
+            std::move(received.begin(), received.end(),
+                value.begin() + offset(recv_segment));
+        }
+
+        wait_for_sends(sends);
+        return value;
+    }
+
+    // Segmented ring: like the ring algorithm above, but the chunk handled
+    // in each step is split into segments which are pipelined through the
+    // ring independently of each other. A segment is forwarded to the next
+    // site as soon as it has been reduced, which overlaps the reduction of
+    // one segment with the communication of the others. The segments are
+    // sent as serialize_buffers, which avoids copying the data while
+    // serializing it.
+    template <typename T, typename F>
+    T segmented_ring_all_reduce(collectives::channel_communicator& comm,
+        std::size_t num_sites, std::size_t this_site, std::size_t generation,
+        T value, F& op)
+    {
+        using element_type = typename T::value_type;
+        using buffer_type = serialization::serialize_buffer<element_type>;
+
+        std::size_t const size = value.size();
+        auto offset = [&](std::size_t i) {
+            return i * (size / num_sites) + (std::min)(i, size % num_sites);
+        };
+
+        // the number of segments is limited, which bounds the number of
+        // tags used by one operation (see max_pipelined_segments)
+        std::size_t const max_chunk_size = (size + num_sites - 1) / num_sites;
+        std::size_t segment_size =
+            (std::max)(get_segment_size() / sizeof(element_type),
+                std::size_t(1));
+        std::size_t const num_segments = (std::min)(
+            (std::max)((max_chunk_size + segment_size - 1) / segment_size,
+                std::size_t(1)),
+            max_pipelined_segments);
+        segment_size = (std::max)(
+            (max_chunk_size + num_segments - 1) / num_segments, segment_size);
+
+        // the range of elements of the given segment in the given chunk
+        auto segment = [&](std::size_t chunk, std::size_t k) {
+            std::size_t const last = offset(chunk + 1);
+            std::size_t const first =
+                (std::min)(offset(chunk) + k * segment_size, last);
+            return std::make_pair(
+                first, (std::min)(first + segment_size, last));
+        };
+
+        that_site_arg const right((this_site + 1) % num_sites);
+        that_site_arg const left((this_site + num_sites - 1) % num_sites);
+
+        auto pipeline = [&](std::size_t k) {
+            std::size_t const first_step = k * 2 * num_sites;
+
+            std::vector<hpx::future<void>> sends;
+            sends.reserve(2 * (num_sites - 1));
+
+            // the own contribution is copied as the receiving site reduces
+            // the data in place (if it is located on the same locality)
+            {
+                auto [first, last] = segment(this_site, k);
+                sends.push_back(set(comm, right,
+                    buffer_type(value.data() + first, last - first,
+                        buffer_type::copy),
+                    collective_tag(generation, first_step)));
+            }
+
+            // reduce-scatter, the received buffer holds the partial result of
+            // the segment that is reduced in place and forwarded
+            for (std::size_t step = 0; step != num_sites - 1; ++step)
+            {
+                std::size_t const chunk =
+                    (this_site + 2 * num_sites - step - 1) % num_sites;
+
+                buffer_type received = get<buffer_type>(
+                    comm, left, collective_tag(generation, first_step + step))
+                                           .get();
+
+                auto [first, last] = segment(chunk, k);
+                HPX_ASSERT(received.size() == last - first);
+
+                hpx::transform(hpx::execution::par_unseq, received.begin(),
+                    received.end(), value.begin() + first, received.begin(),
+                    op);
+
+                if (step == num_sites - 2)
+                {
+                    // this site holds the final value for this segment
+                    std::copy(received.begin(), received.end(),
+                        value.begin() + first);
+                }
+
+                sends.push_back(set(comm, right, HPX_MOVE(received),
+                    collective_tag(generation, first_step + step + 1)));
+            }
+
+            // all-gather, the received segments are final
+            for (std::size_t step = num_sites - 1;
+                 step != 2 * (num_sites - 1); ++step)
+            {
+                std::size_t const chunk =
+                    (this_site + 2 * num_sites - step - 1) % num_sites;
+
+                buffer_type received = get<buffer_type>(
+                    comm, left, collective_tag(generation, first_step + step))
+                                           .get();
+
+                auto [first, last] = segment(chunk, k);
+                HPX_ASSERT(received.size() == last - first);
+
+                std::copy(
+                    received.begin(), received.end(), value.begin() + first);
+
+                if (step != 2 * num_sites - 3)
+                {
+                    sends.push_back(set(comm, right, HPX_MOVE(received),
+                        collective_tag(generation, first_step + step + 1)));
+                }
+            }
+
+            wait_for_sends(sends);
+        };
+
+        // all segments are processed concurrently
+        std::vector<hpx::future<void>> segments;
+        segments.reserve(num_segments);
+        for (std::size_t k = 0; k != num_segments; ++k)
+        {
+            segments.push_back(hpx::async(pipeline, k));
+        }
+        wait_for_sends(segments);
+
+        return value;
+    }
+
+    template <typename T, typename F>
+    T all_reduce(collectives::channel_communicator& comm, T value, F& op,
+        std::size_t generation, collective_algorithm algorithm)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        if (num_sites == 1)
+        {
+            return value;
+        }
+
+        algorithm = select_algorithm(algorithm, num_sites,
+            approximate_size(value), is_segmentable_v<T, F>,
+            is_contiguous_segmentable_v<T, F>);
+
+        if constexpr (is_contiguous_segmentable_v<T, F>)
+        {
+            if (algorithm == collective_algorithm::segmented_ring)
+            {
+                return segmented_ring_all_reduce(comm, num_sites, this_site,
+                    generation, HPX_MOVE(value), op);
+            }
+        }
+
+        if constexpr (is_segmentable_v<T, F>)
+        {
+            if (algorithm == collective_algorithm::ring)
+            {
+                return ring_all_reduce(comm, num_sites, this_site, generation,
+                    HPX_MOVE(value), op);
+            }
+        }
+
+        return recursive_doubling_all_reduce(
+            comm, num_sites, this_site, generation, HPX_MOVE(value), op);
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Recursive doubling (number of sites has to be a power of two): in step
+    // k each site exchanges the 2^k values it has collected so far.
+    template <typename T>
+    std::vector<T> recursive_doubling_all_gather(
+        collectives::channel_communicator& comm, std::size_t num_sites,
+        std::size_t this_site, std::size_t generation, T value)
+    {
+        HPX_ASSERT((num_sites & (num_sites - 1)) == 0);
+
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        std::vector<hpx::future<void>> sends;
+
+        std::size_t step = 0;
+        for (std::size_t mask = 1; mask < num_sites; mask <<= 1, ++step)
+        {
+            std::size_t const partner = this_site ^ mask;
+            std::size_t const first = this_site & ~(mask - 1);
+
+            sends.push_back(set(comm, that_site_arg(partner),
+                std::vector<T>(
+                    result.begin() + first, result.begin() + first + mask),
+                collective_tag(generation, step)));
+
+            std::vector<T> received = get<std::vector<T>>(comm,
+                that_site_arg(partner),
+                collective_tag(generation, step))
+                                          .get();
+
+            HPX_ASSERT(received.size() == mask);
+            std::move(received.begin(), received.end(),
+                result.begin() + (partner & ~(mask - 1)));
+        }
+
+        wait_for_sends(sends);
+        return result;
+    }
+
+    // Ring: in each of the N-1 steps every site forwards the value it has
+    // received last to its right neighbor.
+    template <typename T>
+    std::vector<T> ring_all_gather(collectives::channel_communicator& comm,
+        std::size_t num_sites, std::size_t this_site, std::size_t generation,
+        T value)
+    {
+        std::vector<T> result(num_sites);
+        result[this_site] = HPX_MOVE(value);
+
+        std::size_t const right = (this_site + 1) % num_sites;
+        std::size_t const left = (this_site + num_sites - 1) % num_sites;
+
+        std::vector<hpx::future<void>> sends;
+        sends.reserve(num_sites - 1);
+
+        for (std::size_t step = 0; step != num_sites - 1; ++step)
+        {
+            std::size_t const send_index =
+                (this_site + num_sites - step) % num_sites;
+            std::size_t const recv_index =
+                (this_site + 2 * num_sites - step - 1) % num_sites;
+
+            sends.push_back(set(comm, that_site_arg(right),
+                result[send_index],
+                collective_tag(generation, step)));
+
+            result[recv_index] = get<T>(comm, that_site_arg(left),
+                collective_tag(generation, step))
+                                     .get();
+        }
+
+        wait_for_sends(sends);
+        return result;
+    }
+
+    template <typename T>
+    std::vector<T> all_gather(collectives::channel_communicator& comm,
+        T value, std::size_t generation, collective_algorithm algorithm)
+    {
+        auto [num_sites, this_site] = comm.get_info();
+        if (num_sites == 1)
+        {
+            return std::vector<T>(1, HPX_MOVE(value));
+        }
+
+        algorithm = select_algorithm(algorithm, num_sites,
+            num_sites * approximate_size(value), true, false);
+
+        if (algorithm == collective_algorithm::recursive_doubling &&
+            (num_sites & (num_sites - 1)) == 0)
+        {
+            return recursive_doubling_all_gather(
+                comm, num_sites, this_site, generation, HPX_MOVE(value));
+        }
+
+        return ring_all_gather(
+            comm, num_sites, this_site, generation, HPX_MOVE(value));
+    }
+}}}    // namespace hpx::collectives::detail
+
+#endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -21,6 +21,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <string>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -31,9 +32,11 @@ namespace hpx { namespace collectives {
 
     channel_communicator::channel_communicator(char const* basename,
         num_sites_arg num_sites, this_site_arg this_site,
-        components::client<detail::channel_communicator_server>&& here)
+        components::client<detail::channel_communicator_server>&& here,
+        std::size_t generations)
       : comm_(std::make_shared<detail::channel_communicator>(basename,
-            num_sites.num_sites_, this_site.this_site_, HPX_MOVE(here)))
+            num_sites.num_sites_, this_site.this_site_, HPX_MOVE(here),
+            generations))
     {
     }
 
@@ -42,48 +45,84 @@ namespace hpx { namespace collectives {
         comm_.reset();
     }
 
-    ///////////////////////////////////////////////////////////////////////////
-    hpx::future<channel_communicator> create_channel_communicator(
-        char const* basename, num_sites_arg num_sites, this_site_arg this_site)
+    std::pair<std::size_t, std::size_t> channel_communicator::get_info() const
     {
-        if (num_sites == std::size_t(-1))
-        {
-            num_sites = static_cast<std::size_t>(
-                agas::get_num_localities(hpx::launch::sync));
-        }
-        if (this_site == std::size_t(-1))
-        {
-            this_site = static_cast<std::size_t>(agas::get_locality_id());
-        }
+        HPX_ASSERT(comm_);
+        return comm_->get_info();
+    }
 
-        HPX_ASSERT(this_site < num_sites);
+    std::size_t channel_communicator::next_generation()
+    {
+        HPX_ASSERT(comm_);
+        return comm_->next_generation();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
 
         using client_type =
             hpx::components::client<detail::channel_communicator_server>;
 
-        // create a new communicator on each locality
-        client_type c = hpx::local_new<client_type>(num_sites.num_sites_);
-
-        // register the communicator's id using the given basename,
-        // this keeps the communicator alive
-        auto f = c.register_as(
-            hpx::detail::name_from_basename(basename, this_site.this_site_));
-
-        return f.then(hpx::launch::sync,
-            [=, target = HPX_MOVE(c)](hpx::future<bool>&& f) mutable {
-                bool result = f.get();
-                if (!result)
-                {
-                    HPX_THROW_EXCEPTION(bad_parameter,
-                        "hpx::collectives::detail::create_channel_communicator",
-                        hpx::util::format(
-                            "the given base name for the communicator "
-                            "operation was already registered: {}",
-                            target.registered_name()));
-                }
-                return channel_communicator(
-                    basename, num_sites, this_site, HPX_MOVE(target));
-            });
+        // create a new communicator on this locality and register it using
+        // the given basename
+        hpx::future<client_type> create_channel_communicator_server(
+            char const* basename, num_sites_arg& num_sites,
+            this_site_arg& this_site, std::size_t generations)
+        {
+            if (num_sites == std::size_t(-1))
+            {
+                num_sites = static_cast<std::size_t>(
+                    agas::get_num_localities(hpx::launch::sync));
+            }
+            if (this_site == std::size_t(-1))
+            {
+                this_site = static_cast<std::size_t>(agas::get_locality_id());
+            }
+
+            HPX_ASSERT(this_site < num_sites);
+
+            // the preallocated channels cover all steps of the recursive
+            // doubling and ring algorithms, and all segments pipelined by
+            // the segmented ring algorithm
+            client_type c = hpx::local_new<client_type>(num_sites.num_sites_,
+                generations,
+                generations != 0 ?
+                    2 * num_sites * detail::max_pipelined_segments :
+                    0);
+
+            // register the communicator's id using the given basename,
+            // this keeps the communicator alive
+            auto f = c.register_as(hpx::detail::name_from_basename(
+                basename, this_site.this_site_));
+
+            return f.then(hpx::launch::sync,
+                [target = HPX_MOVE(c)](hpx::future<bool>&& f) mutable {
+                    bool result = f.get();
+                    if (!result)
+                    {
+                        HPX_THROW_EXCEPTION(bad_parameter,
+                            "hpx::collectives::detail::"
+                            "create_channel_communicator",
+                            hpx::util::format(
+                                "the given base name for the communicator "
+                                "operation was already registered: {}",
+                                target.registered_name()));
+                    }
+                    return HPX_MOVE(target);
+                });
+        }
+    }    // namespace
+
+    hpx::future<channel_communicator> create_channel_communicator(
+        char const* basename, num_sites_arg num_sites, this_site_arg this_site)
+    {
+        return create_channel_communicator_server(
+            basename, num_sites, this_site, 0)
+            .then(hpx::launch::sync,
+                [=](hpx::future<client_type>&& f) {
+                    return channel_communicator(
+                        basename, num_sites, this_site, f.get());
+                });
     }
 
     channel_communicator create_channel_communicator(hpx::launch::sync_policy,
@@ -92,6 +131,40 @@ namespace hpx { namespace collectives {
         return create_channel_communicator(basename, num_sites, this_site)
             .get();
     }
+
+    ///////////////////////////////////////////////////////////////////////////
+    hpx::future<channel_communicator> create_persistent_channel_communicator(
+        char const* basename, num_sites_arg num_sites, this_site_arg this_site,
+        std::size_t generations)
+    {
+        if (generations == 0)
+        {
+            return hpx::make_exceptional_future<channel_communicator>(
+                HPX_GET_EXCEPTION(hpx::bad_parameter,
+                    "hpx::collectives::create_persistent_channel_communicator",
+                    "the number of generations shouldn't be zero"));
+        }
+
+        // resolving the peers blocks until all of them have been registered
+        return create_channel_communicator_server(
+            basename, num_sites, this_site, generations)
+            .then(hpx::launch::async,
+                [=, name = std::string(basename)](
+                    hpx::future<client_type>&& f) {
+                    return channel_communicator(name.c_str(), num_sites,
+                        this_site, f.get(), generations);
+                });
+    }
+
+    channel_communicator create_persistent_channel_communicator(
+        hpx::launch::sync_policy, char const* basename,
+        num_sites_arg num_sites, this_site_arg this_site,
+        std::size_t generations)
+    {
+        return create_persistent_channel_communicator(
+            basename, num_sites, this_site, generations)
+            .get();
+    }
 }}    // namespace hpx::collectives
 
 #endif    // !HPX_COMPUTE_DEVICE_CODE
@@ -12,10 +12,14 @@
 #include <hpx/collectives/channel_communicator.hpp>
 #include <hpx/collectives/detail/channel_communicator.hpp>
 #include <hpx/components/basename_registration.hpp>
+#include <hpx/components/get_ptr.hpp>
+#include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/server/component.hpp>
+#include <hpx/naming_base/address.hpp>
 #include <hpx/runtime_components/component_factory.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <utility>
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -29,12 +33,38 @@ namespace hpx { namespace collectives { namespace detail {
 
     ///////////////////////////////////////////////////////////////////////////
     channel_communicator::channel_communicator(char const* basename,
-        std::size_t num_sites, std::size_t this_site, client_type here)
+        std::size_t num_sites, std::size_t this_site, client_type here,
+        std::size_t generations)
       : this_site_(this_site)
       , clients_(find_all_from_basename<client_type>(basename, num_sites))
     {
         // replace reference to our own client (manages base-name registration)
         clients_[this_site] = HPX_MOVE(here);
+
+        if (generations == 0)
+        {
+            return;
+        }
+
+        // resolve all peers once, local servers are accessed directly
+        servers_.resize(num_sites);
+        addresses_.resize(num_sites);
+
+        std::uint32_t const here_id = agas::get_locality_id();
+        for (std::size_t i = 0; i != num_sites; ++i)
+        {
+            hpx::id_type const& id = clients_[i].get_id();
+            naming::address addr = agas::resolve(hpx::launch::sync, id);
+            if (naming::get_locality_id_from_gid(addr.locality_) == here_id)
+            {
+                servers_[i] = hpx::get_ptr<channel_communicator_server>(
+                    hpx::launch::sync, id);
+            }
+            else
+            {
+                addresses_[i] = HPX_MOVE(addr);
+            }
+        }
     }
 }}}    // namespace hpx::collectives::detail
 
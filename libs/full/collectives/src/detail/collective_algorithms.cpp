@@ -0,0 +1,76 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/detail/collective_algorithms.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <cstddef>
+
+namespace hpx { namespace collectives { namespace detail {
+
+    namespace {
+
+        // messages larger than this (in bytes) are reduced using the ring
+        // algorithm
+        std::size_t get_ring_threshold()
+        {
+            static std::size_t const threshold =
+                hpx::util::from_string<std::size_t>(
+                    hpx::get_config_entry(
+                        "hpx.lcos.collectives.ring_threshold", 65536),
+                    65536);
+            return threshold;
+        }
+    }    // namespace
+
+    std::size_t get_segment_size()
+    {
+        static std::size_t const segment_size =
+            hpx::util::from_string<std::size_t>(
+                hpx::get_config_entry(
+                    "hpx.lcos.collectives.segment_size", 262144),
+                262144);
+        return segment_size;
+    }
+
+    collective_algorithm select_algorithm(collective_algorithm algorithm,
+        std::size_t num_sites, std::size_t size_in_bytes, bool ring_supported,
+        bool segmented_supported)
+    {
+        if (!ring_supported)
+        {
+            return collective_algorithm::recursive_doubling;
+        }
+
+        if (algorithm == collective_algorithm::segmented_ring &&
+            !segmented_supported)
+        {
+            return collective_algorithm::ring;
+        }
+
+        if (algorithm != collective_algorithm::automatic)
+        {
+            return algorithm;
+        }
+
+        // the ring algorithm needs more steps than recursive doubling but
+        // transfers less data per site, for two sites both are the same
+        if (num_sites > 2 && size_in_bytes >= get_ring_threshold())
+        {
+            return segmented_supported ? collective_algorithm::segmented_ring :
+                                         collective_algorithm::ring;
+        }
+        return collective_algorithm::recursive_doubling;
+    }
+}}}    // namespace hpx::collectives::detail
+
+#endif
@@ -0,0 +1,116 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Measure the per-call latency of all_reduce for a single value using the
+// different kinds of communicators. Run this on 2..N localities.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/collectives.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace hpx::collectives;
+
+std::size_t iterations = 10000;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename F>
+void measure(char const* name, F&& f)
+{
+    // warm up
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        f(i + 1);
+    }
+
+    hpx::chrono::high_resolution_timer t;
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        f(i + 11);
+    }
+    double elapsed = t.elapsed();
+
+    if (hpx::get_locality_id() == 0)
+    {
+        std::cout << name << ": "
+                  << (elapsed * 1e6) / static_cast<double>(iterations)
+                  << " (us per call, "
+                  << hpx::get_num_localities(hpx::launch::sync)
+                  << " localities)\n";
+    }
+}
+
+void all_reduce_communicator()
+{
+    auto comm = create_communicator("/perf/all_reduce/communicator/");
+
+    measure("communicator", [&](std::size_t generation) {
+        double value = 1.0;
+        all_reduce(comm, value, std::plus<double>{},
+            generation_arg(generation))
+            .get();
+    });
+}
+
+void all_reduce_channel_communicator()
+{
+    auto comm = create_channel_communicator(
+        hpx::launch::sync, "/perf/all_reduce/channel_communicator/");
+
+    measure("channel_communicator", [&](std::size_t) {
+        double value = 1.0;
+        all_reduce(comm, value, std::plus<double>{}).get();
+    });
+}
+
+void all_reduce_persistent_channel_communicator()
+{
+    auto comm = create_persistent_channel_communicator(
+        hpx::launch::sync, "/perf/all_reduce/persistent_communicator/");
+
+    measure("persistent channel_communicator", [&](std::size_t) {
+        double value = 1.0;
+        all_reduce(comm, value, std::plus<double>{}).get();
+    });
+}
+
+int hpx_main(hpx::program_options::variables_map& vm)
+{
+    iterations = vm["iterations"].as<std::size_t>();
+
+    all_reduce_communicator();
+    all_reduce_channel_communicator();
+    all_reduce_persistent_channel_communicator();
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    hpx::program_options::options_description desc_commandline(
+        "Usage: " HPX_APPLICATION_STRING " [options]");
+
+    desc_commandline.add_options()("iterations",
+        hpx::program_options::value<std::size_t>()->default_value(10000),
+        "number of all_reduce operations to perform (default: 10000)");
+
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+
+    hpx::init_params init_args;
+    init_args.desc_cmdline = desc_commandline;
+    init_args.cfg = cfg;
+
+    return hpx::init(argc, argv, init_args);
+}
+#endif
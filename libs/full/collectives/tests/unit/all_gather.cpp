@@ -12,6 +12,7 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <utility>
@@ -20,6 +21,8 @@
 using namespace hpx::collectives;
 
 constexpr char const* all_gather_direct_basename = "/test/all_gather_direct/";
+constexpr char const* all_gather_channel_basename =
+    "/test/all_gather_channel/";
 
 void test_one_shot_use()
 {
@@ -99,12 +102,82 @@ void test_multiple_use_with_generation()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_channel_all_gather_site(channel_communicator comm, std::size_t site,
+    std::size_t num_sites)
+{
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::future<std::vector<std::size_t>> overall_result =
+            all_gather(comm, site + i);
+
+        std::vector<std::size_t> r = overall_result.get();
+        HPX_TEST_EQ(r.size(), num_sites);
+
+        for (std::size_t j = 0; j != r.size(); ++j)
+        {
+            HPX_TEST_EQ(r[j], j + i);
+        }
+    }
+
+    collective_algorithm const algorithms[] = {
+        collective_algorithm::automatic,
+        collective_algorithm::recursive_doubling,
+        collective_algorithm::ring};
+
+    std::size_t generation = 100;
+    for (collective_algorithm algorithm : algorithms)
+    {
+        hpx::future<std::vector<std::string>> overall_result =
+            all_gather(comm, std::to_string(site),
+                generation_arg(++generation), algorithm);
+
+        std::vector<std::string> r = overall_result.get();
+        HPX_TEST_EQ(r.size(), num_sites);
+
+        for (std::size_t j = 0; j != r.size(); ++j)
+        {
+            HPX_TEST_EQ(r[j], std::to_string(j));
+        }
+    }
+}
+
+void test_channel_all_gather(std::size_t num_sites)
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    std::string basename =
+        all_gather_channel_basename + std::to_string(num_sites);
+
+    // distribute the sites over all localities
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t site = here; site < num_sites; site += num_localities)
+    {
+        channel_communicator comm = create_channel_communicator(
+            hpx::launch::sync, basename.c_str(), num_sites_arg(num_sites),
+            this_site_arg(site));
+
+        tasks.push_back(
+            hpx::async(test_channel_all_gather_site, comm, site, num_sites));
+    }
+    hpx::wait_all(tasks);
+
+    for (auto& f : tasks)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+}
+
 int hpx_main()
 {
     test_one_shot_use();
     test_multiple_use();
     test_multiple_use_with_generation();
 
+    test_channel_all_gather(7);
+    test_channel_all_gather(8);
+
     return hpx::finalize();
 }
 
@@ -12,7 +12,9 @@
 #include <hpx/modules/collectives.hpp>
 #include <hpx/modules/testing.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -20,6 +22,8 @@
 using namespace hpx::collectives;
 
 constexpr char const* all_reduce_direct_basename = "/test/all_reduce_direct/";
+constexpr char const* all_reduce_channel_basename =
+    "/test/all_reduce_channel/";
 
 void test_one_shot_use()
 {
@@ -98,18 +102,134 @@ void test_multiple_use_with_generation()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+void test_channel_all_reduce_site(channel_communicator comm, std::size_t site,
+    std::size_t num_sites)
+{
+    // small values are reduced using recursive doubling
+    for (std::size_t i = 0; i != 10; ++i)
+    {
+        hpx::future<std::size_t> overall_result =
+            all_reduce(comm, site + i, std::plus<std::size_t>{});
+
+        std::size_t sum = 0;
+        for (std::size_t j = 0; j != num_sites; ++j)
+        {
+            sum += j + i;
+        }
+        HPX_TEST_EQ(sum, overall_result.get());
+    }
+
+    // non-commutative operations are applied in the order of the sites
+    {
+        hpx::future<std::string> overall_result = all_reduce(comm,
+            std::to_string(site), std::plus<std::string>{},
+            generation_arg(100), collective_algorithm::ring);
+
+        std::string expected;
+        for (std::size_t j = 0; j != num_sites; ++j)
+        {
+            expected += std::to_string(j);
+        }
+        HPX_TEST_EQ(expected, overall_result.get());
+    }
+
+    // vectors are reduced element-wise, the size is not necessarily a
+    // multiple of the number of sites
+    collective_algorithm const algorithms[] = {
+        collective_algorithm::automatic,
+        collective_algorithm::recursive_doubling,
+        collective_algorithm::ring,
+        collective_algorithm::segmented_ring};
+
+    std::size_t generation = 200;
+    for (collective_algorithm algorithm : algorithms)
+    {
+        for (std::size_t size : {std::size_t(3), std::size_t(100003)})
+        {
+            std::vector<std::uint64_t> value(size);
+            for (std::size_t k = 0; k != size; ++k)
+            {
+                value[k] = k + site;
+            }
+
+            hpx::future<std::vector<std::uint64_t>> overall_result =
+                all_reduce(comm, HPX_MOVE(value), std::plus<std::uint64_t>{},
+                    generation_arg(++generation), algorithm);
+
+            std::vector<std::uint64_t> result = overall_result.get();
+            HPX_TEST_EQ(result.size(), size);
+
+            std::uint64_t sites_sum = num_sites * (num_sites - 1) / 2;
+            for (std::size_t k = 0; k != result.size(); ++k)
+            {
+                HPX_TEST_EQ(result[k], k * num_sites + sites_sum);
+            }
+        }
+    }
+}
+
+void test_channel_all_reduce(std::size_t num_sites, bool persistent = false)
+{
+    std::uint32_t num_localities = hpx::get_num_localities(hpx::launch::sync);
+    std::uint32_t here = hpx::get_locality_id();
+
+    std::string basename = all_reduce_channel_basename +
+        std::to_string(num_sites) + (persistent ? "/persistent" : "");
+
+    // distribute the sites over all localities, a persistent communicator
+    // becomes ready only after all peers have been created
+    std::vector<std::size_t> sites;
+    std::vector<hpx::future<channel_communicator>> comms;
+    for (std::size_t site = here; site < num_sites; site += num_localities)
+    {
+        sites.push_back(site);
+        if (persistent)
+        {
+            comms.push_back(create_persistent_channel_communicator(
+                basename.c_str(), num_sites_arg(num_sites),
+                this_site_arg(site)));
+        }
+        else
+        {
+            comms.push_back(create_channel_communicator(basename.c_str(),
+                num_sites_arg(num_sites), this_site_arg(site)));
+        }
+    }
+
+    std::vector<hpx::future<void>> tasks;
+    for (std::size_t i = 0; i != sites.size(); ++i)
+    {
+        tasks.push_back(hpx::async(test_channel_all_reduce_site,
+            comms[i].get(), sites[i], num_sites));
+    }
+    hpx::wait_all(tasks);
+
+    for (auto& f : tasks)
+    {
+        HPX_TEST(!f.has_exception());
+    }
+}
+
 int hpx_main()
 {
     test_one_shot_use();
     test_multiple_use();
     test_multiple_use_with_generation();
 
+    test_channel_all_reduce(7);
+    test_channel_all_reduce(8);
+    test_channel_all_reduce(7, true);
+    test_channel_all_reduce(8, true);
+
     return hpx::finalize();
 }
 
 int main(int argc, char* argv[])
 {
-    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1"};
+    // use small segments to exercise the pipelining of the segments
+    std::vector<std::string> const cfg = {"hpx.run_hpx_main!=1",
+        "hpx.lcos.collectives.segment_size!=4096"};
 
     hpx::init_params init_args;
     init_args.cfg = cfg;
@@ -213,6 +213,152 @@ void test_multi_use_get_first()
     }
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Each site receives values from itself on a non-persistent communicator. All
+// gets are known to be pending when the values are set, so each set completes
+// a pending get (and releases the dynamically allocated channel) while it is
+// still running.
+void test_get_before_set_comm(std::size_t site,
+    hpx::collectives::channel_communicator comm, std::size_t iter)
+{
+    constexpr std::size_t num_tags = 16;
+
+    std::vector<hpx::future<std::size_t>> gets;
+    gets.reserve(num_tags);
+
+    for (std::size_t t = 0; t != num_tags; ++t)
+    {
+        gets.push_back(get<std::size_t>(
+            comm, that_site_arg(site), tag_arg(iter * num_tags + t)));
+    }
+
+    for (std::size_t t = 0; t != num_tags; ++t)
+    {
+        HPX_TEST(!gets[t].is_ready());
+    }
+
+    std::vector<hpx::future<void>> sets;
+    sets.reserve(num_tags);
+
+    for (std::size_t t = 0; t != num_tags; ++t)
+    {
+        sets.push_back(set(comm, that_site_arg(site), site * num_tags + t,
+            tag_arg(iter * num_tags + t)));
+    }
+
+    hpx::wait_all(sets, gets);
+
+    for (std::size_t t = 0; t != num_tags; ++t)
+    {
+        HPX_TEST(!sets[t].has_exception());
+        HPX_TEST_EQ(gets[t].get(), site * num_tags + t);
+    }
+}
+
+void test_get_before_set()
+{
+    constexpr char const* get_before_set_basename =
+        "/test/get_before_set_channel_communicator/";
+
+    std::vector<hpx::collectives::channel_communicator> comms;
+    comms.reserve(NUM_CHANNEL_COMMUNICATOR_SITES);
+
+    for (std::size_t i = 0; i != NUM_CHANNEL_COMMUNICATOR_SITES; ++i)
+    {
+        comms.push_back(create_channel_communicator(hpx::launch::sync,
+            get_before_set_basename,
+            num_sites_arg(NUM_CHANNEL_COMMUNICATOR_SITES), this_site_arg(i)));
+    }
+
+    for (std::size_t j = 0; j != 10; ++j)
+    {
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(NUM_CHANNEL_COMMUNICATOR_SITES);
+
+        for (std::size_t i = 0; i != NUM_CHANNEL_COMMUNICATOR_SITES; ++i)
+        {
+            tasks.push_back(
+                hpx::async(test_get_before_set_comm, i, comms[i], j));
+        }
+
+        hpx::wait_all(tasks);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// The values of a persistent communicator are delivered through preallocated
+// channels. Issuing the get before the set on the same tag makes the set
+// complete the pending get inline.
+void test_persistent_get_first_comm(std::size_t site,
+    hpx::collectives::channel_communicator comm, std::size_t tag)
+{
+    using data_type = std::pair<std::size_t, std::size_t>;
+
+    std::vector<hpx::future<data_type>> gets;
+    gets.reserve(NUM_CHANNEL_COMMUNICATOR_SITES);
+
+    for (std::size_t i = 0; i != NUM_CHANNEL_COMMUNICATOR_SITES; ++i)
+    {
+        gets.push_back(get<data_type>(comm, that_site_arg(i), tag_arg(tag)));
+    }
+
+    std::vector<hpx::future<void>> sets;
+    sets.reserve(NUM_CHANNEL_COMMUNICATOR_SITES);
+
+    for (std::size_t i = 0; i != NUM_CHANNEL_COMMUNICATOR_SITES; ++i)
+    {
+        sets.push_back(set(
+            comm, that_site_arg(i), std::make_pair(i, site), tag_arg(tag)));
+    }
+
+    hpx::wait_all(sets, gets);
+
+    for (std::size_t i = 0; i != NUM_CHANNEL_COMMUNICATOR_SITES; ++i)
+    {
+        HPX_TEST(!gets[i].has_exception());
+        HPX_TEST(!sets[i].has_exception());
+
+        auto data = gets[i].get();
+        HPX_TEST_EQ(data.first, site);
+        HPX_TEST_EQ(data.second, i);
+    }
+}
+
+void test_persistent_get_first()
+{
+    constexpr char const* persistent_basename =
+        "/test/persistent_channel_communicator/";
+
+    std::vector<hpx::collectives::channel_communicator> comms;
+    comms.reserve(NUM_CHANNEL_COMMUNICATOR_SITES);
+
+    for (std::size_t i = 0; i != NUM_CHANNEL_COMMUNICATOR_SITES; ++i)
+    {
+        comms.push_back(create_persistent_channel_communicator(
+            hpx::launch::sync, persistent_basename,
+            num_sites_arg(NUM_CHANNEL_COMMUNICATOR_SITES), this_site_arg(i),
+            2));
+    }
+
+    // the tags of more generations than preallocated reuse the channels
+    for (std::size_t j = 0; j != 10; ++j)
+    {
+        std::size_t const tag =
+            (j << hpx::collectives::detail::collective_tag_bits) + j % 3;
+
+        std::vector<hpx::future<void>> tasks;
+        tasks.reserve(NUM_CHANNEL_COMMUNICATOR_SITES);
+
+        for (std::size_t i = 0; i != NUM_CHANNEL_COMMUNICATOR_SITES; ++i)
+        {
+            tasks.push_back(
+                hpx::async(test_persistent_get_first_comm, i, comms[i], tag));
+        }
+
+        hpx::wait_all(tasks);
+    }
+}
+
 int hpx_main()
 {
     test_single_use_set_first();
@@ -221,6 +367,9 @@ int hpx_main()
     test_multi_use_set_first();
     test_multi_use_get_first();
 
+    test_get_before_set();
+    test_persistent_get_first();
+
     return hpx::finalize();
 }
 
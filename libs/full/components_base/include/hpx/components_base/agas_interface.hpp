@@ -287,6 +287,13 @@ namespace hpx { namespace agas {
             f,
         threads::thread_priority local_priority =
             threads::thread_priority::default_);
+
+    /// \brief Append parcels carrying the reference count requests buffered
+    ///        for the given locality if those are due to be sent soon
+    ///        anyways. This is invoked whenever parcels are sent to the
+    ///        locality, the appended parcels are sent along with those.
+    HPX_EXPORT void piggyback_refcnt_requests(
+        std::uint32_t locality_id, std::vector<parcelset::parcel>& parcels);
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -238,6 +238,9 @@ namespace hpx { namespace agas { namespace detail {
     extern HPX_EXPORT void (*route)(parcelset::parcel&& p,
         hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&,
         threads::thread_priority local_priority);
+
+    extern HPX_EXPORT void (*piggyback_refcnt_requests)(
+        std::uint32_t locality_id, std::vector<parcelset::parcel>& parcels);
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,37 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace components { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    // Hooks collecting access statistics for migratable objects. These are
+    // set only while the automatic migration service is active.
+    //
+    // record_object_access is invoked for each action scheduled on a
+    // migratable object (independently of where the action was invoked
+    // from), record_remote_object_access is invoked for each action on a
+    // migratable object received through a parcel from the given locality.
+    // The hooks are published after the service has been configured, they
+    // have to be loaded using acquire semantics.
+    using record_object_access_type = void (*)(
+        naming::gid_type const& id, components::component_type type);
+    using record_remote_object_access_type = void (*)(
+        naming::gid_type const& id, std::uint32_t source_locality_id);
+
+    extern HPX_EXPORT std::atomic<record_object_access_type>
+        record_object_access;
+    extern HPX_EXPORT std::atomic<record_remote_object_access_type>
+        record_remote_object_access;
+}}}    // namespace hpx::components::detail
@@ -9,6 +9,8 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/components_base/agas_interface.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/detail/object_access_hooks.hpp>
 #include <hpx/components_base/pinned_ptr.hpp>
 #include <hpx/components_base/traits/action_decorate_function.hpp>
 #include <hpx/functional/bind_front.hpp>
@@ -18,6 +20,7 @@
 #include <hpx/synchronization/spinlock.hpp>
 #include <hpx/type_support/unused.hpp>
 
+#include <atomic>
 #include <cstdint>
 #include <mutex>
 #include <type_traits>
@@ -230,6 +233,14 @@ namespace hpx { namespace components {
         static threads::thread_function_type decorate_action(
             naming::address_type lva, F&& f)
         {
+            // collect access statistics if automatic migration is active
+            if (auto* record = detail::record_object_access.load(
+                    std::memory_order_acquire))
+            {
+                get_lva<this_component_type>::call(lva)
+                    ->record_access_for_migration(record);
+            }
+
             // Make sure we pin the component at construction of the bound object
             // which will also unpin it once the thread runs to completion (the
             // bound object goes out of scope).
@@ -254,6 +265,15 @@ namespace hpx { namespace components {
         }
 
     protected:
+        void record_access_for_migration(
+            detail::record_object_access_type record) const
+        {
+            if (this->gid_)
+            {
+                record(this->gid_, get_component_type<this_component_type>());
+            }
+        }
+
         // Execute the wrapped action. This function is bound in decorate_action
         // above. The bound object performs the pinning/unpinning.
         threads::thread_result_type thread_function(
@@ -10,10 +10,14 @@
 #include <hpx/config.hpp>
 #include <hpx/assert.hpp>
 #include <hpx/components_base/server/wrapper_heap_base.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
 #include <hpx/synchronization/spinlock.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -23,6 +27,16 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace util {
 
+    // The list of heaps managing the memory for instances of one component
+    // type. Single objects are handed out from small per-worker-thread caches
+    // (magazines) of memory slots which are reserved in bulk from the heaps,
+    // only refilling a magazine requires to acquire the lock protecting the
+    // list of heaps. The heap owning a given address is found by looking up
+    // the address in a map keyed by the start of the memory managed by each
+    // of the heaps. A heap can't release its memory while some of its slots
+    // are cached, magazines holding slots of an older heap are therefore
+    // emptied whenever a new heap is created, and all cached slots are
+    // returned to their heaps when the runtime shuts down.
     class HPX_EXPORT one_size_heap_list
     {
     public:
@@ -34,7 +48,21 @@ namespace hpx { namespace util {
 
         using heap_parameters = wrapper_heap_base::heap_parameters;
 
+        // number of memory slots cached for each worker thread
+        static constexpr std::size_t magazine_size = 32;
+
     private:
+        struct magazine
+        {
+            std::atomic<bool> busy_{false};
+            std::size_t count_ = 0;
+            util::wrapper_heap_base* heap_ = nullptr;
+            void* slots_[magazine_size];
+        };
+
+        using magazine_type = util::cache_aligned_data<magazine>;
+        using heap_map_type = std::map<std::uintptr_t, wrapper_heap_base*>;
+
         template <typename Heap>
         static std::shared_ptr<util::wrapper_heap_base> create_heap(
             char const* name, std::size_t counter, heap_parameters parameters)
@@ -58,6 +86,8 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(nullptr)
           , parameters_({0, 0, 0})
+          , magazines_enabled_(false)
+          , num_magazines_(0)
         {
             HPX_ASSERT(false);    // shouldn't ever be called
         }
@@ -74,6 +104,8 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(&one_size_heap_list::create_heap<Heap>)
           , parameters_(parameters)
+          , magazines_enabled_(false)
+          , num_magazines_(0)
         {
         }
 
@@ -89,6 +121,8 @@ namespace hpx { namespace util {
 #endif
           , create_heap_(&one_size_heap_list::create_heap<Heap>)
           , parameters_(parameters)
+          , magazines_enabled_(false)
+          , num_magazines_(0)
         {
         }
 
@@ -106,6 +140,35 @@ namespace hpx { namespace util {
 
         std::string name() const;
 
+        // return the memory slots cached by the magazines to their heaps,
+        // magazines are not used anymore afterwards unless the runtime is
+        // running
+        void flush_magazines();
+
+    protected:
+        // return the heap the given address was allocated from, if any
+        wrapper_heap_base* find_heap(void* p) const;
+
+    private:
+        wrapper_heap_base* find_heap_locked(void* p) const;
+
+        // allocate count consecutive objects from the most recently created
+        // heap or a new heap, if exact is false, fewer objects may be
+        // allocated
+        std::size_t alloc_from_heap(void** p, std::size_t count, bool exact,
+            util::wrapper_heap_base** heap = nullptr);
+
+        magazine* acquire_magazine();
+        void refill(magazine& m);
+
+        // return the slots cached by the given magazine to their heap unless
+        // they were taken from the heap 'keep', magazines in use are skipped
+        void return_slots(
+            magazine& m, util::wrapper_heap_base* keep = nullptr);
+        void return_stale_slots(util::wrapper_heap_base* newest);
+
+        void update_alloc_statistics(std::size_t count) noexcept;
+
     protected:
         mutable mutex_type mtx_;
         list_type heap_list_;
@@ -115,15 +178,22 @@ namespace hpx { namespace util {
 
     public:
 #if defined(HPX_DEBUG)
-        std::size_t alloc_count_;
-        std::size_t free_count_;
+        std::atomic<std::size_t> alloc_count_;
+        std::atomic<std::size_t> free_count_;
         std::size_t heap_count_;
-        std::size_t max_alloc_count_;
+        std::atomic<std::size_t> max_alloc_count_;
 #endif
         std::shared_ptr<util::wrapper_heap_base> (*create_heap_)(
             char const*, std::size_t, heap_parameters);
 
         heap_parameters const parameters_;
+
+    private:
+        heap_map_type heap_map_;
+
+        std::atomic<bool> magazines_enabled_;
+        std::atomic<std::size_t> num_magazines_;
+        std::unique_ptr<magazine_type[]> magazines_;
     };
 }}    // namespace hpx::util
 
@@ -91,6 +91,7 @@ namespace hpx { namespace components { namespace detail {
         bool has_allocatable_slots() const;
 
         bool alloc(void** result, std::size_t count = 1) override;
+        std::size_t alloc_upto(void** result, std::size_t count) override;
         void free(void* p, std::size_t count = 1) override;
         bool did_alloc(void* p) const override;
 
@@ -26,6 +26,10 @@ namespace hpx { namespace util {
         virtual ~wrapper_heap_base() = default;
 
         virtual bool alloc(void** result, std::size_t count = 1) = 0;
+
+        // allocate at most count consecutive objects, returns the number of
+        // objects actually allocated (zero if the heap is exhausted)
+        virtual std::size_t alloc_upto(void** result, std::size_t count) = 0;
         virtual bool did_alloc(void* p) const = 0;
         virtual void free(void* p, std::size_t count = 1) = 0;
 
@@ -10,7 +10,6 @@
 #include <hpx/components_base/generate_unique_ids.hpp>
 #include <hpx/components_base/server/one_size_heap_list.hpp>
 #include <hpx/naming_base/id_type.hpp>
-#include <hpx/thread_support/unlock_guard.hpp>
 
 #include <type_traits>
 
@@ -52,20 +51,12 @@ namespace hpx { namespace components { namespace detail {
 
         naming::gid_type get_gid(void* p)
         {
-            std::unique_lock guard(this->mtx_);
-
-            using iterator = typename base_type::const_iterator;
-
-            iterator end = this->heap_list_.end();
-            for (iterator it = this->heap_list_.begin(); it != end; ++it)
+            util::wrapper_heap_base* heap = this->find_heap(p);
+            if (heap == nullptr)
             {
-                if ((*it)->did_alloc(p))
-                {
-                    util::unlock_guard ul(guard);
-                    return (*it)->get_gid(id_range_, p, type_);
-                }
+                return naming::invalid_gid;
             }
-            return naming::invalid_gid;
+            return heap->get_gid(id_range_, p, type_);
         }
 
         void set_range(
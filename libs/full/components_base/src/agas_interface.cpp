@@ -403,6 +403,12 @@ namespace hpx { namespace agas {
     {
         return detail::route(HPX_MOVE(p), HPX_MOVE(f), local_priority);
     }
+
+    void piggyback_refcnt_requests(
+        std::uint32_t locality_id, std::vector<parcelset::parcel>& parcels)
+    {
+        detail::piggyback_refcnt_requests(locality_id, parcels);
+    }
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -232,6 +232,9 @@ namespace hpx { namespace agas { namespace detail {
     void (*route)(parcelset::parcel&& p,
         hpx::function<void(std::error_code const&, parcelset::parcel const&)>&&,
         threads::thread_priority local_priority) = nullptr;
+
+    void (*piggyback_refcnt_requests)(std::uint32_t locality_id,
+        std::vector<parcelset::parcel>& parcels) = nullptr;
 #endif
 
     ///////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,21 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/detail/object_access_hooks.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+
+#include <atomic>
+#include <cstdint>
+
+namespace hpx { namespace components { namespace detail {
+
+    std::atomic<record_object_access_type> record_object_access(nullptr);
+
+    std::atomic<record_remote_object_access_type> record_remote_object_access(
+        nullptr);
+}}}    // namespace hpx::components::detail
@@ -12,15 +12,21 @@
 #include <hpx/functional/bind_front.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/format.hpp>
+#include <hpx/runtime_local/runtime_local_fwd.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
 #include <hpx/runtime_local/state.hpp>
 #include <hpx/thread_support/unlock_guard.hpp>
 #include <hpx/threading_base/register_thread.hpp>
 #include <hpx/threading_base/thread_data.hpp>
+#include <hpx/threading_base/thread_num_tss.hpp>
+#include <hpx/type_support/unused.hpp>
 #if defined(HPX_DEBUG)
 #include <hpx/modules/logging.hpp>
 #endif
 
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -34,7 +40,8 @@ namespace hpx { namespace util {
         LOSH_(info).format(
             "{1}::~{1}: size({2}), max_count({3}), alloc_count({4}), "
             "free_count({5})",
-            name(), heap_count_, max_alloc_count_, alloc_count_, free_count_);
+            name(), heap_count_, max_alloc_count_.load(), alloc_count_.load(),
+            free_count_.load());
 
         if (alloc_count_ > free_count_)
         {
@@ -45,101 +52,300 @@ namespace hpx { namespace util {
 #endif
     }
 
-    void* one_size_heap_list::alloc(std::size_t count)
+    void one_size_heap_list::update_alloc_statistics(
+        std::size_t count) noexcept
     {
-        std::unique_lock guard(mtx_);
+#if defined(HPX_DEBUG)
+        std::size_t const allocated = (alloc_count_ += count) - free_count_;
+        std::size_t max_allocated = max_alloc_count_.load();
+        while (allocated > max_allocated &&
+            !max_alloc_count_.compare_exchange_weak(max_allocated, allocated))
+        {
+        }
+#else
+        HPX_UNUSED(count);
+#endif
+    }
 
+    void* one_size_heap_list::alloc(std::size_t count)
+    {
         if (HPX_UNLIKELY(0 == count))
         {
-            guard.unlock();
             HPX_THROW_EXCEPTION(
                 bad_parameter, name() + "::alloc", "cannot allocate 0 objects");
         }
 
-        void* p = nullptr;
+        // single objects are handed out from the calling worker's magazine
+        if (count == 1)
         {
-            if (!heap_list_.empty())
+            if (magazine* m = acquire_magazine())
             {
-                for (auto& heap : heap_list_)
+                try
                 {
-                    bool allocated = false;
-
+                    if (m->count_ == 0)
                     {
-                        util::unlock_guard ul(guard);
-                        allocated = heap->alloc(&p, count);
+                        refill(*m);
                     }
+                }
+                catch (...)
+                {
+                    m->busy_.store(false, std::memory_order_release);
+                    throw;
+                }
+
+                HPX_ASSERT(m->count_ != 0);
+                void* p = m->slots_[--m->count_];
+                m->busy_.store(false, std::memory_order_release);
 
-                    if (allocated)
+                update_alloc_statistics(1);
+                return p;
+            }
+        }
+
+        void* p = nullptr;
+        alloc_from_heap(&p, count, true);
+
+        update_alloc_statistics(count);
+        return p;
+    }
+
+    std::size_t one_size_heap_list::alloc_from_heap(void** p,
+        std::size_t count, bool exact, util::wrapper_heap_base** result_heap)
+    {
+        std::unique_lock guard(mtx_);
+
+        // Heaps hand out their memory in increasing address order only, thus
+        // if the most recently created heap can't satisfy the request, none
+        // of the older heaps will be able to do so either.
+        if (!heap_list_.empty())
+        {
+            std::shared_ptr<util::wrapper_heap_base> heap = heap_list_.front();
+
+            std::size_t allocated = 0;
+            {
+                util::unlock_guard ul(guard);
+                if (exact)
+                {
+                    allocated = heap->alloc(p, count) ? count : 0;
+                    if (allocated == 0)
                     {
+                        // The remaining slots of the heap will never be
+                        // handed out, they are given back right away, as
+                        // the heap can release its memory only once all of
+                        // its slots have been freed.
+                        void* rest = nullptr;
+                        if (std::size_t const num_rest =
+                                heap->alloc_upto(&rest, count))
+                        {
+                            heap->free(rest, num_rest);
+                        }
+                    }
+                }
+                else
+                {
+                    allocated = heap->alloc_upto(p, count);
+                }
+            }
+
+            if (allocated != 0)
+            {
+                if (result_heap != nullptr)
+                {
+                    *result_heap = heap.get();
+                }
+                return allocated;
+            }
+
 #if defined(HPX_DEBUG)
-                        // Allocation succeeded, update statistics.
-                        alloc_count_ += count;
-                        if (alloc_count_ - free_count_ > max_alloc_count_)
-                            max_alloc_count_ = alloc_count_ - free_count_;
+            LOSH_(info).format(
+                "{1}::alloc: failed to allocate from heap[{2}] "
+                "(heap[{2}] has allocated {3} objects and has "
+                "space for {4} more objects)",
+                name(), heap->heap_count(), heap->size(), heap->free_size());
 #endif
-                        return p;
-                    }
+        }
 
+        // Create new heap.
 #if defined(HPX_DEBUG)
-                    LOSH_(info).format(
-                        "{1}::alloc: failed to allocate from heap[{2}] "
-                        "(heap[{2}] has allocated {3} objects and has "
-                        "space for {4} more objects)",
-                        name(), heap->heap_count(), heap->size(),
-                        heap->free_size());
+        std::shared_ptr<util::wrapper_heap_base> heap =
+            create_heap_(class_name_.c_str(), heap_count_ + 1, parameters_);
+#else
+        std::shared_ptr<util::wrapper_heap_base> heap =
+            create_heap_(class_name_.c_str(), 0, parameters_);
 #endif
-                }
+
+        std::size_t allocated = 0;
+        {
+            util::unlock_guard ul(guard);
+            if (exact)
+            {
+                allocated = heap->alloc(p, count) ? count : 0;
+            }
+            else
+            {
+                allocated = heap->alloc_upto(p, count);
             }
         }
 
-        // Create new heap.
-        bool did_create = false;
+        if (HPX_UNLIKELY(allocated == 0 || nullptr == *p))
         {
+            // out of memory
+            guard.unlock();
+            HPX_THROW_EXCEPTION(out_of_memory, name() + "::alloc",
+                "new heap failed to allocate {1} objects", count);
+        }
+
+        heap_list_.push_front(heap);
+
+        // The first allocation from a new heap returns the start of the
+        // memory managed by it. Entries referring to heaps which have
+        // released their memory in the meantime might overlap with the new
+        // heap, those are removed.
+        std::uintptr_t const first = reinterpret_cast<std::uintptr_t>(*p);
+        std::uintptr_t const last = first +
+            parameters_.capacity * parameters_.element_size +
+            parameters_.element_alignment;
+
+        heap_map_.erase(
+            heap_map_.lower_bound(first), heap_map_.lower_bound(last));
+        heap_map_.emplace(first, heap.get());
+
 #if defined(HPX_DEBUG)
-            heap_list_.push_front(create_heap_(
-                class_name_.c_str(), heap_count_ + 1, parameters_));
-#else
-            heap_list_.push_front(
-                create_heap_(class_name_.c_str(), 0, parameters_));
+        ++heap_count_;
+
+        LOSH_(info).format("{1}::alloc: creating new heap[{2}], size is now {3}",
+            name(), heap_count_, heap_list_.size());
 #endif
+        guard.unlock();
+
+        // slots cached for the older heaps would keep those from releasing
+        // their memory
+        return_stale_slots(heap.get());
 
-            iterator itnew = heap_list_.begin();
-            typename list_type::value_type heap = *itnew;
-            bool result = false;
+        if (result_heap != nullptr)
+        {
+            *result_heap = heap.get();
+        }
+        return allocated;
+    }
 
+    one_size_heap_list::magazine* one_size_heap_list::acquire_magazine()
+    {
+        std::size_t const worker = hpx::get_worker_thread_num();
+        if (worker == std::size_t(-1))
+        {
+            return nullptr;
+        }
+
+        if (!magazines_enabled_.load(std::memory_order_acquire))
+        {
+            // the cached slots are returned to their heaps during shutdown,
+            // no slots are cached afterwards
+            if (!hpx::is_running())
             {
-                util::unlock_guard ul(guard);
-                result = heap->alloc((void**) &p, count);
+                return nullptr;
             }
 
-            if (HPX_UNLIKELY(!result || nullptr == p))
+            std::size_t const num_threads = hpx::get_num_worker_threads();
+
+            std::lock_guard l(mtx_);
+            if (!magazines_enabled_.load(std::memory_order_relaxed))
             {
-                // out of memory
-                guard.unlock();
-                HPX_THROW_EXCEPTION(out_of_memory, name() + "::alloc",
-                    "new heap failed to allocate {1} objects", count);
+                if (!magazines_)
+                {
+                    magazines_.reset(new magazine_type[num_threads]);
+                    num_magazines_.store(
+                        num_threads, std::memory_order_release);
+                }
+
+                hpx::register_shutdown_function(hpx::bind_front(
+                    &one_size_heap_list::flush_magazines, this));
+                magazines_enabled_.store(true, std::memory_order_release);
             }
+        }
 
-#if defined(HPX_DEBUG)
-            alloc_count_ += count;
-            ++heap_count_;
+        std::size_t const num_magazines =
+            num_magazines_.load(std::memory_order_acquire);
 
-            LOSH_(info).format(
-                "{1}::alloc: creating new heap[{2}], size is now {3}", name(),
-                heap_count_, heap_list_.size());
-#endif
-            did_create = true;
+        if (worker >= num_magazines)
+        {
+            return nullptr;
         }
 
-        if (did_create)
+        // the magazine might be in use by a suspended thread that was
+        // running on the same worker
+        magazine& m = magazines_[worker].data_;
+        if (m.busy_.exchange(true, std::memory_order_acquire))
         {
-            return p;
+            return nullptr;
         }
+        return &m;
+    }
 
-        guard.unlock();
+    void one_size_heap_list::refill(magazine& m)
+    {
+        HPX_ASSERT(m.count_ == 0);
 
-        // Try again, we just got a new heap, so we should be good.
-        return alloc(count);
+        void* p = nullptr;
+        util::wrapper_heap_base* heap = nullptr;
+        std::size_t const count =
+            alloc_from_heap(&p, magazine_size, false, &heap);
+
+        // hand out the slots in increasing address order
+        char* last = static_cast<char*>(p) + count * parameters_.element_size;
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            last -= parameters_.element_size;
+            m.slots_[i] = last;
+        }
+        m.count_ = count;
+        m.heap_ = heap;
+    }
+
+    void one_size_heap_list::return_slots(
+        magazine& m, util::wrapper_heap_base* keep)
+    {
+        if (m.busy_.exchange(true, std::memory_order_acquire))
+        {
+            return;
+        }
+
+        // the remaining slots are consecutive, the one with the lowest
+        // address is handed out next
+        util::wrapper_heap_base* heap = m.heap_;
+        std::size_t count = 0;
+        void* p = nullptr;
+        if (m.count_ != 0 && heap != keep)
+        {
+            count = m.count_;
+            p = m.slots_[count - 1];
+            m.count_ = 0;
+        }
+        m.busy_.store(false, std::memory_order_release);
+
+        // the slots were never handed out, thus the statistics of this list
+        // are not updated
+        if (count != 0)
+        {
+            heap->free(p, count);
+        }
+    }
+
+    void one_size_heap_list::return_stale_slots(
+        util::wrapper_heap_base* newest)
+    {
+        std::size_t const num_magazines =
+            num_magazines_.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i != num_magazines; ++i)
+        {
+            return_slots(magazines_[i].data_, newest);
+        }
+    }
+
+    void one_size_heap_list::flush_magazines()
+    {
+        magazines_enabled_.store(false, std::memory_order_release);
+        return_stale_slots(nullptr);
     }
 
     bool one_size_heap_list::reschedule(void* p, std::size_t count)
@@ -168,49 +374,44 @@ namespace hpx { namespace util {
         if (reschedule(p, count))
             return;
 
-        std::unique_lock ul(mtx_);
-
         // Find the heap which allocated this pointer.
-        for (auto& heap : heap_list_)
+        util::wrapper_heap_base* heap = find_heap(p);
+        if (heap == nullptr)
         {
-            bool did_allocate = false;
+            HPX_THROW_EXCEPTION(bad_parameter, name() + "::free",
+                "pointer {1} was not allocated by this {2}", p, name());
+        }
 
-            {
-                util::unlock_guard ull(ul);
-                did_allocate = heap->did_alloc(p);
-                if (did_allocate)
-                {
-                    heap->free(p, count);
-                }
-            }
+        heap->free(p, count);
 
-            if (did_allocate)
-            {
 #if defined(HPX_DEBUG)
-                free_count_ += count;
+        free_count_ += count;
 #endif
-                return;
-            }
-        }
+    }
 
-        ul.unlock();
+    bool one_size_heap_list::did_alloc(void* p) const
+    {
+        return find_heap(p) != nullptr;
+    }
 
-        HPX_THROW_EXCEPTION(bad_parameter, name() + "::free",
-            "pointer {1} was not allocated by this {2}", p, name());
+    util::wrapper_heap_base* one_size_heap_list::find_heap(void* p) const
+    {
+        std::lock_guard l(mtx_);
+        return find_heap_locked(p);
     }
 
-    bool one_size_heap_list::did_alloc(void* p) const
+    util::wrapper_heap_base* one_size_heap_list::find_heap_locked(
+        void* p) const
     {
-        std::unique_lock ul(mtx_);
-        for (typename list_type::value_type const& heap : heap_list_)
+        auto it = heap_map_.upper_bound(reinterpret_cast<std::uintptr_t>(p));
+        if (it == heap_map_.begin())
         {
-            util::unlock_guard ull(ul);
-            if (heap->did_alloc(p))
-            {
-                return true;
-            }
+            return nullptr;
         }
-        return false;
+
+        // the heap might have released its memory already
+        util::wrapper_heap_base* heap = (--it)->second;
+        return heap->did_alloc(p) ? heap : nullptr;
     }
 
     std::string one_size_heap_list::name() const
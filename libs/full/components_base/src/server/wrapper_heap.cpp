@@ -188,6 +188,47 @@ namespace hpx { namespace components { namespace detail {
         return true;
     }
 
+    std::size_t wrapper_heap::alloc_upto(void** result, std::size_t count)
+    {
+        std::unique_lock l(mtx_);
+
+        if (nullptr == pool_)
+            return 0;
+
+        std::size_t const total_num_bytes =
+            parameters_.capacity * parameters_.element_size;
+        std::size_t const available =
+            static_cast<std::size_t>(pool_ + total_num_bytes - first_free_) /
+            parameters_.element_size;
+
+        if (count > available)
+            count = available;
+        if (count == 0)
+            return 0;
+
+        util::itt::heap_allocate heap_allocate(heap_alloc_function_, result,
+            count * parameters_.element_size,
+            HPX_WRAPPER_HEAP_INITIALIZED_MEMORY);
+
+#if defined(HPX_DEBUG)
+        alloc_count_ += count;
+#endif
+
+        void* p = first_free_;
+        first_free_ = first_free_ + count * parameters_.element_size;
+
+        HPX_ASSERT(free_size_ >= count);
+        free_size_ -= count;
+
+#if HPX_DEBUG_WRAPPER_HEAP != 0
+        // init memory blocks
+        debug::fill_bytes(p, initial_value, count * parameters_.element_size);
+#endif
+
+        *result = p;
+        return count;
+    }
+
     void wrapper_heap::free(void* p, std::size_t count)
     {
         util::itt::heap_free heap_free(heap_free_function_, p);
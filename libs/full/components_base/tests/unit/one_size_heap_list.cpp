@@ -0,0 +1,135 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test verifies that the heaps of a one_size_heap_list release their
+// memory once all objects allocated from them have been freed, even if some
+// of their memory slots have been cached by the per-thread magazines.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/components_base/server/one_size_heap_list.hpp>
+#include <hpx/components_base/server/wrapper_heap.hpp>
+#include <hpx/include/async.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/thread.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct element
+{
+    double data[4];
+};
+
+using heap_type = hpx::components::detail::fixed_wrapper_heap<element>;
+
+constexpr std::size_t heap_capacity = 64;
+
+class test_heap_list : public hpx::util::one_size_heap_list
+{
+public:
+    test_heap_list()
+      : hpx::util::one_size_heap_list("test_heap_list",
+            heap_parameters{heap_capacity, alignof(element), sizeof(element)},
+            static_cast<heap_type*>(nullptr))
+    {
+    }
+
+    std::size_t num_heaps() const
+    {
+        std::lock_guard l(mtx_);
+        return heap_list_.size();
+    }
+
+    // number of heaps which did not release their memory
+    std::size_t num_active_heaps() const
+    {
+        std::lock_guard l(mtx_);
+
+        std::size_t result = 0;
+        for (auto const& heap : heap_list_)
+        {
+            if (!static_cast<heap_type const&>(*heap).is_empty())
+            {
+                ++result;
+            }
+        }
+        return result;
+    }
+};
+
+// the list has to outlive the runtime, as do the heap lists of components
+test_heap_list heaps;
+
+///////////////////////////////////////////////////////////////////////////////
+void alloc_free(std::size_t iterations, std::size_t count)
+{
+    std::vector<void*> objects;
+    objects.reserve(count);
+
+    for (std::size_t i = 0; i != iterations; ++i)
+    {
+        for (std::size_t j = 0; j != count; ++j)
+        {
+            objects.push_back(heaps.alloc());
+            HPX_TEST(heaps.did_alloc(objects.back()));
+        }
+
+        // give other threads the chance to use the magazine of this worker
+        hpx::this_thread::yield();
+
+        // objects may be freed on any worker thread
+        for (void* p : objects)
+        {
+            heaps.free(p);
+        }
+        objects.clear();
+
+        // allocate multiple objects at once
+        void* p = heaps.alloc(3);
+        HPX_TEST(heaps.did_alloc(p));
+        heaps.free(p, 3);
+    }
+}
+
+void test_heaps_released()
+{
+    std::size_t const num_tasks = 4 * hpx::get_num_worker_threads();
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t i = 0; i != num_tasks; ++i)
+    {
+        futures.push_back(hpx::async(&alloc_free, 100, 1 + i % 50));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST(heaps.num_heaps() > 1);
+
+    // all objects were freed, only slots cached by the magazines and the
+    // slots of the most recent heap which were never allocated may keep
+    // heaps from being released
+    heaps.flush_magazines();
+    HPX_TEST(heaps.num_active_heaps() <= 1);
+
+    // the list keeps working after having been flushed
+    alloc_free(10, heap_capacity);
+    heaps.flush_magazines();
+    HPX_TEST(heaps.num_active_heaps() <= 1);
+}
+
+int main()
+{
+    test_heaps_released();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,500 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file load_aware_distribution_policy.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/actions_base/traits/is_distribution_policy.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/components_base/agas_interface.hpp>
+#include <hpx/functional/bind_back.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_components/create_component_helpers.hpp>
+#include <hpx/serialization/serialization_fwd.hpp>
+#include <hpx/serialization/string.hpp>
+#include <hpx/serialization/vector.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components {
+
+    /// One term of the cost model used by the
+    /// \a load_aware_distribution_policy: the value of the given performance
+    /// counter (queried on each of the localities) multiplied by the given
+    /// weight. The locality referenced by the counter name is replaced with
+    /// the locality the value is retrieved for.
+    struct load_metric
+    {
+        load_metric() = default;
+
+        load_metric(std::string counter_name, double weight)
+          : counter_name_(HPX_MOVE(counter_name))
+          , weight_(weight)
+        {
+        }
+
+        std::string counter_name_;
+        double weight_ = 1.0;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & counter_name_ & weight_;
+            // clang-format on
+        }
+    };
+
+    /// The cost model used by the \a load_aware_distribution_policy. The cost
+    /// of placing an object on a locality is the weighted sum of the counter
+    /// values collected for that locality plus \a placement_cost_ for each
+    /// of the objects placed there since the values were collected. The
+    /// counter values are refreshed in the background if they are older than
+    /// \a refresh_interval_ (in milliseconds).
+    ///
+    /// Counters that are not available on a locality (for instance, the
+    /// memory counters are provided by a plugin) contribute nothing.
+    struct load_cost_model
+    {
+        std::vector<load_metric> metrics_;
+        double placement_cost_ = 1.0;
+        std::int64_t refresh_interval_ = 100;
+
+    private:
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void serialize(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & metrics_ & placement_cost_ & refresh_interval_;
+            // clang-format on
+        }
+    };
+
+    /// Return the cost model used by default: the length of the thread
+    /// queues on each of the localities and (if idle rates are collected)
+    /// the idle rate of the worker threads.
+    HPX_EXPORT load_cost_model default_load_cost_model();
+
+    namespace detail {
+
+        /// \cond NOINTERNAL
+        // Distribute count objects over the localities such that each new
+        // object goes to the locality with the lowest accumulated cost.
+        HPX_EXPORT std::vector<std::size_t> distribute_by_cost(
+            std::size_t count, std::vector<double> costs,
+            double placement_cost);
+
+        // The most recent load values collected for the localities of a
+        // load_aware_distribution_policy, shared by all copies of a policy
+        // instance.
+        class HPX_EXPORT load_snapshot
+          : public std::enable_shared_from_this<load_snapshot>
+        {
+            using mutex_type = hpx::spinlock;
+
+        public:
+            load_snapshot(std::vector<hpx::id_type> localities,
+                load_cost_model model);
+
+            // The returned future becomes ready as soon as load values are
+            // available. A stale snapshot is refreshed asynchronously, the
+            // current values are used in the meantime.
+            hpx::future<void> update();
+
+            // Select the localities the given number of objects should be
+            // placed on (based on the current values), returns the number of
+            // objects per locality.
+            std::vector<std::size_t> place(std::size_t count);
+
+            // Return the current cost of placing an object on each of the
+            // localities.
+            std::vector<double> get_costs() const;
+
+            std::vector<hpx::id_type> const& get_localities() const noexcept
+            {
+                return localities_;
+            }
+
+        private:
+            bool is_stale() const;
+            void refresh(std::unique_lock<mutex_type>& l);
+            void update_values(std::vector<hpx::future<double>>&& values,
+                std::vector<std::size_t> const& placed);
+
+            std::vector<hpx::id_type> const localities_;
+            load_cost_model const model_;
+
+            mutable mutex_type mtx_;
+            std::vector<hpx::shared_future<hpx::id_type>> counters_;
+            std::vector<double> load_;
+            std::vector<std::size_t> placements_;
+            hpx::shared_future<void> pending_;
+            std::uint64_t timestamp_ = 0;
+            bool valid_ = false;
+            bool refreshing_ = false;
+        };
+
+        template <typename Component>
+        struct load_aware_create_helper
+        {
+            explicit load_aware_create_helper(
+                std::shared_ptr<load_snapshot> snapshot)
+              : snapshot_(HPX_MOVE(snapshot))
+            {
+            }
+
+            template <typename... Ts>
+            hpx::future<hpx::id_type> operator()(
+                hpx::future<void>&& f, Ts&&... vs) const
+            {
+                f.get();    // propagate exceptions
+
+                std::vector<std::size_t> counts = snapshot_->place(1);
+                std::vector<hpx::id_type> const& localities =
+                    snapshot_->get_localities();
+
+                for (std::size_t i = 0; i != counts.size(); ++i)
+                {
+                    if (counts[i] != 0)
+                    {
+                        return create_async<Component>(
+                            localities[i], HPX_FORWARD(Ts, vs)...);
+                    }
+                }
+
+                HPX_ASSERT(false);
+                return create_async<Component>(
+                    localities.front(), HPX_FORWARD(Ts, vs)...);
+            }
+
+            std::shared_ptr<load_snapshot> snapshot_;
+        };
+
+        template <typename Component>
+        struct load_aware_bulk_create_helper
+        {
+            using bulk_locality_result =
+                std::pair<hpx::id_type, std::vector<hpx::id_type>>;
+
+            explicit load_aware_bulk_create_helper(
+                std::shared_ptr<load_snapshot> snapshot)
+              : snapshot_(HPX_MOVE(snapshot))
+            {
+            }
+
+            template <typename... Ts>
+            hpx::future<std::vector<bulk_locality_result>> operator()(
+                hpx::future<void>&& f, std::size_t count, Ts&&... vs) const
+            {
+                f.get();    // propagate exceptions
+
+                std::vector<std::size_t> to_create = snapshot_->place(count);
+                std::vector<hpx::id_type> const& all_localities =
+                    snapshot_->get_localities();
+
+                // don't bother localities that don't receive any objects
+                std::vector<hpx::id_type> localities;
+                std::vector<hpx::future<std::vector<hpx::id_type>>> objs;
+                for (std::size_t i = 0; i != to_create.size(); ++i)
+                {
+                    if (to_create[i] != 0)
+                    {
+                        localities.push_back(all_localities[i]);
+                        objs.push_back(bulk_create_async<Component>(
+                            all_localities[i], to_create[i], vs...));
+                    }
+                }
+
+                // consolidate all results
+                return hpx::dataflow(
+                    hpx::launch::sync,
+                    [localities = HPX_MOVE(localities)](
+                        std::vector<hpx::future<std::vector<hpx::id_type>>>&&
+                            v) mutable -> std::vector<bulk_locality_result> {
+                        HPX_ASSERT(localities.size() == v.size());
+
+                        std::vector<bulk_locality_result> result;
+                        result.reserve(v.size());
+
+                        for (std::size_t i = 0; i != v.size(); ++i)
+                        {
+                            result.emplace_back(
+                                HPX_MOVE(localities[i]), v[i].get());
+                        }
+                        return result;
+                    },
+                    HPX_MOVE(objs));
+            }
+
+            std::shared_ptr<load_snapshot> snapshot_;
+        };
+        /// \endcond
+    }    // namespace detail
+
+    /// This class specifies the parameters for a load aware distribution
+    /// policy to use for creating a given number of items on a given set of
+    /// localities. New objects are placed on the localities with the lowest
+    /// cost as determined by a \a load_cost_model from live performance
+    /// counter values (by default the length of the thread queues).
+    ///
+    /// The counter values are collected when the policy is used for the
+    /// first time and are refreshed asynchronously afterwards. All copies
+    /// of a policy instance share the collected values, thus a policy
+    /// instance should be kept around if it is used repeatedly.
+    struct load_aware_distribution_policy
+    {
+    public:
+        /// Default-construct a new instance of a
+        /// \a load_aware_distribution_policy. This policy will represent one
+        /// locality (the local locality).
+        load_aware_distribution_policy() = default;
+
+        /// Create a new \a load_aware_distribution_policy representing the
+        /// given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        /// \param model    [in] The cost model used to select the localities
+        ///                 new objects are placed on.
+        ///
+        load_aware_distribution_policy operator()(
+            std::vector<id_type> const& locs,
+            load_cost_model model = default_load_cost_model()) const
+        {
+#if defined(HPX_DEBUG)
+            for (id_type const& loc : locs)
+            {
+                HPX_ASSERT(naming::is_locality(loc));
+            }
+#endif
+            return load_aware_distribution_policy(locs, HPX_MOVE(model));
+        }
+
+        /// Create a new \a load_aware_distribution_policy representing the
+        /// given set of localities.
+        ///
+        /// \param locs     [in] The list of localities the new instance should
+        ///                 represent
+        /// \param model    [in] The cost model used to select the localities
+        ///                 new objects are placed on.
+        ///
+        load_aware_distribution_policy operator()(std::vector<id_type>&& locs,
+            load_cost_model model = default_load_cost_model()) const
+        {
+#if defined(HPX_DEBUG)
+            for (id_type const& loc : locs)
+            {
+                HPX_ASSERT(naming::is_locality(loc));
+            }
+#endif
+            return load_aware_distribution_policy(
+                HPX_MOVE(locs), HPX_MOVE(model));
+        }
+
+        /// Create a new \a load_aware_distribution_policy representing the
+        /// given locality
+        ///
+        /// \param loc     [in] The locality the new instance should
+        ///                 represent
+        ///
+        load_aware_distribution_policy operator()(id_type const& loc) const
+        {
+            HPX_ASSERT(naming::is_locality(loc));
+            return load_aware_distribution_policy(
+                std::vector<id_type>{loc}, load_cost_model());
+        }
+
+        /// Create one object on one of the localities associated by
+        /// this policy instance
+        ///
+        /// \param vs  [in] The arguments which will be forwarded to the
+        ///            constructor of the new object.
+        ///
+        /// \returns A future holding the global address which represents
+        ///          the newly created object
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<hpx::id_type> create(Ts&&... vs) const
+        {
+            // handle special cases
+            if (localities_.size() == 0)
+            {
+                return create_async<Component>(
+                    naming::get_id_from_locality_id(agas::get_locality_id()),
+                    HPX_FORWARD(Ts, vs)...);
+            }
+            else if (localities_.size() == 1)
+            {
+                return create_async<Component>(
+                    localities_.front(), HPX_FORWARD(Ts, vs)...);
+            }
+
+            HPX_ASSERT(snapshot_);
+            return snapshot_->update().then(hpx::bind_back(
+                detail::load_aware_create_helper<Component>(snapshot_),
+                HPX_FORWARD(Ts, vs)...));
+        }
+
+        /// \cond NOINTERNAL
+        using bulk_locality_result =
+            std::pair<hpx::id_type, std::vector<hpx::id_type>>;
+        /// \endcond
+
+        /// Create multiple objects on the localities associated by
+        /// this policy instance
+        ///
+        /// \param count [in] The number of objects to create
+        /// \param vs   [in] The arguments which will be forwarded to the
+        ///             constructors of the new objects.
+        ///
+        /// \returns A future holding the list of global addresses which
+        ///          represent the newly created objects
+        ///
+        template <typename Component, typename... Ts>
+        hpx::future<std::vector<bulk_locality_result>> bulk_create(
+            std::size_t count, Ts&&... vs) const
+        {
+            if (localities_.size() > 1)
+            {
+                HPX_ASSERT(snapshot_);
+                return snapshot_->update().then(hpx::bind_back(
+                    detail::load_aware_bulk_create_helper<Component>(
+                        snapshot_),
+                    count, HPX_FORWARD(Ts, vs)...));
+            }
+
+            // handle special cases
+            hpx::id_type id = localities_.empty() ?
+                naming::get_id_from_locality_id(agas::get_locality_id()) :
+                localities_.front();
+
+            hpx::future<std::vector<hpx::id_type>> f =
+                bulk_create_async<Component>(id, count, HPX_FORWARD(Ts, vs)...);
+
+            return f.then(hpx::launch::sync,
+                [id = HPX_MOVE(id)](hpx::future<std::vector<hpx::id_type>>&& f)
+                    -> std::vector<bulk_locality_result> {
+                    std::vector<bulk_locality_result> result;
+                    result.emplace_back(id, f.get());
+                    return result;
+                });
+        }
+
+        /// Returns the cost model associated with this policy instance.
+        load_cost_model const& get_cost_model() const noexcept
+        {
+            return model_;
+        }
+
+        /// Returns the current cost of placing an object on each of the
+        /// associated localities (all zero as long as no load values have
+        /// been collected).
+        std::vector<double> get_costs() const
+        {
+            if (!snapshot_)
+            {
+                return std::vector<double>(localities_.size(), 0.0);
+            }
+            return snapshot_->get_costs();
+        }
+
+        /// Returns the number of associated localities for this distribution
+        /// policy
+        ///
+        /// \note This function is part of the creation policy implemented by
+        ///       this class
+        ///
+        std::size_t get_num_localities() const
+        {
+            return localities_.size();
+        }
+
+    protected:
+        /// \cond NOINTERNAL
+        load_aware_distribution_policy(
+            std::vector<id_type> localities, load_cost_model model)
+          : localities_(HPX_MOVE(localities))
+          , model_(HPX_MOVE(model))
+        {
+            create_snapshot();
+        }
+
+        void create_snapshot()
+        {
+            if (localities_.size() > 1)
+            {
+                snapshot_ = std::make_shared<detail::load_snapshot>(
+                    localities_, model_);
+            }
+        }
+
+        friend class hpx::serialization::access;
+
+        template <typename Archive>
+        void save(Archive& ar, unsigned int const) const
+        {
+            // clang-format off
+            ar & model_ & localities_;
+            // clang-format on
+        }
+
+        // the collected load values are not sent along, the receiving side
+        // collects its own
+        template <typename Archive>
+        void load(Archive& ar, unsigned int const)
+        {
+            // clang-format off
+            ar & model_ & localities_;
+            // clang-format on
+            create_snapshot();
+        }
+
+        HPX_SERIALIZATION_SPLIT_MEMBER()
+
+        std::vector<id_type> localities_;    // localities to create things on
+        load_cost_model model_;
+        std::shared_ptr<detail::load_snapshot> snapshot_;
+        /// \endcond
+    };
+
+    /// A predefined instance of the load aware \a distribution_policy. It
+    /// will represent the local locality and will place all items to create
+    /// here.
+    static load_aware_distribution_policy const load_aware{};
+}}    // namespace hpx::components
+
+/// \cond NOINTERNAL
+namespace hpx {
+
+    using hpx::components::load_aware;
+    using hpx::components::load_aware_distribution_policy;
+
+    namespace traits {
+        template <>
+        struct is_distribution_policy<
+            components::load_aware_distribution_policy> : std::true_type
+        {
+        };
+    }    // namespace traits
+}    // namespace hpx
+/// \endcond
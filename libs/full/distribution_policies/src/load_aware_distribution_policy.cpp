@@ -0,0 +1,268 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/distribution_policies/load_aware_distribution_policy.hpp>
+#include <hpx/futures/promise.hpp>
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/performance_counters/counters.hpp>
+#include <hpx/performance_counters/performance_counter.hpp>
+#include <hpx/timing/high_resolution_clock.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components {
+
+    load_cost_model default_load_cost_model()
+    {
+        load_cost_model model;
+
+        // every queued thread counts as one unit of load
+        model.metrics_.emplace_back(
+            "/threadqueue{locality#0/total}/length", 1.0);
+
+#if defined(HPX_HAVE_THREAD_IDLE_RATES)
+        // an idle locality (the idle rate is measured in 0.01%) weighs as
+        // much as 10 queued threads less than a fully busy one
+        model.metrics_.emplace_back(
+            "/threads{locality#0/total}/idle-rate", -0.001);
+#endif
+        return model;
+    }
+}}    // namespace hpx::components
+
+namespace hpx { namespace components { namespace detail {
+
+    ///////////////////////////////////////////////////////////////////////////
+    std::vector<std::size_t> distribute_by_cost(
+        std::size_t count, std::vector<double> costs, double placement_cost)
+    {
+        std::vector<std::size_t> result(costs.size(), 0);
+        if (costs.empty())
+        {
+            return result;
+        }
+
+        for (std::size_t i = 0; i != count; ++i)
+        {
+            auto it = std::min_element(costs.begin(), costs.end());
+            ++result[std::distance(costs.begin(), it)];
+            *it += placement_cost;
+        }
+        return result;
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    namespace {
+
+        hpx::future<hpx::id_type> get_counter_for(
+            std::string const& name, hpx::id_type const& locality)
+        {
+            using namespace hpx::performance_counters;
+
+            counter_path_elements p;
+            get_counter_path_elements(name, p);
+
+            std::string full_name;
+            p.parentinstanceindex_ = naming::get_locality_id_from_id(locality);
+            get_counter_name(p, full_name);
+
+            return get_counter_async(full_name);
+        }
+
+        hpx::future<double> get_counter_value(
+            hpx::shared_future<hpx::id_type> const& counter)
+        {
+            return counter.then(hpx::launch::sync,
+                [](hpx::shared_future<hpx::id_type>&& f)
+                    -> hpx::future<double> {
+                    return performance_counters::performance_counter(f.get())
+                        .get_value<double>();
+                });
+        }
+    }    // namespace
+
+    load_snapshot::load_snapshot(
+        std::vector<hpx::id_type> localities, load_cost_model model)
+      : localities_(HPX_MOVE(localities))
+      , model_(HPX_MOVE(model))
+      , load_(localities_.size(), 0.0)
+      , placements_(localities_.size(), 0)
+    {
+    }
+
+    bool load_snapshot::is_stale() const
+    {
+        std::uint64_t const interval =
+            std::uint64_t(model_.refresh_interval_) * 1000000;
+        return hpx::chrono::high_resolution_clock::now() - timestamp_ >=
+            interval;
+    }
+
+    hpx::future<void> load_snapshot::update()
+    {
+        std::unique_lock<mutex_type> l(mtx_);
+        if (!refreshing_ && (!valid_ || is_stale()))
+        {
+            refresh(l);
+        }
+
+        if (valid_ || model_.metrics_.empty())
+        {
+            return hpx::make_ready_future();
+        }
+
+        // no values have been collected yet, wait for the first refresh
+        hpx::shared_future<void> f = pending_;
+        l.unlock();
+
+        return f.then(hpx::launch::sync,
+            [](hpx::shared_future<void>&& f) -> void { f.get(); });
+    }
+
+    void load_snapshot::refresh(std::unique_lock<mutex_type>& l)
+    {
+        HPX_ASSERT(l.owns_lock());
+        HPX_ASSERT(!refreshing_);
+
+        refreshing_ = true;
+
+        hpx::promise<void> p;
+        pending_ = p.get_future().share();
+
+        // create the counters (asynchronously) when used for the first time
+        std::size_t const num_metrics = model_.metrics_.size();
+        if (counters_.empty())
+        {
+            counters_.reserve(localities_.size() * num_metrics);
+            for (hpx::id_type const& locality : localities_)
+            {
+                for (load_metric const& metric : model_.metrics_)
+                {
+                    try
+                    {
+                        counters_.push_back(
+                            get_counter_for(metric.counter_name_, locality));
+                    }
+                    catch (...)
+                    {
+                        counters_.push_back(
+                            hpx::make_exceptional_future<hpx::id_type>(
+                                std::current_exception()));
+                    }
+                }
+            }
+        }
+
+        // the objects placed so far are reflected by the values queried now
+        std::vector<std::size_t> placed = placements_;
+
+        std::vector<hpx::shared_future<hpx::id_type>> counters = counters_;
+        l.unlock();
+
+        std::vector<hpx::future<double>> values;
+        values.reserve(counters.size());
+        for (hpx::shared_future<hpx::id_type> const& counter : counters)
+        {
+            values.push_back(get_counter_value(counter));
+        }
+
+        hpx::when_all(HPX_MOVE(values))
+            .then(hpx::launch::sync,
+                [self = shared_from_this(), placed = HPX_MOVE(placed),
+                    p = HPX_MOVE(p)](
+                    hpx::future<std::vector<hpx::future<double>>>&&
+                        f) mutable {
+                    self->update_values(f.get(), placed);
+                    p.set_value();
+                });
+
+        l.lock();
+    }
+
+    void load_snapshot::update_values(
+        std::vector<hpx::future<double>>&& values,
+        std::vector<std::size_t> const& placed)
+    {
+        std::size_t const num_metrics = model_.metrics_.size();
+        HPX_ASSERT(values.size() == localities_.size() * num_metrics);
+
+        std::vector<double> load(localities_.size(), 0.0);
+        for (std::size_t i = 0; i != localities_.size(); ++i)
+        {
+            for (std::size_t m = 0; m != num_metrics; ++m)
+            {
+                hpx::future<double>& value = values[i * num_metrics + m];
+                if (value.has_exception())
+                {
+                    // the counter is not available on this locality
+                    LRT_(debug).format(
+                        "load_snapshot: counter {} is not available on {}",
+                        model_.metrics_[m].counter_name_, localities_[i]);
+                    continue;
+                }
+                load[i] += model_.metrics_[m].weight_ * value.get();
+            }
+        }
+
+        std::lock_guard<mutex_type> l(mtx_);
+
+        // the new values reflect the objects placed before the refresh
+        // started, objects placed while it was in progress are still counted
+        load_ = HPX_MOVE(load);
+        for (std::size_t i = 0; i != placements_.size(); ++i)
+        {
+            HPX_ASSERT(placements_[i] >= placed[i]);
+            placements_[i] -= placed[i];
+        }
+        timestamp_ = hpx::chrono::high_resolution_clock::now();
+        valid_ = true;
+        refreshing_ = false;
+    }
+
+    std::vector<std::size_t> load_snapshot::place(std::size_t count)
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        std::vector<double> costs(load_);
+        for (std::size_t i = 0; i != costs.size(); ++i)
+        {
+            costs[i] += double(placements_[i]) * model_.placement_cost_;
+        }
+
+        std::vector<std::size_t> result =
+            distribute_by_cost(count, HPX_MOVE(costs), model_.placement_cost_);
+
+        for (std::size_t i = 0; i != result.size(); ++i)
+        {
+            placements_[i] += result[i];
+        }
+        return result;
+    }
+
+    std::vector<double> load_snapshot::get_costs() const
+    {
+        std::lock_guard<mutex_type> l(mtx_);
+
+        std::vector<double> costs(load_);
+        for (std::size_t i = 0; i != costs.size(); ++i)
+        {
+            costs[i] += double(placements_[i]) * model_.placement_cost_;
+        }
+        return costs;
+    }
+}}}    // namespace hpx::components::detail
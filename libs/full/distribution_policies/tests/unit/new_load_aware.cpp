@@ -0,0 +1,139 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call)
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+typedef test_server::call_action call_action;
+HPX_REGISTER_ACTION(call_action)
+
+///////////////////////////////////////////////////////////////////////////////
+std::string const counter_name =
+    std::string(hpx::components::default_binpacking_counter_name) +
+    "test_server";
+
+std::uint64_t count_instances(hpx::id_type const& locality)
+{
+    hpx::performance_counters::performance_counter instances(
+        counter_name, locality);
+    return instances.get_value<std::uint64_t>(hpx::launch::sync);
+}
+
+// use the number of existing instances as the load metric, this makes the
+// placement decisions predictable
+hpx::components::load_cost_model instances_cost_model()
+{
+    hpx::components::load_cost_model model;
+    model.metrics_.emplace_back(counter_name, 1.0);
+    model.placement_cost_ = 1.0;
+    model.refresh_interval_ = 0;
+    return model;
+}
+
+std::vector<hpx::id_type> test_load_aware_bulk()
+{
+    std::vector<hpx::id_type> keep_alive;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    // create an increasing number of instances on all available localities
+    std::size_t count = 0;
+    for (std::size_t i = 0; i != localities.size(); ++i)
+    {
+        for (hpx::id_type const& id :
+            hpx::new_<test_server[]>(localities[i], i + 1).get())
+        {
+            keep_alive.push_back(id);
+        }
+        count += i + 1;
+    }
+
+    // the load aware policy should fill up the localities such that all of
+    // them end up with the same number of instances
+    hpx::components::load_aware_distribution_policy policy =
+        hpx::load_aware(localities, instances_cost_model());
+
+    for (hpx::id_type const& id : hpx::new_<test_server[]>(policy, count).get())
+    {
+        keep_alive.push_back(id);
+    }
+
+    for (hpx::id_type const& locality : localities)
+    {
+        HPX_TEST_EQ(count_instances(locality), localities.size() + 1);
+    }
+
+    // the placements are accounted for until the values are refreshed
+    std::vector<double> costs = policy.get_costs();
+    HPX_TEST_EQ(costs.size(), localities.size());
+    for (double cost : costs)
+    {
+        HPX_TEST_EQ(cost, double(localities.size() + 1));
+    }
+
+    return keep_alive;
+}
+
+void test_load_aware_single()
+{
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    // the default cost model relies on the live load of the localities
+    hpx::components::load_aware_distribution_policy policy =
+        hpx::load_aware(localities);
+
+    std::vector<hpx::id_type> ids;
+    for (std::size_t i = 0; i != 2 * localities.size(); ++i)
+    {
+        ids.push_back(hpx::new_<test_server>(policy).get());
+    }
+
+    for (hpx::id_type const& id : ids)
+    {
+        hpx::id_type here = hpx::async<call_action>(id).get();
+        HPX_TEST(std::find(localities.begin(), localities.end(), here) !=
+            localities.end());
+    }
+
+    // a single locality is used directly
+    hpx::id_type id = hpx::new_<test_server>(hpx::load_aware).get();
+    HPX_TEST_EQ(hpx::async<call_action>(id).get(), hpx::find_here());
+}
+
+int main()
+{
+    std::vector<hpx::id_type> ids = test_load_aware_bulk();
+    (void) ids;
+
+    test_load_aware_single();
+
+    return hpx::util::report_errors();
+}
+#endif
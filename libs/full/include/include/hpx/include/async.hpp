@@ -12,5 +12,6 @@
 #include <hpx/async_colocated/async_colocated.hpp>
 #include <hpx/async_colocated/async_colocated_callback.hpp>
 #include <hpx/async_distributed/async.hpp>
+#include <hpx/async_distributed/async_bulk.hpp>
 #include <hpx/async_distributed/async_callback.hpp>
 #include <hpx/async_distributed/async_continue_callback.hpp>
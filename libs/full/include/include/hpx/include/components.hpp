@@ -39,6 +39,7 @@
 #include <hpx/components_base/server/managed_component_base.hpp>
 #include <hpx/components_base/server/migration_support.hpp>
 
+#include <hpx/runtime_distributed/auto_migration.hpp>
 #include <hpx/runtime_distributed/copy_component.hpp>
 #include <hpx/runtime_distributed/migrate_component.hpp>
 #include <hpx/runtime_distributed/runtime_support.hpp>
@@ -46,5 +47,6 @@
 
 #include <hpx/distribution_policies/binpacking_distribution_policy.hpp>
 #include <hpx/distribution_policies/colocating_distribution_policy.hpp>
+#include <hpx/distribution_policies/load_aware_distribution_policy.hpp>
 #include <hpx/distribution_policies/target_distribution_policy.hpp>
 #include <hpx/distribution_policies/unwrapping_result_policy.hpp>
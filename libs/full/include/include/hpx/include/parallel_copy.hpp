@@ -7,5 +7,8 @@
 
 #pragma once
 
+#include <hpx/config.hpp>
 #include <hpx/parallel/algorithms/copy.hpp>
 #include <hpx/parallel/container_algorithms/copy.hpp>
+
+#include <hpx/parallel/segmented_algorithms/copy.hpp>
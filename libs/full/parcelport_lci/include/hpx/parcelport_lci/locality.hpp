@@ -12,7 +12,9 @@
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_LCI)
 #include <hpx/modules/serialization.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 
 namespace hpx::parcelset::policies::lci {
 
@@ -59,6 +61,11 @@ namespace hpx::parcelset::policies::lci {
             return lhs.rank_ < rhs.rank_;
         }
 
+        friend std::size_t hash_value(locality const& loc) noexcept
+        {
+            return std::hash<std::int32_t>()(loc.rank_);
+        }
+
         friend HPX_EXPORT std::ostream& operator<<(
             std::ostream& os, locality const& loc) noexcept;
 
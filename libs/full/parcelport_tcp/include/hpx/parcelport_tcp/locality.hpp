@@ -15,7 +15,9 @@
 #if defined(HPX_HAVE_NETWORKING) && defined(HPX_HAVE_PARCELPORT_TCP)
 #include <hpx/modules/serialization.hpp>
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <string>
 
 namespace hpx::parcelset::policies::tcp {
@@ -70,6 +72,11 @@ namespace hpx::parcelset::policies::tcp {
                 (lhs.address_ == rhs.address_ && lhs.port_ < rhs.port_);
         }
 
+        friend std::size_t hash_value(locality const& loc) noexcept
+        {
+            return std::hash<std::string>()(loc.address_) * 31 + loc.port_;
+        }
+
         friend HPX_EXPORT std::ostream& operator<<(
             std::ostream& os, locality const& loc) noexcept;
 
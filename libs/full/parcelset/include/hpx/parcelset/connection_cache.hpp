@@ -19,15 +19,18 @@
 
 #if defined(HPX_HAVE_NETWORKING)
 #include <hpx/assert.hpp>
+#include <hpx/modules/concurrency.hpp>
 #include <hpx/modules/datastructures.hpp>
 #include <hpx/modules/errors.hpp>
 #include <hpx/modules/logging.hpp>
 #include <hpx/modules/synchronization.hpp>
 #include <hpx/modules/util.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <list>
 #include <map>
 #include <memory>
@@ -42,8 +45,15 @@ namespace hpx { namespace util {
     ///////////////////////////////////////////////////////////////////////////
     /// This class implements an LRU cache to hold connections. It includes
     /// entries checked out from the cache in its cache size.
-    // TODO: investigate usage of boost.cache.
-    template <typename Connection, typename Key>
+    ///
+    /// The cache is split into a number of shards, each of which is protected
+    /// by its own lock and manages the connections to a subset of the keys
+    /// (selected based on the hash value of the key). Threads accessing
+    /// connections to different destinations are therefore unlikely to
+    /// contend with each other. The overall connection limit is enforced
+    /// across all shards, the LRU order is maintained per shard.
+    template <typename Connection, typename Key,
+        typename Hash = std::hash<Key>>
     class connection_cache
     {
     public:
@@ -62,12 +72,26 @@ namespace hpx { namespace util {
         using cache_type = std::map<key_type, cache_value_type>;
         using size_type = typename cache_type::size_type;
 
-        connection_cache(
-            size_type max_connections, size_type max_connections_per_locality)
+    private:
+        struct shard
+        {
+            mutable mutex_type mtx_;
+            key_tracker_type key_tracker_;
+            cache_type cache_;
+        };
+
+        using shard_type = hpx::util::cache_aligned_data<shard>;
+
+    public:
+        connection_cache(size_type max_connections,
+            size_type max_connections_per_locality,
+            size_type num_shards = HPX_PARCEL_CONNECTION_CACHE_SHARDS)
           : max_connections_(max_connections < 2 ? 2 : max_connections)
           , max_connections_per_locality_(max_connections_per_locality < 2 ?
                     2 :
                     max_connections_per_locality)
+          , num_shards_(num_shards == 0 ? 1 : num_shards)
+          , shards_(new shard_type[num_shards_])
           , connections_(0)
           , shutting_down_(false)
           , insertions_(0)
@@ -75,6 +99,7 @@ namespace hpx { namespace util {
           , hits_(0)
           , misses_(0)
           , reclaims_(0)
+          , contentions_(0)
         {
             if (max_connections_per_locality_ > max_connections_)
             {
@@ -133,6 +158,25 @@ namespace hpx { namespace util {
         }
 
         ///////////////////////////////////////////////////////////////////////
+        // Return the shard responsible for the given key.
+        shard& shard_for(key_type const& l) const
+        {
+            return shards_[Hash()(l) % num_shards_].data_;
+        }
+
+        // Acquire the lock of the given shard, count the number of times the
+        // lock was not immediately available.
+        std::unique_lock<mutex_type> lock_shard(shard const& s) const
+        {
+            std::unique_lock<mutex_type> lock(s.mtx_, std::try_to_lock);
+            if (!lock.owns_lock())
+            {
+                contentions_.fetch_add(1, std::memory_order_relaxed);
+                lock.lock();
+            }
+            return lock;
+        }
+
         // Increase the per-locality and overall connection counts.
         void increment_connection_count(cache_value_type& e)
         {
@@ -177,18 +221,19 @@ namespace hpx { namespace util {
         ///          \a reclaim().
         connection_type get(key_type const& l)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            shard& s = shard_for(l);
+            std::unique_lock<mutex_type> lock = lock_shard(s);
 
             // Check if this key already exists in the cache.
-            typename cache_type::iterator const it = cache_.find(l);
+            typename cache_type::iterator const it = s.cache_.find(l);
 
             // Check if this key already exists in the cache.
-            if (it != cache_.end())
+            if (it != s.cache_.end())
             {
                 // Key exists in cache.
 
                 // Update LRU meta data.
-                key_tracker_.splice(key_tracker_.end(), key_tracker_,
+                s.key_tracker_.splice(s.key_tracker_.end(), s.key_tracker_,
                     lru_reference(it->second));
 
                 // If connections to the locality are available in the cache,
@@ -200,14 +245,14 @@ namespace hpx { namespace util {
                     connections.pop_front();
 
                     ++hits_;
-                    check_invariants();
+                    check_invariants(s);
                     return result;
                 }
             }
 
             // If we get here then the item is not in the cache.
             ++misses_;
-            check_invariants();
+            check_invariants(s);
             return connection_type();
         }
 
@@ -231,17 +276,18 @@ namespace hpx { namespace util {
         bool get_or_reserve(
             key_type const& l, connection_type& conn, bool force_insert = false)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            shard& s = shard_for(l);
+            std::unique_lock<mutex_type> lock = lock_shard(s);
 
-            typename cache_type::iterator const it = cache_.find(l);
+            typename cache_type::iterator const it = s.cache_.find(l);
 
             // Check if this key already exists in the cache.
-            if (it != cache_.end())
+            if (it != s.cache_.end())
             {
                 // Key exists in cache.
 
                 // Update LRU meta data.
-                key_tracker_.splice(key_tracker_.end(), key_tracker_,
+                s.key_tracker_.splice(s.key_tracker_.end(), s.key_tracker_,
                     lru_reference(it->second));
 
                 // If connections to the locality are available in the cache,
@@ -256,7 +302,7 @@ namespace hpx { namespace util {
                     conn->set_state(Connection::state_reinitialized);
 #endif
                     ++hits_;
-                    check_invariants();
+                    check_invariants(s);
                     return true;
                 }
 
@@ -275,13 +321,13 @@ namespace hpx { namespace util {
                     // reduced in size next time some connection is handed back
                     // to the cache).
 
-                    if (!free_space() &&
+                    if (!free_space(s) &&
                         num_existing_connections(it->second) != 0 &&
                         !force_insert)
                     {
                         // If we can't find or make space, give up.
                         ++misses_;
-                        check_invariants();
+                        check_invariants(s);
                         return false;
                     }
 
@@ -294,7 +340,7 @@ namespace hpx { namespace util {
 
                     // Statistics
                     ++insertions_;
-                    check_invariants();
+                    check_invariants(s);
                     return true;
                 }
 
@@ -302,7 +348,7 @@ namespace hpx { namespace util {
                 // locality, and none of them are checked into the cache, so
                 // we have to give up.
                 ++misses_;
-                check_invariants();
+                check_invariants(s);
                 return false;
             }
 
@@ -316,13 +362,13 @@ namespace hpx { namespace util {
             // fails we grow the cache size beyond its limit (hoping that it
             // will be reduced in size next time some connection is handed back
             // to the cache).
-            free_space();
+            free_space(s);
 
             // Update LRU meta data.
             typename key_tracker_type::iterator kt =
-                key_tracker_.insert(key_tracker_.end(), l);
+                s.key_tracker_.insert(s.key_tracker_.end(), l);
 
-            cache_.insert(std::make_pair(l,
+            s.cache_.insert(std::make_pair(l,
                 hpx::make_tuple(
                     value_type(), 1, max_connections_per_locality_, kt)));
 
@@ -333,7 +379,7 @@ namespace hpx { namespace util {
             ++connections_;
 
             ++insertions_;
-            check_invariants();
+            check_invariants(s);
             return true;
         }
 
@@ -343,15 +389,16 @@ namespace hpx { namespace util {
         ///       a prior call to \a get() or \a get_or_reserve().
         void reclaim(key_type const& l, connection_type const& conn)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            shard& s = shard_for(l);
+            std::unique_lock<mutex_type> lock = lock_shard(s);
 
             // Search for an entry for this key.
-            typename cache_type::iterator const ct = cache_.find(l);
+            typename cache_type::iterator const ct = s.cache_.find(l);
 
-            if (ct != cache_.end())
+            if (ct != s.cache_.end())
             {
                 // Update LRU meta data.
-                key_tracker_.splice(key_tracker_.end(), key_tracker_,
+                s.key_tracker_.splice(s.key_tracker_.end(), s.key_tracker_,
                     lru_reference(ct->second));
 
                 // Return the connection back to the cache only if the number
@@ -384,7 +431,7 @@ namespace hpx { namespace util {
 
                 // FIXME: Again, this should probably throw instead of asserting,
                 // as invariants could be invalidated here due to caller error.
-                check_invariants();
+                check_invariants(s);
             }
         }
 
@@ -392,7 +439,6 @@ namespace hpx { namespace util {
         /// than the maximum number of overall connections, and false otherwise.
         bool full() const
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return (connections_ >= max_connections_);
         }
 
@@ -400,13 +446,13 @@ namespace hpx { namespace util {
         /// than the maximum connection count per locality, and false otherwise.
         bool full(key_type const& l) const
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            shard const& s = shard_for(l);
+            std::unique_lock<mutex_type> lock = lock_shard(s);
 
-            if (!cache_.count(l))
-                return false || (connections_ >= max_connections_);
+            typename cache_type::const_iterator ct = s.cache_.find(l);
+            if (ct == s.cache_.end())
+                return (connections_ >= max_connections_);
 
-            typename cache_type::const_iterator ct = cache_.find(l);
-            HPX_ASSERT(ct != cache_.end());
             return (num_existing_connections(ct->second) >=
                        max_num_connections(ct->second)) ||
                 (connections_ >= max_connections_);
@@ -419,9 +465,19 @@ namespace hpx { namespace util {
         ///       invariants.
         void clear()
         {
-            std::lock_guard<mutex_type> lock(mtx_);
-            key_tracker_.clear();
-            cache_.clear();
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& s = shards_[i].data_;
+                std::unique_lock<mutex_type> lock = lock_shard(s);
+
+                s.key_tracker_.clear();
+                s.cache_.clear();
+
+                // FIXME: This should probably throw instead of asserting, as
+                // it can be triggered by caller error.
+                check_invariants(s);
+            }
+
             connections_ = 0;
 
             insertions_ = 0;
@@ -429,10 +485,7 @@ namespace hpx { namespace util {
             hits_ = 0;
             misses_ = 0;
             reclaims_ = 0;
-
-            // FIXME: This should probably throw instead of asserting, as it
-            // can be triggered by caller error.
-            check_invariants();
+            contentions_ = 0;
         }
 
         /// Destroys all connections for the given locality in the cache, reset
@@ -443,38 +496,40 @@ namespace hpx { namespace util {
         ///       invariants.
         void clear(key_type const& l)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            shard& s = shard_for(l);
+            std::unique_lock<mutex_type> lock = lock_shard(s);
 
             // Check if this key already exists in the cache.
-            typename cache_type::iterator it = cache_.find(l);
-            if (it != cache_.end())
+            typename cache_type::iterator it = s.cache_.find(l);
+            if (it != s.cache_.end())
             {
                 // Remove from LRU meta data.
-                key_tracker_.erase(lru_reference(it->second));
+                s.key_tracker_.erase(lru_reference(it->second));
 
                 // correct counter to avoid assertions later on
                 std::size_t num_existing = num_existing_connections(it->second);
                 connections_ -= num_existing;
-                evictions_ += num_existing;
+                evictions_ += static_cast<std::int64_t>(num_existing);
 
                 // Erase entry if key exists in the cache.
-                cache_.erase(it);
+                s.cache_.erase(it);
             }
 
             // FIXME: This should probably throw instead of asserting, as it
             // can be triggered by caller error.
-            check_invariants();
+            check_invariants(s);
         }
 
         /// Destroys all connections for the given locality in the cache, reset
         /// all associated counts.
         void clear(key_type const& l, connection_type const& conn)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
+            shard& s = shard_for(l);
+            std::unique_lock<mutex_type> lock = lock_shard(s);
 
             // Check if this key already exists in the cache.
-            typename cache_type::iterator const it = cache_.find(l);
-            if (it != cache_.end())
+            typename cache_type::iterator const it = s.cache_.find(l);
+            if (it != s.cache_.end())
             {
                 // Adjust the number of existing connections for this key.
                 decrement_connection_count(it->second);
@@ -490,50 +545,51 @@ namespace hpx { namespace util {
 #endif
             }
 
-            check_invariants();
+            check_invariants(s);
         }
 
         // access statistics
         std::int64_t get_cache_insertions(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(insertions_, reset);
         }
 
         std::int64_t get_cache_evictions(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(evictions_, reset);
         }
 
         std::int64_t get_cache_hits(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(hits_, reset);
         }
 
         std::int64_t get_cache_misses(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(misses_, reset);
         }
 
         std::int64_t get_cache_reclaims(bool reset)
         {
-            std::lock_guard<mutex_type> lock(mtx_);
             return util::get_and_reset_value(reclaims_, reset);
         }
 
+        // number of times a thread had to wait for a shard of the cache to
+        // become available
+        std::int64_t get_cache_contentions(bool reset)
+        {
+            return util::get_and_reset_value(contentions_, reset);
+        }
+
     private:
-        /// Verify class invariants
-        void check_invariants() const
+        /// Verify class invariants for the given (locked) shard
+        void check_invariants([[maybe_unused]] shard const& s) const
         {
 #if defined(HPX_DEBUG)
             using const_iterator = typename cache_type::const_iterator;
 
-            size_type in_cache_count = 0, total_count = 0;
-            const_iterator end = cache_.end();
-            for (const_iterator ct = cache_.begin(); ct != end; ++ct)
+            const_iterator end = s.cache_.end();
+            for (const_iterator ct = s.cache_.begin(); ct != end; ++ct)
             {
                 cache_value_type const& val = ct->second;
 
@@ -543,45 +599,64 @@ namespace hpx { namespace util {
                 // The separate item counter has to properly count all the
                 // existing elements, not only those in the cache entry.
                 HPX_ASSERT(num_connections <= num_existing);
-
-                // Count all connections (both those in the cache and those
-                // checked out of the cache).
-                in_cache_count += num_connections;
-                total_count += num_existing;
             }
 
-            // Overall connection count should be larger than or equal to the
-            // number of entries in the cache.
-            HPX_ASSERT(in_cache_count <= connections_);
-
-            // Overall connection count should be equal to the sum of connection
-            // counts for all localities.
-            HPX_ASSERT(total_count == connections_);
-
             // The list of key trackers should have the same size as the cache.
-            HPX_ASSERT(key_tracker_.size() == cache_.size());
+            HPX_ASSERT(s.key_tracker_.size() == s.cache_.size());
 #endif
         }
 
         /// Evict the least recently used removable entry from the cache if the
-        /// cache is full.
+        /// cache is full. Entries are evicted from the given (locked) shard
+        /// first. Other shards are considered only if their lock is available
+        /// right away.
         ///
         /// \returns Returns true if an entry was evicted or if the cache is not
         ///          full, and false if nothing could be evicted.
-        bool free_space()
+        bool free_space(shard& s)
         {
             // If the cache isn't full, just return true.
             if (connections_ < max_connections_)
                 return true;
 
+            if (free_space_locked(s))
+                return true;
+
+            for (std::size_t i = 0; i != num_shards_; ++i)
+            {
+                shard& other = shards_[i].data_;
+                if (&other == &s)
+                    continue;
+
+                // never block on another shard while holding the lock of this
+                // one
+                std::unique_lock<mutex_type> lock(other.mtx_, std::try_to_lock);
+                if (!lock.owns_lock())
+                {
+                    contentions_.fetch_add(1, std::memory_order_relaxed);
+                    continue;
+                }
+
+                if (free_space_locked(other))
+                    return true;
+            }
+
+            return false;
+        }
+
+        bool free_space_locked(shard& s)
+        {
+            if (s.key_tracker_.empty())
+                return connections_ < max_connections_;
+
             // Find the least recently used key.
-            typename key_tracker_type::iterator kt = key_tracker_.begin();
+            typename key_tracker_type::iterator kt = s.key_tracker_.begin();
 
             while (connections_ >= max_connections_)
             {
                 // Find the least recently used keys data.
-                typename cache_type::iterator ct = cache_.find(*kt);
-                HPX_ASSERT(ct != cache_.end());
+                typename cache_type::iterator ct = s.cache_.find(*kt);
+                HPX_ASSERT(ct != s.cache_.end());
 
                 // If the entry is empty, ignore it and try the next least
                 // recently used entry.
@@ -590,9 +665,9 @@ namespace hpx { namespace util {
                     // Remove the key if its connection count is zero.
                     if (0 == num_existing_connections(ct->second))
                     {
-                        cache_.erase(ct);
-                        key_tracker_.erase(kt);
-                        kt = key_tracker_.begin();
+                        s.cache_.erase(ct);
+                        s.key_tracker_.erase(kt);
+                        kt = s.key_tracker_.begin();
                     }
                     else
                     {
@@ -604,7 +679,7 @@ namespace hpx { namespace util {
                     // If we've gone through key_tracker_ and haven't found
                     // anything evict-able, then all the entries must be
                     // currently checked out.
-                    if (key_tracker_.end() == kt)
+                    if (s.key_tracker_.end() == kt)
                         return false;
 
                     continue;
@@ -623,20 +698,20 @@ namespace hpx { namespace util {
             return true;
         }
 
-        mutable mutex_type mtx_;
         size_type const max_connections_;
         size_type const max_connections_per_locality_;
-        key_tracker_type key_tracker_;
-        cache_type cache_;
-        size_type connections_;
-        bool shutting_down_;
+        size_type const num_shards_;
+        std::unique_ptr<shard_type[]> shards_;
+        std::atomic<size_type> connections_;
+        std::atomic<bool> shutting_down_;
 
         // statistics support
-        std::int64_t insertions_;
-        std::int64_t evictions_;
-        std::int64_t hits_;
-        std::int64_t misses_;
-        std::int64_t reclaims_;
+        std::atomic<std::int64_t> insertions_;
+        std::atomic<std::int64_t> evictions_;
+        std::atomic<std::int64_t> hits_;
+        std::atomic<std::int64_t> misses_;
+        std::atomic<std::int64_t> reclaims_;
+        mutable std::atomic<std::int64_t> contentions_;
     };
 }}    // namespace hpx::util
 
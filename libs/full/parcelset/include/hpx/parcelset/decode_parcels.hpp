@@ -22,17 +22,21 @@
 #include <hpx/naming_base/id_type.hpp>
 #include <hpx/parcelset_base/detail/data_point.hpp>
 #include <hpx/parcelset_base/detail/parcel_route_handler.hpp>
+#include <hpx/parcelset/detail/segmented_message.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 
 #if ASIO_HAS_BOOST_THROW_EXCEPTION != 0
 #include <boost/exception/exception.hpp>
 #endif
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
 #include <functional>
+#include <iterator>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -119,6 +123,189 @@ namespace hpx::parcelset {
         return chunks;
     }
 
+    namespace detail {
+
+        ///////////////////////////////////////////////////////////////////////
+        // De-serialize the given number of parcels from the given archive.
+        // Parcels referring to direct actions are added to deferred_parcels
+        // if defer_direct_actions is true, all other parcels are scheduled
+        // right away. Returns the time spent scheduling the parcels.
+        template <typename Parcelport>
+        std::int64_t decode_parcel_range(Parcelport& pp,
+            serialization::input_archive& archive, std::size_t parcel_count,
+            bool defer_direct_actions, std::size_t num_thread,
+            std::vector<parcelset::parcel>& deferred_parcels)
+        {
+            std::int64_t overall_add_parcel_time = 0;
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+            hpx::chrono::high_resolution_timer timer;
+#endif
+            for (std::size_t i = 0; i != parcel_count; ++i)
+            {
+                bool deferred_schedule = defer_direct_actions;
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                std::size_t archive_pos = archive.current_pos();
+                std::int64_t serialize_time = timer.elapsed_nanoseconds();
+#endif
+                // de-serialize parcel and add it to incoming parcel queue
+                parcelset::parcel p;
+
+                // deferred_schedule will be set to false if the action
+                // to be loaded is a non direct action. If we only got
+                // one parcel to decode, deferred_schedule will be
+                // preset to false and the direct action will be called
+                // directly
+                bool migrated =
+                    p.load_schedule(archive, num_thread, deferred_schedule);
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                std::int64_t add_parcel_time = timer.elapsed_nanoseconds();
+#endif
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                parcelset::data_point action_data;
+                action_data.bytes_ = archive.current_pos() - archive_pos;
+                action_data.serialization_time_ =
+                    add_parcel_time - serialize_time;
+                action_data.num_parcels_ = 1;
+                pp.add_received_data(p.get_action_name(), action_data);
+#else
+                HPX_UNUSED(pp);
+#endif
+                // make sure this parcel ended up on the right locality
+                std::uint32_t here = agas::get_locality_id();
+                if (hpx::get_runtime_ptr() &&
+                    here != naming::invalid_locality_id &&
+                    (naming::get_locality_id_from_gid(
+                         p.destination_locality()) != here))
+                {
+                    HPX_THROW_EXCEPTION(invalid_status,
+                        "hpx::parcelset::decode_message",
+                        "parcel destination does not match locality "
+                        "which received the parcel ({}), {}",
+                        here, p);
+                    return overall_add_parcel_time;
+                }
+
+                if (migrated)
+                {
+                    agas::route(HPX_MOVE(p),
+                        &parcelset::detail::parcel_route_handler,
+                        threads::thread_priority::normal);
+                }
+                else if (deferred_schedule)
+                {
+                    // If we got a direct action
+                    deferred_parcels.push_back(HPX_MOVE(p));
+                }
+
+                // be sure not to measure add_parcel as serialization time
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                overall_add_parcel_time +=
+                    timer.elapsed_nanoseconds() - add_parcel_time;
+#endif
+            }
+            return overall_add_parcel_time;
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // De-serialize the segments of a segmented message (see
+        // encode_segments), concurrently. The archive refers to the segment
+        // table at the beginning of the message. Returns the time spent
+        // scheduling the parcels.
+        template <typename Parcelport, typename Buffer>
+        std::int64_t decode_segments(Parcelport& pp, Buffer const& buffer,
+            serialization::input_archive& archive,
+            std::vector<serialization::serialization_chunk> const& chunks,
+            std::size_t num_thread,
+            std::vector<parcelset::parcel>& deferred_parcels,
+            std::size_t& bytes_read)
+        {
+            struct segment
+            {
+                std::size_t num_parcels = 0;
+                std::size_t offset = 0;
+                std::size_t size = 0;
+                std::size_t first_chunk = 0;
+                std::size_t num_chunks = 0;
+                std::int64_t add_parcel_time = 0;
+                std::vector<parcelset::parcel> deferred_parcels;
+            };
+
+            std::size_t num_segments = 0;
+            archive >> num_segments;    //-V128
+
+            std::vector<segment> segments(num_segments);
+            for (segment& seg : segments)
+            {
+                archive >> seg.num_parcels >> seg.size >> seg.num_chunks;
+            }
+
+            // the segment data follows the segment table, the table itself
+            // occupies exactly one (index based) chunk
+            std::size_t offset = archive.bytes_read();
+            std::size_t chunk = 1;
+            for (segment& seg : segments)
+            {
+                seg.offset = offset;
+                seg.first_chunk = chunk;
+                offset += seg.size;
+                chunk += seg.num_chunks;
+            }
+
+            if (offset > buffer.data_.size() ||
+                (!chunks.empty() && chunk != chunks.size()))
+            {
+                HPX_THROW_EXCEPTION(serialization_error,
+                    "hpx::parcelset::decode_message",
+                    "archive data bstream structure mismatch");
+                return 0;
+            }
+            bytes_read = offset;
+
+            using data_type = std::decay_t<decltype(buffer.data_)>;
+
+            for_each_segment(num_segments, [&](std::size_t s) {
+                segment& seg = segments[s];
+
+                message_segment_view<data_type> data{
+                    buffer.data_, seg.offset, seg.size};
+
+                // chunks are present only if the message carries zero-copy
+                // chunks
+                std::vector<serialization::serialization_chunk> seg_chunks;
+                if (!chunks.empty())
+                {
+                    seg_chunks.assign(chunks.begin() + seg.first_chunk,
+                        chunks.begin() + seg.first_chunk + seg.num_chunks);
+                }
+
+                serialization::input_archive seg_archive(
+                    data, seg.size, &seg_chunks);
+
+                seg.deferred_parcels.reserve(seg.num_parcels);
+                seg.add_parcel_time = decode_parcel_range(pp, seg_archive,
+                    seg.num_parcels, true, num_thread, seg.deferred_parcels);
+            });
+
+            std::int64_t add_parcel_time = 0;
+            for (segment& seg : segments)
+            {
+                std::move(seg.deferred_parcels.begin(),
+                    seg.deferred_parcels.end(),
+                    std::back_inserter(deferred_parcels));
+
+                // the segments were handled concurrently
+                add_parcel_time =
+                    (std::max)(add_parcel_time, seg.add_parcel_time);
+            }
+            return add_parcel_time;
+        }
+    }    // namespace detail
+
     ///////////////////////////////////////////////////////////////////////////
     template <typename Parcelport, typename Buffer>
     void decode_message_with_chunks(Parcelport& pp, Buffer buffer,
@@ -150,85 +337,40 @@ namespace hpx::parcelset {
                     {
                         archive >> parcel_count;    //-V128
                     }
-                    if (parcel_count > 1)
+
+                    std::size_t bytes_read = 0;
+                    std::int64_t add_parcel_time = 0;
+                    if (parcel_count & detail::segmented_message_flag)
                     {
+                        // large messages are decoded in segments
+                        parcel_count &= ~detail::segmented_message_flag;
                         deferred_parcels.reserve(parcel_count);
-                    }
 
-                    for (std::size_t i = 0; i != parcel_count; ++i)
+                        add_parcel_time = detail::decode_segments(pp, buffer,
+                            archive, chunks, num_thread, deferred_parcels,
+                            bytes_read);
+                    }
+                    else
                     {
-                        bool deferred_schedule = parcel_count > 1;
-
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
-    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        std::size_t archive_pos = archive.current_pos();
-                        std::int64_t serialize_time =
-                            timer.elapsed_nanoseconds();
-#endif
-                        // de-serialize parcel and add it to incoming parcel queue
-                        parcelset::parcel p;
-
-                        // deferred_schedule will be set to false if the action
-                        // to be loaded is a non direct action. If we only got
-                        // one parcel to decode, deferred_schedule will be
-                        // preset to false and the direct action will be called
-                        // directly
-                        bool migrated = p.load_schedule(
-                            archive, num_thread, deferred_schedule);
-
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-                        std::int64_t add_parcel_time =
-                            timer.elapsed_nanoseconds();
-#endif
-
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
-    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        parcelset::data_point action_data;
-                        action_data.bytes_ =
-                            archive.current_pos() - archive_pos;
-                        action_data.serialization_time_ =
-                            add_parcel_time - serialize_time;
-                        action_data.num_parcels_ = 1;
-                        pp.add_received_data(p.get_action_name(), action_data);
-#endif
-                        // make sure this parcel ended up on the right locality
-                        std::uint32_t here = agas::get_locality_id();
-                        if (hpx::get_runtime_ptr() &&
-                            here != naming::invalid_locality_id &&
-                            (naming::get_locality_id_from_gid(
-                                 p.destination_locality()) != here))
+                        if (parcel_count > 1)
                         {
-                            HPX_THROW_EXCEPTION(invalid_status,
-                                "hpx::parcelset::decode_message",
-                                "parcel destination does not match locality "
-                                "which received the parcel ({}), {}",
-                                here, p);
-                            return;
+                            deferred_parcels.reserve(parcel_count);
                         }
 
-                        if (migrated)
-                        {
-                            agas::route(HPX_MOVE(p),
-                                &parcelset::detail::parcel_route_handler,
-                                threads::thread_priority::normal);
-                        }
-                        else if (deferred_schedule)
-                        {
-                            // If we got a direct action
-                            deferred_parcels.push_back(HPX_MOVE(p));
-                        }
-
-                        // be sure not to measure add_parcel as serialization time
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS)
-                        overall_add_parcel_time +=
-                            timer.elapsed_nanoseconds() - add_parcel_time;
-#endif
+                        add_parcel_time = detail::decode_parcel_range(pp,
+                            archive, parcel_count, parcel_count > 1,
+                            num_thread, deferred_parcels);
+                        bytes_read = archive.bytes_read();
                     }
 
                     // complete received data with parcel count
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
+                    overall_add_parcel_time += add_parcel_time;
                     data.num_parcels_ = parcel_count;
-                    data.raw_bytes_ = archive.bytes_read();
+                    data.raw_bytes_ = bytes_read;
+#else
+                    HPX_UNUSED(add_parcel_time);
+                    HPX_UNUSED(bytes_read);
 #endif
                     if (!deferred_parcels.empty())
                     {
@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+
+#if defined(HPX_HAVE_NETWORKING)
+#include <hpx/modules/async_combinators.hpp>
+#include <hpx/modules/async_local.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/runtime_local.hpp>
+#include <hpx/modules/threading_base.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// Messages carrying a large number of parcels are (de-)serialized in
+// segments. Each segment is a self-contained archive holding a contiguous
+// range of the parcels. The segments are encoded concurrently into separate
+// buffers which are then appended to the message after a table describing
+// the segments (number of parcels, number of bytes, and number of chunks of
+// each segment). This allows for the receiving end to decode the segments
+// concurrently as well.
+namespace hpx::parcelset::detail {
+
+    // The parcel count of segmented messages has its highest bit set
+    inline constexpr std::size_t segmented_message_flag =
+        ~(~std::size_t(0) >> 1);
+
+    // Return the number of segments to use for encoding the given number of
+    // parcels with the given (estimated) overall size
+    inline std::size_t get_num_segments(std::size_t num_parcels,
+        std::size_t size, std::size_t threshold) noexcept
+    {
+        // segmenting the message requires for the encoding to run on an HPX
+        // thread, otherwise we can't wait for the segments to be encoded
+        if (threshold == 0 || size < threshold || num_parcels < 2 ||
+            threads::get_self_ptr() == nullptr)
+        {
+            return 1;
+        }
+
+        return (std::max)(std::size_t(1),
+            (std::min)(num_parcels, hpx::get_num_worker_threads()));
+    }
+
+    // Invoke the given function for each segment. All but the first segment
+    // are handled on separate HPX threads if the calling thread is an HPX
+    // thread. The function returns only after all segments have been
+    // handled, the first exception thrown by any of the invocations is
+    // re-thrown.
+    template <typename F>
+    void for_each_segment(std::size_t num_segments, F&& f)
+    {
+        if (num_segments == 1 || threads::get_self_ptr() == nullptr)
+        {
+            for (std::size_t i = 0; i != num_segments; ++i)
+            {
+                f(i);
+            }
+            return;
+        }
+
+        std::vector<hpx::future<void>> segments;
+        segments.reserve(num_segments - 1);
+        for (std::size_t i = 1; i != num_segments; ++i)
+        {
+            segments.push_back(hpx::async([&f, i]() { f(i); }));
+        }
+
+        // handle the first segment directly, make sure not to leave this
+        // function before all other segments have been handled, as those
+        // refer to the caller's data
+        std::exception_ptr ex;
+        try
+        {
+            f(0);
+        }
+        catch (...)
+        {
+            ex = std::current_exception();
+        }
+
+        hpx::wait_all(segments);
+
+        if (ex)
+        {
+            std::rethrow_exception(ex);
+        }
+
+        for (auto& segment : segments)
+        {
+            segment.get();    // rethrow exceptions, if any
+        }
+    }
+
+    // A read-only view of a part of a message buffer, this is used as the
+    // container for de-serializing the segments of a message
+    template <typename Container>
+    struct message_segment_view
+    {
+        std::size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        decltype(auto) operator[](std::size_t i) const
+        {
+            return data_[offset_ + i];
+        }
+
+        Container const& data_;
+        std::size_t offset_;
+        std::size_t size_;
+    };
+}    // namespace hpx::parcelset::detail
+
+#endif
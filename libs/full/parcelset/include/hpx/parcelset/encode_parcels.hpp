@@ -23,6 +23,7 @@
 #include <hpx/actions_base/basic_action.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/naming/split_gid.hpp>
+#include <hpx/parcelset/detail/segmented_message.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelset_fwd.hpp>
 #include <hpx/parcelset_base/parcelport.hpp>
@@ -37,6 +38,7 @@
 #include <memory>
 #include <string>
 #include <system_error>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -81,6 +83,172 @@ namespace hpx::parcelset {
         }
 #endif
 
+        ///////////////////////////////////////////////////////////////////////
+        // Serialize the given parcels into the given archive
+        inline void encode_parcel_range(parcelport& pp,
+            serialization::output_archive& archive, parcelset::parcel const* ps,
+            std::size_t num_parcels)
+        {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+            hpx::chrono::high_resolution_timer timer;
+#endif
+            for (std::size_t i = 0; i != num_parcels; ++i)
+            {
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                std::size_t archive_pos = archive.current_pos();
+                std::int64_t serialize_time = timer.elapsed_nanoseconds();
+#endif
+                LPT_(debug) << ps[i];
+
+                auto split_gids_map = ps[i].move_split_gids();
+                if (!split_gids_map.empty())
+                {
+                    auto& split_gids = archive.get_extra_data<
+                        serialization::detail::preprocess_gid_types>();
+                    split_gids.set_split_gids(HPX_MOVE(split_gids_map));
+                }
+
+                archive << ps[i];
+
+#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
+    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
+                parcelset::data_point action_data;
+                action_data.bytes_ = archive.current_pos() - archive_pos;
+                action_data.serialization_time_ =
+                    timer.elapsed_nanoseconds() - serialize_time;
+                action_data.num_parcels_ = 1;
+                pp.add_sent_data(ps[i].get_action_name(), action_data);
+#else
+                HPX_UNUSED(pp);
+#endif
+            }
+        }
+
+        ///////////////////////////////////////////////////////////////////////
+        // Serialize the given parcels in segments, concurrently. Each segment
+        // is encoded into a separate buffer, the buffers are appended to the
+        // segment table afterwards.
+        template <typename Buffer>
+        std::size_t encode_segments(parcelport& pp, parcelset::parcel const* ps,
+            std::size_t num_parcels, std::size_t num_segments, Buffer& buffer,
+            int archive_flags)
+        {
+            struct segment
+            {
+                std::size_t first = 0;
+                std::size_t num_parcels = 0;
+                std::size_t size = 0;
+                std::size_t num_chunks = 0;
+                std::vector<char> data;
+                std::vector<serialization::serialization_chunk> chunks;
+            };
+
+            // distribute the parcels such that all segments are of roughly
+            // the same size
+            std::size_t overall_size = 0;
+            for (std::size_t i = 0; i != num_parcels; ++i)
+            {
+                overall_size += ps[i].size();
+            }
+
+            std::vector<segment> segments(num_segments);
+            {
+                std::size_t const segment_size = overall_size / num_segments;
+
+                std::size_t current = 0;
+                for (std::size_t s = 0; s != num_segments; ++s)
+                {
+                    segment& seg = segments[s];
+                    seg.first = current;
+
+                    // leave at least one parcel for each of the remaining
+                    // segments
+                    std::size_t const last =
+                        num_parcels - (num_segments - s - 1);
+                    do
+                    {
+                        seg.size += ps[current].size();
+                        seg.num_chunks += ps[current].num_chunks();
+                        ++current;
+                    } while (current != last &&
+                        (s == num_segments - 1 || seg.size < segment_size));
+
+                    seg.num_parcels = current - seg.first;
+                }
+                HPX_ASSERT(current == num_parcels);
+            }
+
+            std::size_t const zero_copy_serialization_threshold =
+                pp.get_zero_copy_serialization_threshold();
+
+            for_each_segment(num_segments, [&](std::size_t s) {
+                segment& seg = segments[s];
+
+                seg.data.reserve(seg.size);
+                seg.chunks.reserve(seg.num_chunks);
+
+                serialization::output_archive archive(seg.data, archive_flags,
+                    &seg.chunks, nullptr, zero_copy_serialization_threshold);
+
+                encode_parcel_range(pp, archive, ps + seg.first,
+                    seg.num_parcels);
+
+                archive.flush();
+                seg.size = archive.bytes_written();
+            });
+
+            // write segment table
+            std::size_t arg_size = 0;
+            {
+                serialization::output_archive archive(buffer.data_,
+                    archive_flags, &buffer.chunks_, nullptr,
+                    zero_copy_serialization_threshold);
+
+                std::size_t count = num_parcels | segmented_message_flag;
+                archive << count << num_segments;    //-V128
+
+                for (segment const& seg : segments)
+                {
+                    archive << seg.num_parcels << seg.data.size()
+                            << seg.chunks.size();
+                }
+
+                archive.flush();
+                arg_size = archive.bytes_written();
+            }
+
+            // append the segments, adjusting the positions of the index
+            // based chunks
+            using access_traits = hpx::traits::serialization_access_data<
+                std::decay_t<decltype(buffer.data_)>>;
+
+            for (segment& seg : segments)
+            {
+                std::size_t const offset = buffer.data_.size();
+                if (!seg.data.empty())
+                {
+                    access_traits::resize(buffer.data_, seg.data.size());
+                    access_traits::write(buffer.data_, seg.data.size(),
+                        offset, seg.data.data());
+                }
+
+                for (serialization::serialization_chunk& c : seg.chunks)
+                {
+                    if (c.type_ == serialization::chunk_type::chunk_type_index)
+                    {
+                        c.data_.index_ += offset;
+                    }
+                    buffer.chunks_.push_back(c);
+                }
+
+                arg_size += seg.size;
+            }
+
+            return arg_size;
+        }
+
         template <typename Buffer>
         void encode_finalize(Buffer& buffer, std::size_t arg_size)
         {
@@ -197,6 +365,20 @@ namespace hpx::parcelset {
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS)
                 hpx::chrono::high_resolution_timer timer;
 #endif
+                // Large messages are serialized in segments, concurrently.
+                // This is not supported for compressed messages.
+                std::size_t const num_segments =
+                    (num_parcels != std::size_t(-1) && filter == nullptr) ?
+                    detail::get_num_segments(parcels_sent, arg_size,
+                        pp.get_parallel_serialization_threshold()) :
+                    1;
+
+                if (num_segments > 1)
+                {
+                    arg_size = detail::encode_segments(pp, ps, parcels_sent,
+                        num_segments, buffer, archive_flags);
+                }
+                else
                 {
                     // Serialize the data
                     if (filter.get() != nullptr)
@@ -211,39 +393,9 @@ namespace hpx::parcelset {
                     if (num_parcels != std::size_t(-1))
                         archive << parcels_sent;    //-V128
 
-                    for (std::size_t i = 0; i != parcels_sent; ++i)
-                    {
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
-    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        std::size_t archive_pos = archive.current_pos();
-                        std::int64_t serialize_time =
-                            timer.elapsed_nanoseconds();
-#endif
-                        LPT_(debug) << ps[i];
-
-                        auto split_gids_map = ps[i].move_split_gids();
-                        if (!split_gids_map.empty())
-                        {
-                            auto& split_gids = archive.get_extra_data<
-                                serialization::detail::preprocess_gid_types>();
-                            split_gids.set_split_gids(HPX_MOVE(split_gids_map));
-                        }
+                    detail::encode_parcel_range(
+                        pp, archive, ps, parcels_sent);
 
-                        archive << ps[i];
-
-#if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
-    defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
-                        parcelset::data_point action_data;
-                        action_data.bytes_ =
-                            archive.current_pos() - archive_pos;
-                        action_data.serialization_time_ =
-                            timer.elapsed_nanoseconds() - serialize_time;
-                        action_data.num_parcels_ = 1;
-                        pp.add_sent_data(ps[i].get_action_name(), action_data);
-#else
-                        HPX_UNUSED(pp);
-#endif
-                    }
                     archive.flush();
                     arg_size = archive.bytes_written();
                 }
@@ -150,6 +150,7 @@ namespace hpx::parcelset::detail {
         void save(serialization::output_archive& ar, unsigned) const override;
 
         std::pair<naming::address_type, naming::component_type> determine_lva();
+        void record_remote_access() const;
 
         detail::parcel_data data_;
         std::unique_ptr<actions::base_action> action_;
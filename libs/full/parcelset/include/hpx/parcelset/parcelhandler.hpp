@@ -401,6 +401,12 @@ namespace hpx::parcelset {
         void put_parcels_impl(
             std::vector<parcel>&& p, std::vector<write_handler_type>&& f);
 
+        // append the buffered reference count requests which are due to be
+        // sent to the given locality
+        void piggyback_refcnt_requests(std::uint32_t locality_id,
+            std::vector<parcel>& parcels,
+            std::vector<write_handler_type>& handlers);
+
         // manage default exception handler
         void invoke_write_handler(
             std::error_code const& ec, parcel const& p) const;
@@ -107,6 +107,17 @@ namespace hpx::parcelset {
                 HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY);
         }
 
+        static std::size_t connection_cache_shards(
+            util::runtime_configuration const& ini)
+        {
+            std::string key("hpx.parcel.");
+            key += connection_handler_type();
+
+            return hpx::util::get_entry_as<std::size_t>(ini,
+                key + ".connection_cache_shards",
+                HPX_PARCEL_CONNECTION_CACHE_SHARDS);
+        }
+
         static std::size_t zero_copy_serialization_threshold(
             util::runtime_configuration const& ini)
         {
@@ -138,8 +149,8 @@ namespace hpx::parcelset {
                 zero_copy_serialization_threshold(ini))
           , io_service_pool_(thread_pool_size(ini), notifier, pool_name(),
                 pool_name_postfix())
-          , connection_cache_(
-                max_connections(ini), max_connections_per_loc(ini))
+          , connection_cache_(max_connections(ini),
+                max_connections_per_loc(ini), connection_cache_shards(ini))
           , archive_flags_(0)
           , operations_in_flight_(0)
           , num_thread_(0)
@@ -417,6 +428,9 @@ namespace hpx::parcelset {
             case connection_cache_reclaims:
                 return connection_cache_.get_cache_reclaims(reset);
 
+            case connection_cache_contentions:
+                return connection_cache_.get_cache_contentions(reset);
+
             default:
                 break;
             }
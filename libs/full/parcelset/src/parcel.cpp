@@ -21,11 +21,13 @@
 #include <hpx/actions_base/detail/action_factory.hpp>
 #include <hpx/components_base/agas_interface.hpp>
 #include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/detail/object_access_hooks.hpp>
 #include <hpx/naming/detail/preprocess_gid_types.hpp>
 #include <hpx/parcelset/parcel.hpp>
 #include <hpx/parcelset/parcelhandler.hpp>
 #include <hpx/parcelset_base/parcel_interface.hpp>
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -455,6 +457,8 @@ namespace hpx::parcelset::detail {
             return true;
         }
 
+        record_remote_access();
+
         // continuation support, this is handled in the transfer action
         action_->load_schedule(ar, HPX_MOVE(data_.dest_), p.first, p.second,
             num_thread, deferred_schedule);
@@ -475,6 +479,19 @@ namespace hpx::parcelset::detail {
         return false;
     }
 
+    // Notify the automatic migration service (if active) about the access
+    // to a migratable object originating from a remote locality.
+    void parcel::record_remote_access() const
+    {
+        auto* f = components::detail::record_remote_object_access.load(
+            std::memory_order_acquire);
+        if (f != nullptr && naming::detail::is_migratable(data_.dest_) &&
+            data_.source_id_)
+        {
+            f(data_.dest_, naming::get_locality_id_from_gid(data_.source_id_));
+        }
+    }
+
     bool parcel::schedule_action(std::size_t num_thread)
     {
         // make sure this parcel destination matches the proper locality
@@ -491,6 +508,8 @@ namespace hpx::parcelset::detail {
             return true;
         }
 
+        record_remote_access();
+
         // dispatch action, register work item either with or without
         // continuation support, this is handled in the transfer action
         action_->schedule_thread(
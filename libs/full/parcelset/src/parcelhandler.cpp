@@ -617,8 +617,26 @@ namespace hpx::parcelset {
                 }
             }
 
-            dest.first->put_parcel(
-                dest.second, HPX_MOVE(p), HPX_MOVE(wrapped_f));
+            // send buffered reference count requests which are due along
+            // with this parcel
+            std::vector<parcel> parcels;
+            std::vector<write_handler_type> handlers;
+            piggyback_refcnt_requests(
+                naming::get_locality_id_from_gid(addr.locality_), parcels,
+                handlers);
+
+            if (parcels.empty())
+            {
+                dest.first->put_parcel(
+                    dest.second, HPX_MOVE(p), HPX_MOVE(wrapped_f));
+                return;
+            }
+
+            parcels.push_back(HPX_MOVE(p));
+            handlers.push_back(HPX_MOVE(wrapped_f));
+
+            dest.first->put_parcels(
+                dest.second, HPX_MOVE(parcels), HPX_MOVE(handlers));
             return;
         }
 
@@ -779,6 +797,13 @@ namespace hpx::parcelset {
         if (!resolved_parcels.empty())
         {
             HPX_ASSERT(!!resolved_dest.first && !!resolved_dest.second);
+
+            // send buffered reference count requests which are due along
+            // with these parcels
+            piggyback_refcnt_requests(
+                resolved_parcels[0].destination_locality_id(),
+                resolved_parcels, resolved_handlers);
+
             resolved_dest.first->put_parcels(resolved_dest.second,
                 HPX_MOVE(resolved_parcels), HPX_MOVE(resolved_handlers));
         }
@@ -793,6 +818,25 @@ namespace hpx::parcelset {
         }
     }
 
+    void parcelhandler::piggyback_refcnt_requests(std::uint32_t locality_id,
+        std::vector<parcel>& parcels, std::vector<write_handler_type>& handlers)
+    {
+        std::size_t const first = parcels.size();
+        agas::piggyback_refcnt_requests(locality_id, parcels);
+
+        for (std::size_t i = first; i != parcels.size(); ++i)
+        {
+            init_parcel(parcels[i]);
+
+            write_handler_type f = [this](std::error_code const& ec,
+                                       parcel const& p) -> void {
+                invoke_write_handler(ec, p);
+            };
+            handlers.push_back(
+                hpx::bind_front(&detail::parcel_sent_handler, HPX_MOVE(f)));
+        }
+    }
+
     void parcelhandler::invoke_write_handler(
         std::error_code const& ec, parcel const& p) const
     {
@@ -1299,6 +1343,10 @@ namespace hpx::parcelset {
             "max_connections_per_locality = "
             "${HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY:" HPX_PP_STRINGIZE(
                 HPX_PARCEL_MAX_CONNECTIONS_PER_LOCALITY) "}");
+        ini_defs.emplace_back(
+            "connection_cache_shards = "
+            "${HPX_PARCEL_CONNECTION_CACHE_SHARDS:" HPX_PP_STRINGIZE(
+                HPX_PARCEL_CONNECTION_CACHE_SHARDS) "}");
         ini_defs.emplace_back("max_message_size = "
                               "${HPX_PARCEL_MAX_MESSAGE_SIZE:" HPX_PP_STRINGIZE(
                                   HPX_PARCEL_MAX_MESSAGE_SIZE) "}");
@@ -1306,6 +1354,10 @@ namespace hpx::parcelset {
             "max_outbound_message_size = "
             "${HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE:" HPX_PP_STRINGIZE(
                 HPX_PARCEL_MAX_OUTBOUND_MESSAGE_SIZE) "}");
+        ini_defs.emplace_back(
+            "direct_execution_threshold = "
+            "${HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD:" HPX_PP_STRINGIZE(
+                HPX_PARCEL_DIRECT_EXECUTION_THRESHOLD) "}");
         ini_defs.emplace_back(endian::native == endian::big ?
                 "endian_out = ${HPX_PARCEL_ENDIAN_OUT:big}" :
                 "endian_out = ${HPX_PARCEL_ENDIAN_OUT:little}");
@@ -1327,6 +1379,10 @@ namespace hpx::parcelset {
             "zero_copy_serialization_threshold = "
             "${HPX_PARCEL_ZERO_COPY_SERIALIZATION_THRESHOLD:" HPX_PP_STRINGIZE(
                 HPX_ZERO_COPY_SERIALIZATION_THRESHOLD) "}");
+        ini_defs.emplace_back(
+            "parallel_serialization_threshold = "
+            "${HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD:" HPX_PP_STRINGIZE(
+                HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD) "}");
         ini_defs.emplace_back("max_background_threads = "
                               "${HPX_PARCEL_MAX_BACKGROUND_THREADS:-1}");
 
@@ -0,0 +1,198 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+
+#include <hpx/include/async.hpp>
+#include <hpx/modules/testing.hpp>
+#include <hpx/parcelset/connection_cache.hpp>
+#include <hpx/thread.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_connection
+{
+#if defined(HPX_TRACK_STATE_OF_OUTGOING_TCP_CONNECTION)
+    enum state
+    {
+        state_reinitialized,
+        state_reclaimed,
+        state_deleting
+    };
+
+    void set_state(state) {}
+#endif
+
+    // set while the connection is checked out of the cache
+    std::atomic<bool> in_use{false};
+};
+
+using cache_type = hpx::util::connection_cache<test_connection, std::size_t>;
+using connection_type = cache_type::connection_type;
+
+///////////////////////////////////////////////////////////////////////////////
+void test_get_reclaim()
+{
+    cache_type cache(16, 4, 4);
+
+    // nothing is cached yet
+    HPX_TEST(!cache.get(1));
+    HPX_TEST_EQ(cache.get_cache_misses(true), std::int64_t(1));
+
+    connection_type conn;
+    HPX_TEST(cache.get_or_reserve(1, conn));
+    HPX_TEST(!conn);
+    HPX_TEST_EQ(cache.get_cache_insertions(false), std::int64_t(1));
+
+    conn = std::make_shared<test_connection>();
+    cache.reclaim(1, conn);
+    HPX_TEST_EQ(cache.get_cache_reclaims(false), std::int64_t(1));
+
+    // the reclaimed connection is handed out again
+    connection_type found;
+    HPX_TEST(cache.get_or_reserve(1, found));
+    HPX_TEST(found == conn);
+    cache.reclaim(1, found);
+
+    HPX_TEST(cache.get(1) == conn);
+    HPX_TEST(!cache.get(1));
+    cache.reclaim(1, conn);
+
+    // connections to other keys are independent
+    HPX_TEST(!cache.get(2));
+    HPX_TEST_EQ(cache.get_cache_hits(true), std::int64_t(2));
+
+    cache.clear();
+    HPX_TEST(!cache.get(1));
+    HPX_TEST_EQ(cache.get_cache_hits(false), std::int64_t(0));
+    HPX_TEST_EQ(cache.get_cache_misses(false), std::int64_t(1));
+}
+
+void test_limits()
+{
+    // the limits may not be inconsistent
+    bool caught_exception = false;
+    try
+    {
+        cache_type cache(4, 8, 4);
+    }
+    catch (hpx::exception const& e)
+    {
+        HPX_TEST_EQ(e.get_error(), hpx::bad_parameter);
+        caught_exception = true;
+    }
+    HPX_TEST(caught_exception);
+
+    cache_type cache(4, 2, 4);
+
+    // the per-locality limit
+    connection_type conn1, conn2, conn3;
+    HPX_TEST(cache.get_or_reserve(0, conn1));
+    HPX_TEST(cache.get_or_reserve(0, conn2));
+    HPX_TEST(cache.full(0));
+    HPX_TEST(!cache.get_or_reserve(0, conn3));
+    HPX_TEST(cache.get_or_reserve(0, conn3, true));
+
+    conn1 = std::make_shared<test_connection>();
+    conn2 = std::make_shared<test_connection>();
+    conn3 = std::make_shared<test_connection>();
+
+    // connections exceeding the limit are not cached
+    cache.reclaim(0, conn1);
+    cache.reclaim(0, conn2);
+    cache.reclaim(0, conn3);
+    HPX_TEST_EQ(cache.get_cache_evictions(true), std::int64_t(1));
+    HPX_TEST(!cache.full());
+
+    // the overall limit is enforced across all shards, the cached
+    // connections to other keys are evicted to make space
+    for (std::size_t key = 1; key != 5; ++key)
+    {
+        connection_type conn;
+        HPX_TEST(cache.get_or_reserve(key, conn));
+        HPX_TEST(!conn);
+        cache.reclaim(key, std::make_shared<test_connection>());
+    }
+    HPX_TEST(cache.full());
+    HPX_TEST_EQ(cache.get_cache_evictions(false), std::int64_t(2));
+
+    cache.clear(4);
+    HPX_TEST(!cache.full());
+    HPX_TEST(!cache.get(4));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Concurrently check connections out of the cache and return them, no
+// connection may be handed out twice at the same time.
+void test_concurrent_access()
+{
+    std::size_t const num_keys = 32;
+    std::size_t const num_tasks = 64;
+    std::size_t const iterations = 1000;
+
+    cache_type cache(num_keys * 4, 4);
+
+    std::atomic<std::size_t> created(0);
+    std::atomic<std::size_t> reused(0);
+
+    std::vector<hpx::future<void>> futures;
+    futures.reserve(num_tasks);
+    for (std::size_t k = 0; k != num_tasks; ++k)
+    {
+        futures.push_back(hpx::async([&, k]() {
+            for (std::size_t i = 0; i != iterations; ++i)
+            {
+                std::size_t const key = (k + i) % num_keys;
+
+                connection_type conn;
+                if (!cache.get_or_reserve(key, conn))
+                {
+                    continue;
+                }
+
+                if (!conn)
+                {
+                    conn = std::make_shared<test_connection>();
+                    ++created;
+                }
+                else
+                {
+                    ++reused;
+                }
+
+                HPX_TEST(!conn->in_use.exchange(true));
+                hpx::this_thread::yield();
+                conn->in_use = false;
+
+                cache.reclaim(key, conn);
+            }
+        }));
+    }
+    hpx::wait_all(futures);
+
+    HPX_TEST(created + reused != 0);
+    HPX_TEST_EQ(static_cast<std::size_t>(cache.get_cache_insertions(false)),
+        created.load());
+    HPX_TEST_EQ(
+        static_cast<std::size_t>(cache.get_cache_hits(false)), reused.load());
+}
+
+int main()
+{
+    test_get_reclaim();
+    test_limits();
+    test_concurrent_access();
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,134 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// This test sends large batches of parcels with a very low parallel
+// serialization threshold, which forces the messages to be encoded and
+// decoded in segments. The parcels carry arguments both below and above the
+// zero-copy serialization threshold, making sure the positions of the chunks
+// are adjusted properly while splicing the segments.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx.hpp>
+#include <hpx/hpx_init.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+std::size_t const numparcels_default = 100;
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename Action, typename... Ts>
+hpx::parcelset::parcel generate_parcel(
+    hpx::id_type const& dest_id, hpx::id_type const& cont, Ts&&... data)
+{
+    hpx::naming::address addr;
+    hpx::naming::gid_type dest = dest_id.get_gid();
+    hpx::parcelset::parcel p(hpx::parcelset::detail::create_parcel::call(
+        std::move(dest), std::move(addr),
+        hpx::actions::typed_continuation<double>(cont), Action(),
+        hpx::threads::thread_priority::normal, std::forward<Ts>(data)...));
+
+    p.set_source_id(hpx::find_here());
+    p.size() = 4096;
+    return p;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+double checksum(std::size_t index, std::vector<double> const& data)
+{
+    return std::accumulate(data.begin(), data.end(), double(index));
+}
+HPX_PLAIN_ACTION(checksum)
+
+std::vector<double> make_data(std::size_t index)
+{
+    // every third parcel carries an argument which is serialized as a
+    // separate (zero-copy) chunk
+    std::size_t const size = index % 3 == 0 ? 16384 : 16;
+
+    std::vector<double> data(size);
+    std::iota(data.begin(), data.end(), double(index));
+    return data;
+}
+
+void test_segmented_parcels(hpx::id_type const& id, std::size_t numparcels)
+{
+    std::vector<hpx::future<double>> results;
+    results.reserve(numparcels);
+
+    std::vector<double> expected;
+    expected.reserve(numparcels);
+
+    // create parcels
+    std::vector<hpx::parcelset::parcel> parcels;
+    parcels.reserve(numparcels);
+    for (std::size_t i = 0; i != numparcels; ++i)
+    {
+        std::vector<double> data = make_data(i);
+        expected.push_back(checksum(i, data));
+
+        hpx::distributed::promise<double> p;
+        results.push_back(p.get_future());
+        parcels.push_back(
+            generate_parcel<checksum_action>(id, p.get_id(), i, data));
+    }
+
+    // send parcels, all of them are sent as a single message
+    hpx::get_runtime_distributed().get_parcel_handler().put_parcels(
+        std::move(parcels));
+
+    // verify all parcels were received and de-serialized correctly
+    hpx::wait_all(results);
+
+    for (std::size_t i = 0; i != numparcels; ++i)
+    {
+        HPX_TEST_EQ(results[i].get(), expected[i]);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    for (hpx::id_type const& id : hpx::find_remote_localities())
+    {
+        // batches smaller and larger than the number of cores, single
+        // parcels are never segmented
+        test_segmented_parcels(id, 1);
+        test_segmented_parcels(id, 2);
+        test_segmented_parcels(id, numparcels_default);
+        test_segmented_parcels(id, 10 * numparcels_default);
+    }
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    // explicitly disable message handlers (parcel coalescing) and make sure
+    // all messages are segmented
+    std::vector<std::string> const cfg = {
+#if defined(HPX_HAVE_NETWORKING)
+        "hpx.parcel.message_handlers=0",
+        "hpx.parcel.parallel_serialization_threshold=1"
+#endif
+    };
+
+    // Initialize and run HPX
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv, init_args), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
@@ -15,9 +15,12 @@
 #include <hpx/modules/iterator_support.hpp>
 #include <hpx/modules/serialization.hpp>
 
+#include <cstddef>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <type_traits>
 #include <utility>
 
@@ -26,6 +29,24 @@
 ///////////////////////////////////////////////////////////////////////////////
 namespace hpx { namespace parcelset {
 
+    namespace detail {
+
+        // Locality implementations may provide a hash_value() function (found
+        // through ADL) to allow for localities to be used as keys in hashed
+        // containers.
+        template <typename Impl, typename Enable = void>
+        struct has_hash_value : std::false_type
+        {
+        };
+
+        template <typename Impl>
+        struct has_hash_value<Impl,
+            std::void_t<decltype(hash_value(std::declval<Impl const&>()))>>
+          : std::true_type
+        {
+        };
+    }    // namespace detail
+
     //////////////////////////////////////////////////////////////////////////
     class HPX_EXPORT locality
     {
@@ -39,6 +60,7 @@ namespace hpx { namespace parcelset {
 
             virtual bool equal(impl_base const& rhs) const = 0;
             virtual bool less_than(impl_base const& rhs) const = 0;
+            virtual std::size_t hash() const = 0;
             virtual bool valid() const = 0;
             virtual const char* type() const = 0;
             virtual std::ostream& print(std::ostream& os) const = 0;
@@ -91,6 +113,12 @@ namespace hpx { namespace parcelset {
             return impl_ ? impl_->type() : "";
         }
 
+        // Equal localities have equal hash values
+        std::size_t hash() const
+        {
+            return impl_ ? impl_->hash() : 0;
+        }
+
         template <typename Impl>
         Impl& get()
         {
@@ -156,6 +184,19 @@ namespace hpx { namespace parcelset {
                     (type() == rhs.type() && impl_ < rhs.get<Impl>());
             }
 
+            std::size_t hash() const override
+            {
+                if constexpr (detail::has_hash_value<Impl>::value)
+                {
+                    return hash_value(impl_);
+                }
+                else
+                {
+                    // all localities of this type end up in the same bucket
+                    return std::hash<std::string_view>()(Impl::type());
+                }
+            }
+
             bool valid() const override
             {
                 return !!impl_;
@@ -202,4 +243,17 @@ namespace hpx { namespace parcelset {
         std::ostream& os, endpoints_type const& endpoints);
 }}    // namespace hpx::parcelset
 
+namespace std {
+
+    // specialize std::hash for hpx::parcelset::locality
+    template <>
+    struct hash<::hpx::parcelset::locality>
+    {
+        std::size_t operator()(::hpx::parcelset::locality const& l) const
+        {
+            return l.hash();
+        }
+    };
+}    // namespace std
+
 #include <hpx/config/warnings_suffix.hpp>
@@ -84,6 +84,10 @@ namespace hpx::parcelset {
         // serialize an entity
         std::size_t get_zero_copy_serialization_threshold() const noexcept;
 
+        /// Return the (estimated) message size starting at which the parcels
+        /// of a message are serialized concurrently (zero if disabled)
+        std::size_t get_parallel_serialization_threshold() const noexcept;
+
         /// Start the parcelport I/O thread pool.
         ///
         /// \param blocking [in] If blocking is set to \a true the routine will
@@ -165,7 +169,8 @@ namespace hpx::parcelset {
             connection_cache_evictions = 1,
             connection_cache_hits = 2,
             connection_cache_misses = 3,
-            connection_cache_reclaims = 4
+            connection_cache_reclaims = 4,
+            connection_cache_contentions = 5
         };
 
         // invoke pending background work
@@ -363,6 +368,7 @@ namespace hpx::parcelset {
         std::string type_;
 
         std::size_t zero_copy_serialization_threshold_;
+        std::size_t parallel_serialization_threshold_;
     };
 }    // namespace hpx::parcelset
 
@@ -46,6 +46,8 @@ namespace hpx::parcelset {
             ini, "hpx.parcel." + type + ".priority", 0))
       , type_(type)
       , zero_copy_serialization_threshold_(zero_copy_serialization_threshold)
+      , parallel_serialization_threshold_(
+            HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD)
     {
         std::string key("hpx.parcel.");
         key += type;
@@ -70,6 +72,11 @@ namespace hpx::parcelset {
         {
             async_serialization_ = true;
         }
+
+        parallel_serialization_threshold_ =
+            hpx::util::get_entry_as<std::size_t>(ini,
+                key + ".parallel_serialization_threshold",
+                HPX_PARCEL_PARALLEL_SERIALIZATION_THRESHOLD);
     }
 
     int parcelport::priority() const noexcept
@@ -88,6 +95,12 @@ namespace hpx::parcelset {
         return zero_copy_serialization_threshold_;
     }
 
+    std::size_t parcelport::get_parallel_serialization_threshold()
+        const noexcept
+    {
+        return parallel_serialization_threshold_;
+    }
+
     locality const& parcelport::here() const noexcept
     {
         return here_;
@@ -44,6 +44,7 @@ namespace hpx { namespace agas {
         primary_ns_begin_migration = 0b1001001,
         primary_ns_end_migration = 0b1001010,
         primary_ns_statistics_counter = 0b1001011,
+        primary_ns_contentions = 0b1001100,
 
         component_ns_service = 0b0100000,
         component_ns_bulk_service = 0b0100001,
@@ -195,6 +196,10 @@ namespace hpx { namespace agas { namespace detail {
             primary_ns_begin_migration, primary_ns_statistics_counter},
         {"count/end_migration", "", counter_target_count,
             primary_ns_end_migration, primary_ns_statistics_counter},
+        // counter exposing the lock contentions of the primary namespace
+        // tables
+        {"count/primary_contentions", "", counter_target_count,
+            primary_ns_contentions, primary_ns_statistics_counter},
     // counters exposing API timings
 #if defined(HPX_HAVE_NETWORKING)
         {"time/route", "ns", counter_target_time, primary_ns_route,
@@ -146,6 +146,15 @@ namespace hpx { namespace performance_counters {
         counter_info const&, discover_counter_func const&,
         discover_counters_mode, error_code&);
 
+    // Creation function for counters of directly executed remote actions.
+    HPX_EXPORT naming::gid_type remote_action_direct_execution_counter_creator(
+        counter_info const&, error_code&);
+
+    // Discoverer function for counters of directly executed remote actions.
+    HPX_EXPORT bool remote_action_direct_execution_counter_discoverer(
+        counter_info const&, discover_counter_func const&,
+        discover_counters_mode, error_code&);
+
 #if defined(HPX_HAVE_PARCELPORT_COUNTERS) &&                                   \
     defined(HPX_HAVE_PARCELPORT_ACTION_COUNTERS)
     ///////////////////////////////////////////////////////////////////////////
@@ -15,6 +15,8 @@ namespace hpx::performance_counters {
 
     HPX_EXPORT void register_parcelhandler_counter_types(
         parcelset::parcelhandler& ph);
+
+    HPX_EXPORT void register_serialization_registry_counter_types();
 }    // namespace hpx::performance_counters
 
 #endif
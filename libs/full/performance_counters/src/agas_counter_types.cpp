@@ -36,6 +36,8 @@ namespace hpx { namespace performance_counters {
             &agas::addressing_service::get_cache_evictions, &client));
         hpx::function<std::int64_t(bool)> cache_insertions(hpx::bind_front(
             &agas::addressing_service::get_cache_insertions, &client));
+        hpx::function<std::int64_t(bool)> cache_contentions(hpx::bind_front(
+            &agas::addressing_service::get_cache_contentions, &client));
 
         hpx::function<std::int64_t(bool)> cache_get_entry_count(hpx::bind_front(
             &agas::addressing_service::get_cache_get_entry_count, &client));
@@ -116,6 +118,16 @@ namespace hpx { namespace performance_counters {
                         &performance_counters::locality_raw_counter_creator, _1,
                         cache_insertions, _2),
                     &performance_counters::locality_counter_discoverer, ""},
+                {"/agas/count/cache/contentions",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of times an access to the AGAS cache "
+                    "had to wait for a lock held by another thread",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        cache_contentions, _2),
+                    &performance_counters::locality_counter_discoverer, ""},
                 {"/agas/count/cache/get_entry",
                     performance_counters::counter_type::
                         monotonically_increasing,
@@ -14,6 +14,8 @@
 #include <hpx/performance_counters/counters.hpp>
 #include <hpx/performance_counters/manage_counter_type.hpp>
 #include <hpx/performance_counters/parcelhandler_counter_types.hpp>
+#include <hpx/serialization/config/defines.hpp>
+#include <hpx/serialization/detail/flat_type_registry.hpp>
 
 #include <cstdint>
 #include <string>
@@ -518,6 +520,9 @@ namespace hpx::performance_counters {
         hpx::function<std::int64_t(bool)> cache_reclaims(
             hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
                 &ph, pp_type, parcelport::connection_cache_reclaims));
+        hpx::function<std::int64_t(bool)> cache_contentions(
+            hpx::bind_front(&parcelhandler::get_connection_cache_statistics,
+                &ph, pp_type, parcelport::connection_cache_contentions));
 
         performance_counters::generic_counter_type_data const
             connection_cache_types[] = {
@@ -584,6 +589,19 @@ namespace hpx::performance_counters {
                     hpx::bind(
                         &performance_counters::locality_raw_counter_creator, _1,
                         HPX_MOVE(cache_reclaims), _2),
+                    &performance_counters::locality_counter_discoverer, ""},
+                {hpx::util::format(
+                     "/parcelport/count/{}/cache-contentions", pp_type),
+                    performance_counters::counter_type::raw,
+                    hpx::util::format(
+                        "returns the number of times a thread had to wait for "
+                        "accessing the connection cache for the {} connection "
+                        "type on the referenced locality",
+                        pp_type),
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        HPX_MOVE(cache_contentions), _2),
                     &performance_counters::locality_counter_discoverer, ""}};
 
         performance_counters::install_counter_types(connection_cache_types,
@@ -644,6 +662,44 @@ namespace hpx::performance_counters {
 
         performance_counters::install_counter_types(
             counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+
+        register_serialization_registry_counter_types();
+    }
+
+    ///////////////////////////////////////////////////////////////////////////
+    // register performance counters related to the polymorphic type
+    // registries used during (de-)serialization
+    void register_serialization_registry_counter_types()
+    {
+#if defined(HPX_SERIALIZATION_HAVE_REGISTRY_COUNTERS)
+        using placeholders::_1;
+        using placeholders::_2;
+
+        using serialization::detail::flat_type_registry_base;
+
+        performance_counters::generic_counter_type_data const counter_types[] =
+            {{"/serialize/count/registry/lookups",
+                 performance_counters::counter_type::monotonically_increasing,
+                 "returns the number of lookups performed in the polymorphic "
+                 "type registries while (de-)serializing polymorphic objects",
+                 HPX_PERFORMANCE_COUNTER_V1,
+                 hpx::bind(&performance_counters::locality_raw_counter_creator,
+                     _1, &flat_type_registry_base::get_lookup_count, _2),
+                 &performance_counters::locality_counter_discoverer, ""},
+                {"/serialize/count/registry/probes",
+                    performance_counters::counter_type::
+                        monotonically_increasing,
+                    "returns the number of hash table slots inspected while "
+                    "performing lookups in the polymorphic type registries",
+                    HPX_PERFORMANCE_COUNTER_V1,
+                    hpx::bind(
+                        &performance_counters::locality_raw_counter_creator, _1,
+                        &flat_type_registry_base::get_probe_count, _2),
+                    &performance_counters::locality_counter_discoverer, ""}};
+
+        performance_counters::install_counter_types(
+            counter_types, sizeof(counter_types) / sizeof(counter_types[0]));
+#endif
     }
 }    // namespace hpx::performance_counters
 
@@ -25,6 +25,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <exception>
 #include <string>
 
 namespace hpx { namespace agas { namespace server {
@@ -52,7 +53,17 @@ namespace hpx { namespace agas { namespace server {
             std::string::size_type p = name.find_last_of('/');
             HPX_ASSERT(p != std::string::npos);
 
-            if (agas::detail::primary_namespace_services[i].target_ ==
+            if (agas::detail::primary_namespace_services[i].code_ ==
+                primary_ns_contentions)
+            {
+                help = "returns the number of times an access to the tables "
+                       "of the primary AGAS namespace had to wait for a lock "
+                       "held by another thread (the counter parameter selects "
+                       "a single shard of the tables)";
+                type = performance_counters::counter_type::
+                    monotonically_increasing;
+            }
+            else if (agas::detail::primary_namespace_services[i].target_ ==
                 agas::detail::counter_target_count)
             {
                 help = hpx::util::format("returns the number of invocations "
@@ -231,6 +242,35 @@ namespace hpx { namespace agas { namespace server {
                     &cd::get_overall_count, &service.counter_data_);
                 service.counter_data_.enable_all();
                 break;
+            case primary_ns_contentions:
+            {
+                // the optional parameter selects a single shard
+                std::size_t shard = std::size_t(-1);
+                if (!p.parameters_.empty())
+                {
+                    try
+                    {
+                        shard = std::stoul(p.parameters_);
+                    }
+                    catch (std::exception const&)
+                    {
+                        shard = service.get_num_shards();
+                    }
+
+                    if (shard >= service.get_num_shards())
+                    {
+                        HPX_THROW_EXCEPTION(bad_parameter,
+                            "primary_namespace::statistics",
+                            "invalid shard index '{1}' (the primary "
+                            "namespace has {2} shards)",
+                            p.parameters_, service.get_num_shards());
+                    }
+                }
+                get_data_func =
+                    hpx::bind_front(&primary_namespace::get_contention_count,
+                        &service, shard);
+                break;
+            }
             default:
                 HPX_THROW_EXCEPTION(bad_parameter,
                     "primary_namespace::statistics",
@@ -98,6 +98,10 @@ namespace hpx::plugins {
                 "max_connections_per_locality = ${HPX_PARCEL_" + name_uc +
                 "_MAX_CONNECTIONS_PER_LOCALITY:"
                 "$[hpx.parcel.max_connections_per_locality]}");
+            fillini.emplace_back("connection_cache_shards = ${HPX_PARCEL_" +
+                name_uc +
+                "_CONNECTION_CACHE_SHARDS:"
+                "$[hpx.parcel.connection_cache_shards]}");
             fillini.emplace_back("max_message_size =  ${HPX_PARCEL_" + name_uc +
                 "_MAX_MESSAGE_SIZE:$[hpx.parcel.max_message_size]}");
             fillini.emplace_back("max_outbound_message_size =  ${HPX_PARCEL_" +
@@ -114,6 +118,10 @@ namespace hpx::plugins {
                 "zero_copy_serialization_threshold = ${HPX_PARCEL_" + name_uc +
                 "_ZERO_COPY_SERIALIZATION_THRESHOLD:"
                 "$[hpx.parcel.zero_copy_serialization_threshold]}");
+            fillini.emplace_back(
+                "parallel_serialization_threshold = ${HPX_PARCEL_" + name_uc +
+                "_PARALLEL_SERIALIZATION_THRESHOLD:"
+                "$[hpx.parcel.parallel_serialization_threshold]}");
             fillini.emplace_back("max_background_threads = ${HPX_PARCEL_" +
                 name_uc +
                 "_MAX_BACKGROUND_THREADS:"
@@ -0,0 +1,108 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <cstddef>
+#include <map>
+#include <string>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server : hpx::components::component_base<test_server>
+{
+};
+
+typedef hpx::components::component<test_server> server_type;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+///////////////////////////////////////////////////////////////////////////////
+std::vector<std::string> const names = {
+    "/find_symbols_test/a/1",
+    "/find_symbols_test/a/2",
+    "/find_symbols_test/b/1",
+    "/find_symbols_testx",
+};
+
+void test_find_symbols()
+{
+    for (std::string const& name : names)
+    {
+        hpx::id_type id = hpx::new_<test_server>(hpx::find_here()).get();
+        HPX_TEST(hpx::agas::register_name(hpx::launch::sync, name, id));
+    }
+
+    // exact names
+    std::map<std::string, hpx::id_type> found =
+        hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test/a/1");
+    HPX_TEST_EQ(found.size(), std::size_t(1));
+    HPX_TEST(found.find("/find_symbols_test/a/1") != found.end());
+
+    found = hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test/");
+    HPX_TEST(found.empty());
+
+    // wildcard patterns
+    found = hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test/*");
+    HPX_TEST_EQ(found.size(), std::size_t(3));
+
+    found = hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test*");
+    HPX_TEST_EQ(found.size(), std::size_t(4));
+
+    found =
+        hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test/a/*");
+    HPX_TEST_EQ(found.size(), std::size_t(2));
+
+    found =
+        hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test/?/1");
+    HPX_TEST_EQ(found.size(), std::size_t(2));
+    HPX_TEST(found.find("/find_symbols_test/a/1") != found.end());
+    HPX_TEST(found.find("/find_symbols_test/b/1") != found.end());
+
+    found = hpx::agas::find_symbols(
+        hpx::launch::sync, "/find_symbols_test/[!a]/*");
+    HPX_TEST_EQ(found.size(), std::size_t(1));
+    HPX_TEST(found.find("/find_symbols_test/b/1") != found.end());
+
+    // unbound names are not reported anymore
+    HPX_TEST_NEQ(hpx::agas::unregister_name(
+                     hpx::launch::sync, "/find_symbols_test/a/2"),
+        hpx::invalid_id);
+
+    found =
+        hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test/a/*");
+    HPX_TEST_EQ(found.size(), std::size_t(1));
+
+    for (std::string const& name : names)
+    {
+        if (name != "/find_symbols_test/a/2")
+        {
+            hpx::agas::unregister_name(hpx::launch::sync, name);
+        }
+    }
+
+    found = hpx::agas::find_symbols(hpx::launch::sync, "/find_symbols_test*");
+    HPX_TEST(found.empty());
+}
+
+int hpx_main()
+{
+    test_find_symbols();
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    HPX_TEST_EQ_MSG(hpx::init(argc, argv), 0,
+        "HPX main exited with non-zero status");
+
+    return hpx::util::report_errors();
+}
+#endif
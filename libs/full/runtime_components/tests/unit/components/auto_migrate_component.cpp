@@ -0,0 +1,125 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Verify that an object invoked predominantly from a remote locality is
+// automatically migrated to that locality.
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_init.hpp>
+#include <hpx/include/actions.hpp>
+#include <hpx/include/components.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/include/serialization.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+struct test_server
+  : hpx::components::migration_support<
+        hpx::components::component_base<test_server>>
+{
+    using base_type = hpx::components::migration_support<
+        hpx::components::component_base<test_server>>;
+
+    test_server() = default;
+
+    test_server(test_server const& rhs)
+      : base_type(rhs)
+    {
+    }
+
+    test_server(test_server&& rhs)
+      : base_type(std::move(rhs))
+    {
+    }
+
+    test_server& operator=(test_server const&)
+    {
+        return *this;
+    }
+    test_server& operator=(test_server&&)
+    {
+        return *this;
+    }
+
+    hpx::id_type call() const
+    {
+        return hpx::find_here();
+    }
+
+    HPX_DEFINE_COMPONENT_ACTION(test_server, call, call_action)
+
+    template <typename Archive>
+    void serialize(Archive&, unsigned)
+    {
+    }
+};
+
+using server_type = hpx::components::component<test_server>;
+HPX_REGISTER_COMPONENT(server_type, test_server)
+
+using call_action = test_server::call_action;
+HPX_REGISTER_ACTION_DECLARATION(call_action)
+HPX_REGISTER_ACTION(call_action)
+
+void enable_auto_migration()
+{
+    hpx::components::enable_auto_migration<test_server>();
+}
+HPX_PLAIN_ACTION(enable_auto_migration, enable_auto_migration_action)
+
+///////////////////////////////////////////////////////////////////////////////
+int hpx_main()
+{
+    std::vector<hpx::id_type> localities = hpx::find_remote_localities();
+    if (localities.empty())
+    {
+        return hpx::finalize();
+    }
+
+    hpx::id_type there = localities[0];
+    enable_auto_migration_action()(there);
+
+    hpx::id_type id = hpx::new_<test_server>(there).get();
+    HPX_TEST_EQ(call_action()(id), there);
+
+    // keep invoking the object from here until it arrives
+    auto start = std::chrono::steady_clock::now();
+    while (call_action()(id) != hpx::find_here())
+    {
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(60))
+        {
+            break;
+        }
+        hpx::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    HPX_TEST_EQ(call_action()(id), hpx::find_here());
+
+    return hpx::finalize();
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<std::string> const cfg = {
+        "hpx.auto_migration.interval=100",
+        "hpx.auto_migration.sample_rate=1",
+        "hpx.auto_migration.min_accesses=8",
+    };
+
+    hpx::init_params init_args;
+    init_args.cfg = cfg;
+
+    HPX_TEST_EQ(hpx::init(argc, argv, init_args), 0);
+    return hpx::util::report_errors();
+}
+#endif
@@ -0,0 +1,87 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+/// \file auto_migration.hpp
+
+#pragma once
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/traits/is_component.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/migrate_component.hpp>
+
+#include <type_traits>
+
+namespace hpx { namespace components {
+
+    namespace detail {
+
+        using auto_migrate_function_type = hpx::future<hpx::id_type> (*)(
+            hpx::id_type const&, hpx::id_type const&);
+
+        template <typename Component>
+        hpx::future<hpx::id_type> auto_migrate(
+            hpx::id_type const& to_migrate, hpx::id_type const& target)
+        {
+            return migrate<Component>(to_migrate, target);
+        }
+
+        HPX_EXPORT void register_auto_migration(
+            components::component_type type, auto_migrate_function_type f);
+    }    // namespace detail
+
+    /// Enable the automatic migration of instances of the given component
+    /// type
+    ///
+    /// The function \a enable_auto_migration<Component> starts a service
+    /// (if not running yet) on the calling locality which samples the
+    /// actions invoked on the locally residing instances of \a Component
+    /// and the localities those were invoked from. Objects that are
+    /// predominantly accessed from one particular remote locality are
+    /// migrated to that locality. This function has to be called on each
+    /// locality for which the automatic migration should be enabled.
+    ///
+    /// The behavior of the service is controlled by the configuration
+    /// settings in the section \a hpx.auto_migration:
+    ///
+    /// - \a interval: the time between two evaluations of the collected
+    ///   statistics in milliseconds (default: 1000).
+    /// - \a sample_rate: only every n-th access is recorded (default: 4).
+    /// - \a min_accesses: the minimal number of recorded accesses to an
+    ///   object during one interval for it to be considered (default: 16).
+    /// - \a threshold: the percentage of the recorded accesses that have to
+    ///   originate from the same remote locality (default: 75).
+    /// - \a hysteresis: the number of consecutive intervals an object has to
+    ///   qualify for being migrated to the same locality (default: 2).
+    /// - \a max_migrations: the maximal number of migrations started per
+    ///   interval (default: 8).
+    ///
+    /// \tparam  Component     Specifies the component type of the
+    ///                        objects to automatically migrate. The
+    ///                        component has to support migration.
+    ///
+    template <typename Component>
+#if defined(DOXYGEN)
+    void
+#else
+    inline typename std::enable_if<traits::is_component<Component>::value>::type
+#endif
+    enable_auto_migration()
+    {
+        detail::register_auto_migration(get_component_type<Component>(),
+            &detail::auto_migrate<Component>);
+    }
+
+    /// Stop the automatic migration service on the calling locality
+    ///
+    /// Migrations that were already started by the service are not
+    /// affected.
+    HPX_EXPORT void disable_auto_migration();
+}}    // namespace hpx::components
+#endif
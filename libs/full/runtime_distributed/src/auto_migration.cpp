@@ -0,0 +1,429 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#include <hpx/components_base/component_type.hpp>
+#include <hpx/components_base/detail/object_access_hooks.hpp>
+#include <hpx/concurrency/cache_line_data.hpp>
+#include <hpx/modules/futures.hpp>
+#include <hpx/modules/logging.hpp>
+#include <hpx/naming_base/gid_type.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_distributed/auto_migration.hpp>
+#include <hpx/runtime_local/config_entry.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/runtime_local/interval_timer.hpp>
+#include <hpx/runtime_local/shutdown_function.hpp>
+#include <hpx/synchronization/spinlock.hpp>
+#include <hpx/util/from_string.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace components { namespace detail {
+
+    namespace {
+
+        ///////////////////////////////////////////////////////////////////////
+        // The automatic migration service samples the accesses to migratable
+        // objects residing on this locality. Every interval the collected
+        // statistics are evaluated: objects accessed predominantly from one
+        // remote locality for a number of consecutive intervals are migrated
+        // to that locality.
+        class auto_migration_service
+        {
+            using mutex_type = hpx::spinlock;
+
+            struct object_statistics
+            {
+                components::component_type type_ =
+                    components::component_invalid;
+                std::uint64_t accesses_ = 0;
+                std::map<std::uint32_t, std::uint64_t> remote_accesses_;
+            };
+
+            using statistics_map_type =
+                std::unordered_map<naming::gid_type, object_statistics>;
+
+            struct shard
+            {
+                mutex_type mtx_;
+                statistics_map_type objects_;
+            };
+
+            using shard_type = hpx::util::cache_aligned_data<shard>;
+
+            struct candidate
+            {
+                std::uint32_t target_;
+                std::size_t intervals_;
+            };
+
+            // an object for which a migration will be started, with the
+            // number of accesses from the target locality
+            struct migration
+            {
+                naming::gid_type id_;
+                std::uint32_t target_;
+                std::uint64_t accesses_;
+                auto_migrate_function_type f_;
+            };
+
+            static constexpr std::size_t num_shards = 16;
+
+        public:
+            auto_migration_service()
+              : shards_(new shard_type[num_shards])
+              , sample_rate_(4)
+              , min_accesses_(16)
+              , threshold_(75)
+              , hysteresis_(2)
+              , max_migrations_(8)
+            {
+            }
+
+            static auto_migration_service& get()
+            {
+                static auto_migration_service service;
+                return service;
+            }
+
+            void register_type(components::component_type type,
+                auto_migrate_function_type f)
+            {
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    types_[type] = f;
+                    if (timer_)
+                    {
+                        return;    // already running
+                    }
+
+                    start();
+                }
+
+                // the service has to be stopped before the runtime shuts
+                // down, the objects are not migrated anymore at that point
+                hpx::register_pre_shutdown_function([]() { get().stop(); });
+            }
+
+            void stop()
+            {
+                std::unique_ptr<hpx::util::interval_timer> timer;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+
+                    record_object_access.store(
+                        nullptr, std::memory_order_release);
+                    record_remote_object_access.store(
+                        nullptr, std::memory_order_release);
+
+                    types_.clear();
+                    candidates_.clear();
+                    timer = HPX_MOVE(timer_);
+                }
+
+                if (timer)
+                {
+                    timer->stop(true);
+                }
+
+                for (std::size_t i = 0; i != num_shards; ++i)
+                {
+                    shard& s = shards_[i].data_;
+                    std::lock_guard<mutex_type> l(s.mtx_);
+                    s.objects_.clear();
+                }
+            }
+
+        private:
+            // read the settings and start the timer, the hooks are
+            // installed once the settings are in place
+            void start()
+            {
+                std::int64_t interval = get_setting("interval", 1000);
+                std::size_t const sample_rate = get_setting("sample_rate",
+                    sample_rate_.load(std::memory_order_relaxed));
+                sample_rate_.store((std::max)(sample_rate, std::size_t(1)),
+                    std::memory_order_relaxed);
+                min_accesses_ = get_setting("min_accesses", min_accesses_);
+                threshold_ = (std::min)(
+                    get_setting("threshold", threshold_), std::size_t(100));
+                hysteresis_ = (std::max)(
+                    get_setting("hysteresis", hysteresis_), std::size_t(1));
+                max_migrations_ =
+                    get_setting("max_migrations", max_migrations_);
+
+                timer_.reset(new hpx::util::interval_timer(
+                    [this]() { return evaluate(); }, interval * 1000,
+                    "auto_migration_service", true));
+
+                record_object_access.store(
+                    &auto_migration_service::on_access,
+                    std::memory_order_release);
+                record_remote_object_access.store(
+                    &auto_migration_service::on_remote_access,
+                    std::memory_order_release);
+
+                timer_->start(false);
+            }
+
+            static std::size_t get_setting(
+                char const* name, std::size_t dflt)
+            {
+                return hpx::util::from_string<std::size_t>(
+                    hpx::get_config_entry(
+                        std::string("hpx.auto_migration.") + name, dflt),
+                    dflt);
+            }
+
+            // only every n-th access (per worker thread) is recorded
+            bool sample(std::size_t& count) const noexcept
+            {
+                std::size_t const rate =
+                    sample_rate_.load(std::memory_order_relaxed);
+                return ++count % rate == 0;
+            }
+
+            shard& shard_for(naming::gid_type const& id) const noexcept
+            {
+                return shards_[std::hash<naming::gid_type>()(id) % num_shards]
+                    .data_;
+            }
+
+            static void on_access(
+                naming::gid_type const& id, components::component_type type)
+            {
+                static thread_local std::size_t count = 0;
+
+                auto_migration_service& service = get();
+                if (!service.sample(count))
+                {
+                    return;
+                }
+
+                naming::gid_type const gid =
+                    naming::detail::get_stripped_gid(id);
+
+                shard& s = service.shard_for(gid);
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                object_statistics& stats = s.objects_[gid];
+                stats.type_ = type;
+                ++stats.accesses_;
+            }
+
+            static void on_remote_access(
+                naming::gid_type const& id, std::uint32_t source_locality_id)
+            {
+                static thread_local std::size_t count = 0;
+
+                auto_migration_service& service = get();
+                if (source_locality_id == naming::invalid_locality_id ||
+                    source_locality_id == hpx::get_locality_id() ||
+                    !service.sample(count))
+                {
+                    return;
+                }
+
+                naming::gid_type const gid =
+                    naming::detail::get_stripped_gid(id);
+
+                shard& s = service.shard_for(gid);
+                std::lock_guard<mutex_type> l(s.mtx_);
+
+                ++s.objects_[gid].remote_accesses_[source_locality_id];
+            }
+
+            // evaluate the statistics collected during the last interval
+            bool evaluate()
+            {
+                std::vector<migration> migrations;
+
+                {
+                    std::lock_guard<mutex_type> l(mtx_);
+                    if (!timer_)
+                    {
+                        return false;    // service was stopped
+                    }
+
+                    std::map<naming::gid_type, candidate> candidates;
+                    for (std::size_t i = 0; i != num_shards; ++i)
+                    {
+                        statistics_map_type objects;
+                        {
+                            shard& s = shards_[i].data_;
+                            std::lock_guard<mutex_type> ls(s.mtx_);
+                            std::swap(objects, s.objects_);
+                        }
+
+                        for (auto const& object : objects)
+                        {
+                            evaluate_object(object.first, object.second,
+                                candidates, migrations);
+                        }
+                    }
+
+                    // start the migrations of the objects accessed most
+                    // often from remote localities first, limit the number
+                    // of migrations started for each interval, the
+                    // remaining objects stay candidates for the next one
+                    std::sort(migrations.begin(), migrations.end(),
+                        [](migration const& lhs, migration const& rhs) {
+                            return lhs.accesses_ > rhs.accesses_;
+                        });
+
+                    for (std::size_t i = max_migrations_;
+                         i < migrations.size(); ++i)
+                    {
+                        candidates.emplace(migrations[i].id_,
+                            candidate{migrations[i].target_, hysteresis_});
+                    }
+                    if (migrations.size() > max_migrations_)
+                    {
+                        migrations.resize(max_migrations_);
+                    }
+
+                    for (migration const& m : migrations)
+                    {
+                        migrating_.insert(m.id_);
+                    }
+                    candidates_ = HPX_MOVE(candidates);
+                }
+
+                for (migration const& m : migrations)
+                {
+                    start_migration(m);
+                }
+
+                return true;
+            }
+
+            void start_migration(migration const& m)
+            {
+                hpx::id_type id(
+                    m.id_, hpx::id_type::management_type::unmanaged);
+
+                LRT_(info).format(
+                    "auto_migration_service: migrating {} to locality {}", id,
+                    m.target_);
+
+                m.f_(id, naming::get_id_from_locality_id(m.target_))
+                    .then(hpx::launch::sync,
+                        [this, gid = m.id_](hpx::future<hpx::id_type>&& f) {
+                            {
+                                std::lock_guard<mutex_type> l(mtx_);
+                                migrating_.erase(gid);
+                            }
+
+                            try
+                            {
+                                f.get();
+                            }
+                            catch (std::exception const& e)
+                            {
+                                LRT_(warning).format(
+                                    "auto_migration_service: failed to "
+                                    "migrate {}: {}",
+                                    gid, e.what());
+                            }
+                        });
+            }
+
+            void evaluate_object(naming::gid_type const& id,
+                object_statistics const& stats,
+                std::map<naming::gid_type, candidate>& candidates,
+                std::vector<migration>& migrations)
+            {
+                auto it = types_.find(stats.type_);
+                if (it == types_.end() || stats.accesses_ < min_accesses_ ||
+                    stats.remote_accesses_.empty() ||
+                    migrating_.find(id) != migrating_.end())
+                {
+                    return;
+                }
+
+                // find the remote locality the object was accessed from
+                // most often
+                auto best = std::max_element(stats.remote_accesses_.begin(),
+                    stats.remote_accesses_.end(),
+                    [](auto const& lhs, auto const& rhs) {
+                        return lhs.second < rhs.second;
+                    });
+
+                if (best->second * 100 < threshold_ * stats.accesses_)
+                {
+                    return;
+                }
+
+                // apply hysteresis: the object has to qualify for being
+                // migrated to the same locality for a number of consecutive
+                // intervals
+                std::size_t intervals = 1;
+                auto cit = candidates_.find(id);
+                if (cit != candidates_.end() &&
+                    cit->second.target_ == best->first)
+                {
+                    intervals = cit->second.intervals_ + 1;
+                }
+
+                if (intervals < hysteresis_)
+                {
+                    candidates.emplace(id, candidate{best->first, intervals});
+                    return;
+                }
+
+                migrations.push_back(
+                    migration{id, best->first, best->second, it->second});
+            }
+
+        private:
+            mutable mutex_type mtx_;
+            std::map<components::component_type, auto_migrate_function_type>
+                types_;
+            std::map<naming::gid_type, candidate> candidates_;
+            std::set<naming::gid_type> migrating_;
+            std::unique_ptr<hpx::util::interval_timer> timer_;
+
+            std::unique_ptr<shard_type[]> shards_;
+
+            // read by the hooks without holding the lock
+            std::atomic<std::size_t> sample_rate_;
+            std::size_t min_accesses_;
+            std::size_t threshold_;
+            std::size_t hysteresis_;
+            std::size_t max_migrations_;
+        };
+    }    // namespace
+
+    void register_auto_migration(
+        components::component_type type, auto_migrate_function_type f)
+    {
+        auto_migration_service::get().register_type(type, f);
+    }
+}}}    // namespace hpx::components::detail
+
+namespace hpx { namespace components {
+
+    void disable_auto_migration()
+    {
+        detail::auto_migration_service::get().stop();
+    }
+}}    // namespace hpx::components
@@ -1091,6 +1091,19 @@ namespace hpx {
                 &performance_counters::remote_action_invocation_counter_creator,
                 &performance_counters::
                     remote_action_invocation_counter_discoverer,
+                ""},
+
+            {"/runtime/count/remote-action-direct-execution",
+                performance_counters::counter_type::raw,
+                "returns the number of (remote) invocations of a specific "
+                "non-blocking action on this locality which were executed "
+                "directly on the thread receiving the parcel (the action "
+                "type has to be specified as the counter parameter)",
+                HPX_PERFORMANCE_COUNTER_V1,
+                &performance_counters::
+                    remote_action_direct_execution_counter_creator,
+                &performance_counters::
+                    remote_action_direct_execution_counter_discoverer,
                 ""}
 #endif
         };
@@ -12,6 +12,7 @@
 #include <hpx/parallel/segmented_algorithms/adjacent_difference.hpp>
 #include <hpx/parallel/segmented_algorithms/adjacent_find.hpp>
 #include <hpx/parallel/segmented_algorithms/all_any_none.hpp>
+#include <hpx/parallel/segmented_algorithms/copy.hpp>
 #include <hpx/parallel/segmented_algorithms/count.hpp>
 #include <hpx/parallel/segmented_algorithms/exclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/fill.hpp>
@@ -21,6 +22,7 @@
 #include <hpx/parallel/segmented_algorithms/inclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/minmax.hpp>
 #include <hpx/parallel/segmented_algorithms/reduce.hpp>
+#include <hpx/parallel/segmented_algorithms/sort.hpp>
 #include <hpx/parallel/segmented_algorithms/transform.hpp>
 #include <hpx/parallel/segmented_algorithms/transform_exclusive_scan.hpp>
 #include <hpx/parallel/segmented_algorithms/transform_inclusive_scan.hpp>
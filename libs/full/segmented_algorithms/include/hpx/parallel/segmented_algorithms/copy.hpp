@@ -0,0 +1,402 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/copy.hpp>
+#include <hpx/parallel/algorithms/count.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/move.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_parts.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+#include <hpx/parallel/util/projection_identity.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_copy
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // store the given values starting at the (local) destination
+        template <typename T>
+        struct segmented_store : public algorithm<segmented_store<T>>
+        {
+            constexpr segmented_store() noexcept
+              : segmented_store::algorithm("segmented_store")
+            {
+            }
+
+            template <typename ExPolicy, typename OutIter>
+            static hpx::util::unused_type sequential(
+                ExPolicy&&, OutIter dest, std::vector<T> values)
+            {
+                std::move(values.begin(), values.end(), dest);
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename OutIter>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, OutIter dest, std::vector<T> values)
+            {
+                return hpx::util::void_guard<typename util::detail::
+                               algorithm_result<ExPolicy>::type>(),
+                       hpx::move(HPX_FORWARD(ExPolicy, policy), values.begin(),
+                           values.end(), dest);
+            }
+        };
+
+        // Copy the (selected) elements of a local part of the source range
+        // to the given parts of the destination range. The values are sent
+        // directly to the localities owning the destination segments.
+        template <typename T>
+        struct segmented_copy_to : public algorithm<segmented_copy_to<T>>
+        {
+            constexpr segmented_copy_to() noexcept
+              : segmented_copy_to::algorithm("segmented_copy_to")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename Pred,
+                typename OutIter>
+            static hpx::util::unused_type sequential(ExPolicy&& policy,
+                InIter first, InIter last, Pred&& pred,
+                std::vector<hpx::id_type> const& ids,
+                std::vector<OutIter> const& dests,
+                std::vector<std::size_t> const& counts)
+            {
+                using policy_type = std::decay_t<ExPolicy>;
+                using is_seq = hpx::is_sequenced_execution_policy<policy_type>;
+
+                // plain copies are sliced directly from the source range
+                std::vector<T> values;
+                if constexpr (!std::is_same_v<std::decay_t<Pred>,
+                                  hpx::util::unused_type>)
+                {
+                    std::copy_if(first, last, std::back_inserter(values),
+                        [&](auto const& value) {
+                            return HPX_INVOKE(pred, value);
+                        });
+                }
+
+                std::vector<hpx::future<void>> stored;
+                stored.reserve(ids.size());
+
+                auto it = values.begin();
+                for (std::size_t i = 0; i != ids.size(); ++i)
+                {
+                    std::vector<T> part;
+                    if constexpr (std::is_same_v<std::decay_t<Pred>,
+                                      hpx::util::unused_type>)
+                    {
+                        InIter next = std::next(first, counts[i]);
+                        part.assign(first, next);
+                        first = next;
+                    }
+                    else if (ids.size() == 1)
+                    {
+                        part = HPX_MOVE(values);
+                    }
+                    else
+                    {
+                        auto next = std::next(it, counts[i]);
+                        part.assign(std::make_move_iterator(it),
+                            std::make_move_iterator(next));
+                        it = next;
+                    }
+
+                    stored.push_back(dispatch_async(ids[i],
+                        segmented_store<T>(), policy, is_seq(), dests[i],
+                        HPX_MOVE(part)));
+                }
+
+                std::list<std::exception_ptr> errors;
+                util::detail::handle_remote_exceptions<policy_type>::call(
+                    stored, errors);
+
+                (void) last;
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename InIter, typename Pred,
+                typename OutIter>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, InIter first, InIter last,
+                Pred&& pred, std::vector<hpx::id_type> const& ids,
+                std::vector<OutIter> const& dests,
+                std::vector<std::size_t> const& counts)
+            {
+                sequential(HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(Pred, pred), ids, dests, counts);
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+        };
+
+        // Copy the parts of the source range to the destination range. The
+        // source and destination ranges may be partitioned differently.
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename Pred>
+        hpx::future<SegOutIter> segmented_copy_to_dest(ExPolicy const& policy,
+            std::vector<hpx::id_type> const& ids,
+            std::vector<std::pair<
+                typename hpx::traits::segmented_iterator_traits<
+                    SegIter>::local_iterator,
+                typename hpx::traits::segmented_iterator_traits<
+                    SegIter>::local_iterator>> const& parts,
+            std::vector<std::size_t> const& counts, SegOutIter dest,
+            Pred const& pred)
+        {
+            using value_type =
+                typename std::iterator_traits<SegIter>::value_type;
+            using is_seq = hpx::is_sequenced_execution_policy<ExPolicy>;
+
+            std::vector<hpx::future<void>> copied;
+            copied.reserve(parts.size());
+
+            for (std::size_t i = 0; i != parts.size(); ++i)
+            {
+                segment_parts<SegOutIter> dest_parts;
+                dest = dest_parts.append(dest, counts[i]);
+
+                if (!dest_parts.ids_.empty())
+                {
+                    copied.push_back(dispatch_async(ids[i],
+                        segmented_copy_to<value_type>(), policy, is_seq(),
+                        parts[i].first, parts[i].second, pred,
+                        HPX_MOVE(dest_parts.ids_),
+                        HPX_MOVE(dest_parts.firsts_),
+                        HPX_MOVE(dest_parts.counts_)));
+
+                    if constexpr (is_seq::value)
+                    {
+                        copied.back().wait();
+                    }
+                }
+            }
+
+            return hpx::dataflow(
+                [dest](std::vector<hpx::future<void>>&& r) -> SegOutIter {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        ExPolicy>::call(r, errors);
+                    return dest;
+                },
+                HPX_MOVE(copied));
+        }
+
+        template <typename ExPolicy, typename SegIter, typename SegOutIter>
+        typename util::detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_copy(
+            ExPolicy&& policy, SegIter first, SegIter last, SegOutIter dest)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, SegOutIter>;
+            using local_iterator_type = typename hpx::traits::
+                segmented_iterator_traits<SegIter>::local_iterator;
+
+            if (first == last)
+            {
+                return result::get(HPX_MOVE(dest));
+            }
+
+            std::vector<hpx::id_type> ids;
+            std::vector<std::pair<local_iterator_type, local_iterator_type>>
+                parts;
+            std::vector<std::size_t> counts;
+
+            for_each_segment_part(first, last,
+                [&](hpx::id_type const& id, local_iterator_type beg,
+                    local_iterator_type end) {
+                    ids.push_back(id);
+                    parts.emplace_back(beg, end);
+                    counts.push_back(std::distance(beg, end));
+                });
+
+            auto sync_policy =
+                hpx::execution::experimental::to_non_task(policy);
+
+            return result::get(segmented_copy_to_dest<decltype(sync_policy),
+                SegIter>(sync_policy, ids, parts, counts, dest,
+                hpx::util::unused));
+        }
+
+        template <typename ExPolicy, typename SegIter, typename SegOutIter,
+            typename Pred>
+        typename util::detail::algorithm_result<ExPolicy, SegOutIter>::type
+        segmented_copy_if(ExPolicy&& policy, SegIter first, SegIter last,
+            SegOutIter dest, Pred&& pred)
+        {
+            using result = util::detail::algorithm_result<ExPolicy, SegOutIter>;
+            using local_iterator_type = typename hpx::traits::
+                segmented_iterator_traits<SegIter>::local_iterator;
+            using difference_type =
+                typename std::iterator_traits<SegIter>::difference_type;
+
+            if (first == last)
+            {
+                return result::get(HPX_MOVE(dest));
+            }
+
+            auto sync_policy =
+                hpx::execution::experimental::to_non_task(policy);
+            using sync_policy_type = decltype(sync_policy);
+            using is_seq = hpx::is_sequenced_execution_policy<sync_policy_type>;
+
+            // count the selected elements of each part first, this
+            // determines where the parts go in the destination range
+            std::vector<hpx::id_type> ids;
+            std::vector<std::pair<local_iterator_type, local_iterator_type>>
+                parts;
+            std::vector<hpx::future<difference_type>> counted;
+
+            for_each_segment_part(first, last,
+                [&](hpx::id_type const& id, local_iterator_type beg,
+                    local_iterator_type end) {
+                    ids.push_back(id);
+                    parts.emplace_back(beg, end);
+                    counted.push_back(dispatch_async(id,
+                        count_if<difference_type>(), sync_policy, is_seq(),
+                        beg, end, pred, util::projection_identity{}));
+                });
+
+            hpx::future<hpx::future<SegOutIter>> f = hpx::dataflow(
+                [sync_policy, ids = HPX_MOVE(ids), parts = HPX_MOVE(parts),
+                    dest, pred = HPX_FORWARD(Pred, pred)](
+                    std::vector<hpx::future<difference_type>>&& r) mutable
+                -> hpx::future<SegOutIter> {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        sync_policy_type>::call(r, errors);
+
+                    std::vector<std::size_t> counts;
+                    counts.reserve(r.size());
+                    for (auto&& count : r)
+                    {
+                        counts.push_back(count.get());
+                    }
+
+                    return segmented_copy_to_dest<sync_policy_type, SegIter>(
+                        sync_policy, ids, parts, counts, dest, pred);
+                },
+                HPX_MOVE(counted));
+
+            return result::get(hpx::future<SegOutIter>(HPX_MOVE(f)));
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace segmented {
+
+    // The source and destination ranges may be partitioned differently, the
+    // values are sent directly from the localities owning the source
+    // segments to the localities owning the destination segments.
+
+    // clang-format off
+    template <typename SegIter, typename SegOutIter,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value &&
+            hpx::traits::is_iterator_v<SegOutIter> &&
+            hpx::traits::is_segmented_iterator<SegOutIter>::value
+        )>
+    // clang-format on
+    SegOutIter tag_invoke(
+        hpx::copy_t, SegIter first, SegIter last, SegOutIter dest)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::v1::detail::segmented_copy(
+            hpx::execution::seq, first, last, dest);
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename SegOutIter,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value &&
+            hpx::traits::is_iterator_v<SegOutIter> &&
+            hpx::traits::is_segmented_iterator<SegOutIter>::value
+        )>
+    // clang-format on
+    typename parallel::util::detail::algorithm_result<ExPolicy,
+        SegOutIter>::type
+    tag_invoke(hpx::copy_t, ExPolicy&& policy, SegIter first, SegIter last,
+        SegOutIter dest)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::v1::detail::segmented_copy(
+            HPX_FORWARD(ExPolicy, policy), first, last, dest);
+    }
+
+    // clang-format off
+    template <typename SegIter, typename SegOutIter, typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value &&
+            hpx::traits::is_iterator_v<SegOutIter> &&
+            hpx::traits::is_segmented_iterator<SegOutIter>::value
+        )>
+    // clang-format on
+    SegOutIter tag_invoke(hpx::copy_if_t, SegIter first, SegIter last,
+        SegOutIter dest, Pred&& pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::v1::detail::segmented_copy_if(
+            hpx::execution::seq, first, last, dest, HPX_FORWARD(Pred, pred));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter, typename SegOutIter,
+        typename Pred,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value &&
+            hpx::traits::is_iterator_v<SegOutIter> &&
+            hpx::traits::is_segmented_iterator<SegOutIter>::value
+        )>
+    // clang-format on
+    typename parallel::util::detail::algorithm_result<ExPolicy,
+        SegOutIter>::type
+    tag_invoke(hpx::copy_if_t, ExPolicy&& policy, SegIter first, SegIter last,
+        SegOutIter dest, Pred&& pred)
+    {
+        static_assert(hpx::traits::is_forward_iterator_v<SegIter>,
+            "Requires at least forward iterator.");
+
+        return hpx::parallel::v1::detail::segmented_copy_if(
+            HPX_FORWARD(ExPolicy, policy), first, last, dest,
+            HPX_FORWARD(Pred, pred));
+    }
+}}    // namespace hpx::segmented
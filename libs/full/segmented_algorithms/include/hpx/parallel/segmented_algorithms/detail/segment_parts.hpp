@@ -0,0 +1,124 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/functional/invoke.hpp>
+#include <hpx/naming_base/id_type.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 { namespace detail {
+    /// \cond NOINTERNAL
+
+    // Invoke f(id, begin, end) for each non-empty part of [first, last) that
+    // is stored on a single segment, begin and end are local iterators.
+    template <typename SegIter, typename F>
+    void for_each_segment_part(SegIter first, SegIter last, F&& f)
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegIter>;
+        using segment_iterator = typename traits::segment_iterator;
+        using local_iterator_type = typename traits::local_iterator;
+
+        segment_iterator sit = traits::segment(first);
+        segment_iterator send = traits::segment(last);
+
+        if (sit == send)
+        {
+            // all elements are on the same partition
+            local_iterator_type beg = traits::local(first);
+            local_iterator_type end = traits::local(last);
+            if (beg != end)
+            {
+                HPX_INVOKE(f, traits::get_id(sit), beg, end);
+            }
+            return;
+        }
+
+        // handle the remaining part of the first partition
+        local_iterator_type beg = traits::local(first);
+        local_iterator_type end = traits::end(sit);
+        if (beg != end)
+        {
+            HPX_INVOKE(f, traits::get_id(sit), beg, end);
+        }
+
+        // handle all of the full partitions
+        for (++sit; sit != send; ++sit)
+        {
+            beg = traits::begin(sit);
+            end = traits::end(sit);
+            if (beg != end)
+            {
+                HPX_INVOKE(f, traits::get_id(sit), beg, end);
+            }
+        }
+
+        // handle the beginning of the last partition
+        beg = traits::begin(sit);
+        end = traits::local(last);
+        if (beg != end)
+        {
+            HPX_INVOKE(f, traits::get_id(sit), beg, end);
+        }
+    }
+
+    // The parts of a destination range stored on a single segment each. This
+    // allows to map a source range onto a differently partitioned
+    // destination range.
+    template <typename SegOutIter>
+    struct segment_parts
+    {
+        using traits = hpx::traits::segmented_iterator_traits<SegOutIter>;
+        using local_iterator_type = typename traits::local_iterator;
+
+        // Append the parts of [dest, dest + count) and return the iterator
+        // referring to the end of that range.
+        SegOutIter append(SegOutIter dest, std::size_t count)
+        {
+            auto sit = traits::segment(dest);
+            local_iterator_type local = traits::local(dest);
+
+            while (count != 0)
+            {
+                std::size_t const available =
+                    std::distance(local, traits::end(sit));
+                if (available != 0)
+                {
+                    std::size_t const n = (std::min)(available, count);
+
+                    ids_.push_back(traits::get_id(sit));
+                    firsts_.push_back(local);
+                    counts_.push_back(n);
+
+                    count -= n;
+                    if (count == 0)
+                    {
+                        std::advance(local, n);
+                        break;
+                    }
+                }
+
+                ++sit;
+                local = traits::begin(sit);
+            }
+
+            return traits::compose(sit, local);
+        }
+
+        std::vector<hpx::id_type> ids_;
+        std::vector<local_iterator_type> firsts_;
+        std::vector<std::size_t> counts_;
+    };
+
+    /// \endcond
+}}}}    // namespace hpx::parallel::v1::detail
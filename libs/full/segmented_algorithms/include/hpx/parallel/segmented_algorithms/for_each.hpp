@@ -8,6 +8,8 @@
 
 #include <hpx/config.hpp>
 #include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/iterator_support/traits/is_iterator.hpp>
 
 #include <hpx/executors/execution_policy.hpp>
 #include <hpx/parallel/algorithms/detail/dispatch.hpp>
@@ -21,6 +23,7 @@
 #include <exception>
 #include <iterator>
 #include <list>
+#include <memory>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -33,6 +36,90 @@ namespace hpx { namespace parallel { inline namespace v1 {
         ///////////////////////////////////////////////////////////////////////
         /// \cond NOINTERNAL
 
+        // The algorithm executed on each of the segments. If the local
+        // iterators refer to contiguous memory the loop is run on plain
+        // pointers, which allows for it to be vectorized in the same way as
+        // a loop over a std::vector.
+        template <typename Iter>
+        struct segmented_local_for_each
+          : public detail::algorithm<segmented_local_for_each<Iter>, Iter>
+        {
+            constexpr segmented_local_for_each() noexcept
+              : segmented_local_for_each::algorithm("for_each")
+            {
+            }
+
+            template <typename ExPolicy, typename InIter, typename F,
+                typename Proj>
+            static InIter sequential(ExPolicy&& policy, InIter first,
+                InIter last, F&& f, Proj&& proj)
+            {
+                if constexpr (hpx::traits::is_contiguous_iterator_v<InIter>)
+                {
+                    if (first == last)
+                    {
+                        return first;
+                    }
+
+                    auto* begin = std::addressof(*first);
+                    auto* end = begin + std::distance(first, last);
+                    auto* it = for_each<decltype(begin)>::sequential(
+                        HPX_FORWARD(ExPolicy, policy), begin, end,
+                        HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+
+                    return std::next(first, it - begin);
+                }
+                else
+                {
+                    return for_each<InIter>::sequential(
+                        HPX_FORWARD(ExPolicy, policy), first, last,
+                        HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+                }
+            }
+
+            template <typename ExPolicy, typename FwdIter, typename F,
+                typename Proj>
+            static util::detail::algorithm_result_t<ExPolicy, FwdIter>
+            parallel(ExPolicy&& policy, FwdIter first, FwdIter last, F&& f,
+                Proj&& proj)
+            {
+                if constexpr (hpx::traits::is_contiguous_iterator_v<FwdIter>)
+                {
+                    using result =
+                        util::detail::algorithm_result<ExPolicy, FwdIter>;
+
+                    if (first == last)
+                    {
+                        return result::get(HPX_MOVE(first));
+                    }
+
+                    auto* begin = std::addressof(*first);
+                    auto* end = begin + std::distance(first, last);
+                    auto&& it = for_each<decltype(begin)>::parallel(
+                        HPX_FORWARD(ExPolicy, policy), begin, end,
+                        HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+
+                    if constexpr (hpx::is_async_execution_policy_v<ExPolicy>)
+                    {
+                        return hpx::make_future<FwdIter>(HPX_MOVE(it),
+                            [first, begin](auto* p) -> FwdIter {
+                                return std::next(first, p - begin);
+                            });
+                    }
+                    else
+                    {
+                        return std::next(first, it - begin);
+                    }
+                }
+                else
+                {
+                    return for_each<FwdIter>::parallel(
+                        HPX_FORWARD(ExPolicy, policy), first, last,
+                        HPX_FORWARD(F, f), HPX_FORWARD(Proj, proj));
+                }
+            }
+        };
+
         // sequential remote implementation
         template <typename Algo, typename ExPolicy, typename SegIter,
             typename F, typename Proj>
@@ -207,7 +294,7 @@ namespace hpx { namespace segmented {
         }
 
         return hpx::parallel::v1::detail::segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
+            hpx::parallel::v1::detail::segmented_local_for_each<
                 typename iterator_traits::local_iterator>(),
             hpx::execution::seq, first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), std::true_type());
@@ -243,7 +330,7 @@ namespace hpx { namespace segmented {
         using iterator_traits = hpx::traits::segmented_iterator_traits<SegIter>;
 
         return segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
+            hpx::parallel::v1::detail::segmented_local_for_each<
                 typename iterator_traits::local_iterator>(),
             HPX_FORWARD(ExPolicy, policy), first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), is_seq());
@@ -272,7 +359,7 @@ namespace hpx { namespace segmented {
         auto last = first;
         hpx::parallel::v1::detail::advance(last, std::size_t(count));
         return hpx::parallel::v1::detail::segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
+            hpx::parallel::v1::detail::segmented_local_for_each<
                 typename iterator_traits::local_iterator>(),
             hpx::execution::seq, first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), std::true_type());
@@ -310,7 +397,7 @@ namespace hpx { namespace segmented {
         auto last = first;
         hpx::parallel::v1::detail::advance(last, std::size_t(count));
         return segmented_for_each(
-            hpx::parallel::v1::detail::for_each<
+            hpx::parallel::v1::detail::segmented_local_for_each<
                 typename iterator_traits::local_iterator>(),
             HPX_FORWARD(ExPolicy, policy), first, last, HPX_FORWARD(F, f),
             hpx::parallel::util::projection_identity(), is_seq());
@@ -0,0 +1,405 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include <hpx/config.hpp>
+#include <hpx/algorithms/traits/segmented_iterator_traits.hpp>
+#include <hpx/assert.hpp>
+#include <hpx/async_distributed/dataflow.hpp>
+#include <hpx/collectives/all_gather.hpp>
+#include <hpx/collectives/all_to_all.hpp>
+#include <hpx/collectives/argument_types.hpp>
+#include <hpx/collectives/create_communicator.hpp>
+#include <hpx/futures/future.hpp>
+#include <hpx/naming_base/id_type.hpp>
+#include <hpx/runtime_local/get_locality_id.hpp>
+#include <hpx/type_support/unused.hpp>
+
+#include <hpx/executors/execution_policy.hpp>
+#include <hpx/parallel/algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/algorithms/sort.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/dispatch.hpp>
+#include <hpx/parallel/segmented_algorithms/detail/segment_parts.hpp>
+#include <hpx/parallel/util/detail/algorithm_result.hpp>
+#include <hpx/parallel/util/detail/handle_remote_exceptions.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <numeric>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace hpx { namespace parallel { inline namespace v1 {
+    ///////////////////////////////////////////////////////////////////////////
+    // segmented_sort
+    namespace detail {
+        ///////////////////////////////////////////////////////////////////////
+        /// \cond NOINTERNAL
+
+        // Sort the local part and return the given number of regularly
+        // spaced samples taken from the sorted values.
+        template <typename T>
+        struct segmented_sort_sample
+          : public algorithm<segmented_sort_sample<T>, std::vector<T>>
+        {
+            constexpr segmented_sort_sample() noexcept
+              : segmented_sort_sample::algorithm("segmented_sort_sample")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static std::vector<T> sequential(ExPolicy&& policy, Iter first,
+                Iter last, Comp&& comp, std::size_t num_samples)
+            {
+                hpx::sort(HPX_FORWARD(ExPolicy, policy), first, last, comp);
+
+                std::size_t const size = std::distance(first, last);
+
+                std::vector<T> samples;
+                samples.reserve(num_samples);
+                for (std::size_t i = 1; i <= num_samples; ++i)
+                {
+                    samples.push_back(
+                        *std::next(first, (i * size) / (num_samples + 1)));
+                }
+                return samples;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static std::vector<T> parallel(ExPolicy&& policy, Iter first,
+                Iter last, Comp&& comp, std::size_t num_samples)
+            {
+                return sequential(HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(Comp, comp), num_samples);
+            }
+        };
+
+        // Merge adjacent sorted runs until a single sorted run is left
+        template <typename T, typename Comp>
+        std::vector<T> merge_sorted_runs(
+            std::vector<std::vector<T>>&& runs, Comp const& comp)
+        {
+            std::size_t size = 0;
+            for (auto const& run : runs)
+            {
+                size += run.size();
+            }
+
+            std::vector<T> result;
+            result.reserve(size);
+
+            std::vector<std::size_t> bounds;
+            bounds.reserve(runs.size() + 1);
+            bounds.push_back(0);
+
+            for (auto& run : runs)
+            {
+                if (!run.empty())
+                {
+                    result.insert(result.end(),
+                        std::make_move_iterator(run.begin()),
+                        std::make_move_iterator(run.end()));
+                    bounds.push_back(result.size());
+                }
+            }
+
+            while (bounds.size() > 2)
+            {
+                std::size_t merged = 1;
+                std::size_t i = 0;
+                for (/**/; i + 2 < bounds.size(); i += 2)
+                {
+                    std::inplace_merge(result.begin() + bounds[i],
+                        result.begin() + bounds[i + 1],
+                        result.begin() + bounds[i + 2], comp);
+                    bounds[merged++] = bounds[i + 2];
+                }
+
+                // an odd run is carried over to the next round
+                if (i + 1 < bounds.size())
+                {
+                    bounds[merged++] = bounds[i + 1];
+                }
+                bounds.resize(merged);
+            }
+
+            return result;
+        }
+
+        // Exchange the values of the (locally sorted) part with all other
+        // parts such that each part ends up holding its share of the
+        // globally sorted sequence. The parts act as the sites of a
+        // communicator.
+        template <typename T>
+        struct segmented_sort_exchange
+          : public algorithm<segmented_sort_exchange<T>>
+        {
+            constexpr segmented_sort_exchange() noexcept
+              : segmented_sort_exchange::algorithm("segmented_sort_exchange")
+            {
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static hpx::util::unused_type sequential(ExPolicy&&, Iter first,
+                Iter last, Comp&& comp, std::vector<T> const& splitters,
+                std::vector<std::size_t> const& sizes, std::size_t this_part,
+                std::string const& basename)
+            {
+                using namespace hpx::collectives;
+
+                std::size_t const num_parts = sizes.size();
+                HPX_ASSERT(splitters.size() + 1 == num_parts);
+
+                communicator comm = create_communicator(basename.c_str(),
+                    num_sites_arg(num_parts), this_site_arg(this_part));
+
+                // send the values falling into bucket i to part i
+                std::vector<std::vector<T>> buckets(num_parts);
+                Iter it = first;
+                for (std::size_t i = 0; i != num_parts; ++i)
+                {
+                    Iter next = i + 1 == num_parts ?
+                        last :
+                        std::upper_bound(it, last, splitters[i], comp);
+
+                    buckets[i].assign(std::make_move_iterator(it),
+                        std::make_move_iterator(next));
+                    it = next;
+                }
+
+                std::vector<T> bucket = merge_sorted_runs(
+                    all_to_all(comm, HPX_MOVE(buckets),
+                        this_site_arg(this_part), generation_arg(1))
+                        .get(),
+                    comp);
+
+                // the buckets generally don't match the sizes of the parts,
+                // send each part the values that fall into its range
+                std::vector<std::size_t> bucket_sizes =
+                    all_gather(comm, bucket.size(), this_site_arg(this_part),
+                        generation_arg(2))
+                        .get();
+
+                std::size_t const bucket_begin =
+                    std::accumulate(bucket_sizes.begin(),
+                        bucket_sizes.begin() + this_part, std::size_t(0));
+                std::size_t const bucket_end = bucket_begin + bucket.size();
+
+                std::vector<std::vector<T>> shares(num_parts);
+                std::size_t part_begin = 0;
+                for (std::size_t i = 0; i != num_parts; ++i)
+                {
+                    std::size_t const part_end = part_begin + sizes[i];
+                    std::size_t const lo = (std::max)(part_begin, bucket_begin);
+                    std::size_t const hi = (std::min)(part_end, bucket_end);
+                    if (lo < hi)
+                    {
+                        auto it = bucket.begin() + (lo - bucket_begin);
+                        shares[i].assign(std::make_move_iterator(it),
+                            std::make_move_iterator(it + (hi - lo)));
+                    }
+                    part_begin = part_end;
+                }
+
+                // the shares arrive ordered by the sending part, which is
+                // the global order
+                for (auto& share : all_to_all(comm, HPX_MOVE(shares),
+                         this_site_arg(this_part), generation_arg(3))
+                                       .get())
+                {
+                    first = std::move(share.begin(), share.end(), first);
+                }
+                HPX_ASSERT(first == last);
+
+                return hpx::util::unused;
+            }
+
+            template <typename ExPolicy, typename Iter, typename Comp>
+            static typename util::detail::algorithm_result<ExPolicy>::type
+            parallel(ExPolicy&& policy, Iter first, Iter last, Comp&& comp,
+                std::vector<T> const& splitters,
+                std::vector<std::size_t> const& sizes, std::size_t this_part,
+                std::string const& basename)
+            {
+                sequential(HPX_FORWARD(ExPolicy, policy), first, last,
+                    HPX_FORWARD(Comp, comp), splitters, sizes, this_part,
+                    basename);
+                return util::detail::algorithm_result<ExPolicy>::get();
+            }
+        };
+
+        // each sort needs its own communicator
+        inline std::string get_segmented_sort_basename()
+        {
+            static std::atomic<std::size_t> count(0);
+            return "/hpx/segmented/sort/" +
+                std::to_string(hpx::get_locality_id()) + "/" +
+                std::to_string(++count);
+        }
+
+        // Distributed sample sort: the parts are sorted locally, the
+        // splitters are selected from regularly spaced samples of all parts,
+        // the values are exchanged between the parts using all_to_all, and
+        // each part merges the sorted runs it has received.
+        template <typename ExPolicy, typename SegIter, typename Comp>
+        typename util::detail::algorithm_result<ExPolicy>::type segmented_sort(
+            ExPolicy&& policy, SegIter first, SegIter last, Comp&& comp)
+        {
+            using result = util::detail::algorithm_result<ExPolicy>;
+            using value_type =
+                typename std::iterator_traits<SegIter>::value_type;
+            using local_iterator_type = typename hpx::traits::
+                segmented_iterator_traits<SegIter>::local_iterator;
+
+            auto sync_policy =
+                hpx::execution::experimental::to_non_task(policy);
+            using sync_policy_type = decltype(sync_policy);
+            using is_seq = hpx::is_sequenced_execution_policy<sync_policy_type>;
+
+            std::vector<hpx::id_type> ids;
+            std::vector<std::pair<local_iterator_type, local_iterator_type>>
+                parts;
+            std::vector<std::size_t> sizes;
+
+            for_each_segment_part(first, last,
+                [&](hpx::id_type const& id, local_iterator_type beg,
+                    local_iterator_type end) {
+                    ids.push_back(id);
+                    parts.emplace_back(beg, end);
+                    sizes.push_back(std::distance(beg, end));
+                });
+
+            if (parts.empty())
+            {
+                return result::get();
+            }
+
+            std::size_t const num_parts = parts.size();
+
+            std::vector<hpx::future<std::vector<value_type>>> sampled;
+            sampled.reserve(num_parts);
+            for (std::size_t i = 0; i != num_parts; ++i)
+            {
+                sampled.push_back(dispatch_async(ids[i],
+                    segmented_sort_sample<value_type>(), sync_policy, is_seq(),
+                    parts[i].first, parts[i].second, comp, num_parts - 1));
+            }
+
+            hpx::future<hpx::future<void>> f = hpx::dataflow(
+                [sync_policy, comp, ids = HPX_MOVE(ids),
+                    parts = HPX_MOVE(parts), sizes = HPX_MOVE(sizes)](
+                    std::vector<hpx::future<std::vector<value_type>>>&& r)
+                    -> hpx::future<void> {
+                    // handle any remote exceptions, will throw on error
+                    std::list<std::exception_ptr> errors;
+                    parallel::util::detail::handle_remote_exceptions<
+                        sync_policy_type>::call(r, errors);
+
+                    std::size_t const num_parts = parts.size();
+                    if (num_parts == 1)
+                    {
+                        return hpx::make_ready_future();
+                    }
+
+                    std::vector<value_type> samples;
+                    for (auto&& part_samples : r)
+                    {
+                        std::vector<value_type> s = part_samples.get();
+                        samples.insert(samples.end(),
+                            std::make_move_iterator(s.begin()),
+                            std::make_move_iterator(s.end()));
+                    }
+                    std::sort(samples.begin(), samples.end(), comp);
+
+                    std::vector<value_type> splitters;
+                    splitters.reserve(num_parts - 1);
+                    for (std::size_t i = 1; i != num_parts; ++i)
+                    {
+                        splitters.push_back(
+                            samples[(i * samples.size()) / num_parts]);
+                    }
+
+                    // all parts have to take part in the exchange
+                    // concurrently, even for sequential execution
+                    std::string const basename = get_segmented_sort_basename();
+
+                    std::vector<hpx::future<void>> exchanged;
+                    exchanged.reserve(num_parts);
+                    for (std::size_t i = 0; i != num_parts; ++i)
+                    {
+                        exchanged.push_back(dispatch_async(ids[i],
+                            segmented_sort_exchange<value_type>(), sync_policy,
+                            is_seq(), parts[i].first, parts[i].second, comp,
+                            splitters, sizes, i, basename));
+                    }
+
+                    return hpx::dataflow(
+                        [](std::vector<hpx::future<void>>&& r) {
+                            std::list<std::exception_ptr> errors;
+                            parallel::util::detail::handle_remote_exceptions<
+                                sync_policy_type>::call(r, errors);
+                        },
+                        HPX_MOVE(exchanged));
+                },
+                HPX_MOVE(sampled));
+
+            return result::get(hpx::future<void>(HPX_MOVE(f)));
+        }
+        /// \endcond
+    }    // namespace detail
+}}}      // namespace hpx::parallel::v1
+
+namespace hpx { namespace segmented {
+
+    // The comparison function has to be serializable as it is used on the
+    // localities owning the segments.
+
+    // clang-format off
+    template <typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    void tag_invoke(
+        hpx::sort_t, SegIter first, SegIter last, Comp&& comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        hpx::parallel::v1::detail::segmented_sort(
+            hpx::execution::seq, first, last, HPX_FORWARD(Comp, comp));
+    }
+
+    // clang-format off
+    template <typename ExPolicy, typename SegIter,
+        typename Comp = hpx::parallel::v1::detail::less,
+        HPX_CONCEPT_REQUIRES_(
+            hpx::is_execution_policy_v<ExPolicy> &&
+            hpx::traits::is_iterator_v<SegIter> &&
+            hpx::traits::is_segmented_iterator<SegIter>::value
+        )>
+    // clang-format on
+    typename parallel::util::detail::algorithm_result<ExPolicy>::type
+    tag_invoke(hpx::sort_t, ExPolicy&& policy, SegIter first, SegIter last,
+        Comp&& comp = Comp())
+    {
+        static_assert(hpx::traits::is_random_access_iterator_v<SegIter>,
+            "Requires a random access iterator.");
+
+        return hpx::parallel::v1::detail::segmented_sort(
+            HPX_FORWARD(ExPolicy, policy), first, last,
+            HPX_FORWARD(Comp, comp));
+    }
+}}    // namespace hpx::segmented
@@ -0,0 +1,178 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_copy.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> iota_vector(hpx::partitioned_vector<T>& v)
+{
+    std::vector<T> values;
+    values.reserve(v.size());
+
+    T val = T(0);
+    for (auto it = v.begin(); it != v.end(); ++it, val += T(1))
+    {
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+template <typename T>
+void compare_vectors(
+    hpx::partitioned_vector<T> const& v, std::vector<T> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    auto it = expected.begin();
+    for (auto vit = v.begin(); vit != v.end(); ++vit, ++it)
+    {
+        HPX_TEST_EQ(T(*vit), *it);
+    }
+}
+
+struct is_odd
+{
+    template <typename T>
+    bool operator()(T const& val) const
+    {
+        return static_cast<int>(val) % 2 != 0;
+    }
+};
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy1, typename DistPolicy2,
+    typename ExPolicy>
+void copy_algo_tests_with_policy(std::size_t size, DistPolicy1 const& policy1,
+    DistPolicy2 const& policy2, ExPolicy const& copy_policy)
+{
+    hpx::partitioned_vector<T> v1(size, policy1);
+    std::vector<T> values = iota_vector(v1);
+
+    // the destination is partitioned differently
+    hpx::partitioned_vector<T> v2(size, T(0), policy2);
+    auto dest = hpx::copy(copy_policy, v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(dest == v2.end());
+    compare_vectors(v2, values);
+
+    // copy to an offset
+    hpx::partitioned_vector<T> v3(size + 5, T(0), policy2);
+    dest = hpx::copy(copy_policy, v1.begin() + 1, v1.end(), v3.begin() + 3);
+    HPX_TEST(dest == v3.begin() + size + 2);
+
+    std::vector<T> expected(size + 5, T(0));
+    std::copy(values.begin() + 1, values.end(), expected.begin() + 3);
+    compare_vectors(v3, expected);
+
+    // copy_if
+    hpx::partitioned_vector<T> v4(size, T(0), policy2);
+    dest = hpx::copy_if(
+        copy_policy, v1.begin(), v1.end(), v4.begin(), is_odd());
+
+    expected.assign(size, T(0));
+    auto last = std::copy_if(
+        values.begin(), values.end(), expected.begin(), is_odd());
+    HPX_TEST(dest == v4.begin() + std::distance(expected.begin(), last));
+    compare_vectors(v4, expected);
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2,
+    typename ExPolicy>
+void copy_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy1 const& policy1, DistPolicy2 const& policy2,
+    ExPolicy const& copy_policy)
+{
+    hpx::partitioned_vector<T> v1(size, policy1);
+    std::vector<T> values = iota_vector(v1);
+
+    using hpx::execution::task;
+
+    hpx::partitioned_vector<T> v2(size, T(0), policy2);
+    auto f = hpx::copy(copy_policy(task), v1.begin(), v1.end(), v2.begin());
+    HPX_TEST(f.get() == v2.end());
+    compare_vectors(v2, values);
+
+    hpx::partitioned_vector<T> v3(size, T(0), policy2);
+    f = hpx::copy_if(
+        copy_policy(task), v1.begin(), v1.end(), v3.begin(), is_odd());
+
+    std::vector<T> expected(size, T(0));
+    auto last = std::copy_if(
+        values.begin(), values.end(), expected.begin(), is_odd());
+    HPX_TEST(f.get() == v3.begin() + std::distance(expected.begin(), last));
+    compare_vectors(v3, expected);
+}
+
+template <typename T, typename DistPolicy1, typename DistPolicy2>
+void copy_tests_with_policy(std::size_t size, DistPolicy1 const& policy1,
+    DistPolicy2 const& policy2)
+{
+    using namespace hpx::execution;
+
+    copy_algo_tests_with_policy<T>(size, policy1, policy2, seq);
+    copy_algo_tests_with_policy<T>(size, policy1, policy2, par);
+
+    copy_algo_tests_with_policy_async<T>(size, policy1, policy2, seq);
+    copy_algo_tests_with_policy_async<T>(size, policy1, policy2, par);
+
+    // the non-policy overloads
+    hpx::partitioned_vector<T> v1(size, policy1);
+    std::vector<T> values = iota_vector(v1);
+
+    hpx::partitioned_vector<T> v2(size, T(0), policy2);
+    HPX_TEST(hpx::copy(v1.begin(), v1.end(), v2.begin()) == v2.end());
+    compare_vectors(v2, values);
+
+    hpx::partitioned_vector<T> v3(size, T(0), policy2);
+    hpx::copy_if(v1.begin(), v1.end(), v3.begin(), is_odd());
+
+    std::vector<T> expected(size, T(0));
+    std::copy_if(values.begin(), values.end(), expected.begin(), is_odd());
+    compare_vectors(v3, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void copy_tests()
+{
+    std::size_t const length = 100;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    copy_tests_with_policy<T>(
+        length, hpx::container_layout, hpx::container_layout(3));
+    copy_tests_with_policy<T>(length, hpx::container_layout(3),
+        hpx::container_layout(7, localities));
+    copy_tests_with_policy<T>(length, hpx::container_layout(localities),
+        hpx::container_layout(3, localities));
+    copy_tests_with_policy<T>(length, hpx::container_layout(5, localities),
+        hpx::container_layout(localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    copy_tests<double>();
+    copy_tests<int>();
+
+    return 0;
+}
+#endif
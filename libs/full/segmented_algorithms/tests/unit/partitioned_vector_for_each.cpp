@@ -189,6 +189,40 @@ void for_each_tests(std::vector<hpx::id_type>& localities)
         test_for_each_async(hpx::execution::seq(hpx::execution::task), v, T(3));
         test_for_each_async(hpx::execution::par(hpx::execution::task), v, T(4));
     }
+
+    // large enough for the partitions to be touched in parallel
+    {
+        std::size_t const large_length = 100000;
+
+        hpx::partitioned_vector<T> v(
+            large_length, T(0), hpx::container_layout(localities));
+        test_for_each(hpx::execution::seq, v, T(0));
+        test_for_each(hpx::execution::par, v, T(1));
+        test_for_each_async(hpx::execution::par(hpx::execution::task), v, T(2));
+    }
+
+    // sub-ranges, the returned iterators have to refer to their end
+    {
+        hpx::partitioned_vector<T> v(
+            length, T(0), hpx::container_layout(localities));
+
+        auto first = v.begin() + 1;
+        auto last = v.end() - 1;
+        auto result = hpx::for_each(hpx::execution::seq, first, last, pfo());
+        HPX_TEST(result == last);
+
+        result = hpx::for_each(hpx::execution::par, first, last, pfo());
+        HPX_TEST(result == last);
+
+        result = hpx::for_each(
+            hpx::execution::par(hpx::execution::task), first, last, pfo())
+                     .get();
+        HPX_TEST(result == last);
+
+        HPX_TEST_EQ(T(*v.begin()), T(0));
+        HPX_TEST_EQ(T(*first), T(3));
+        HPX_TEST_EQ(T(*last), T(0));
+    }
 }
 
 ///////////////////////////////////////////////////////////////////////////////
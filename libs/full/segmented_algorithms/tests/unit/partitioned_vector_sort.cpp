@@ -0,0 +1,148 @@
+//  Copyright (c) 2026 agent
+//
+//  SPDX-License-Identifier: BSL-1.0
+//  Distributed under the Boost Software License, Version 1.0. (See accompanying
+//  file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include <hpx/config.hpp>
+#if !defined(HPX_COMPUTE_DEVICE_CODE)
+#include <hpx/hpx_main.hpp>
+#include <hpx/include/parallel_sort.hpp>
+#include <hpx/include/partitioned_vector_predef.hpp>
+#include <hpx/include/runtime.hpp>
+#include <hpx/modules/testing.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <vector>
+
+///////////////////////////////////////////////////////////////////////////////
+// The vector types to be used are defined in partitioned_vector module.
+// HPX_REGISTER_PARTITIONED_VECTOR(double)
+// HPX_REGISTER_PARTITIONED_VECTOR(int)
+
+unsigned int seed = std::random_device{}();
+std::mt19937 gen(seed);
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+std::vector<T> fill_vector(hpx::partitioned_vector<T>& v, int max_value)
+{
+    std::uniform_int_distribution<int> dis(0, max_value);
+
+    std::vector<T> values;
+    values.reserve(v.size());
+    for (auto it = v.begin(); it != v.end(); ++it)
+    {
+        T val = T(dis(gen));
+        *it = val;
+        values.push_back(val);
+    }
+    return values;
+}
+
+template <typename T>
+void compare_vectors(
+    hpx::partitioned_vector<T> const& v, std::vector<T> const& expected)
+{
+    HPX_TEST_EQ(v.size(), expected.size());
+
+    auto it = expected.begin();
+    for (auto vit = v.begin(); vit != v.end(); ++vit, ++it)
+    {
+        HPX_TEST_EQ(T(*vit), *it);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy(std::size_t size, DistPolicy const& policy,
+    ExPolicy const& sort_policy, int max_value)
+{
+    hpx::partitioned_vector<T> v(size, policy);
+    std::vector<T> expected = fill_vector(v, max_value);
+
+    hpx::sort(sort_policy, v.begin(), v.end());
+
+    std::sort(expected.begin(), expected.end());
+    compare_vectors(v, expected);
+
+    // sort descending
+    hpx::sort(sort_policy, v.begin(), v.end(), std::greater<T>());
+
+    std::sort(expected.begin(), expected.end(), std::greater<T>());
+    compare_vectors(v, expected);
+}
+
+template <typename T, typename DistPolicy, typename ExPolicy>
+void sort_algo_tests_with_policy_async(std::size_t size,
+    DistPolicy const& policy, ExPolicy const& sort_policy, int max_value)
+{
+    hpx::partitioned_vector<T> v(size, policy);
+    std::vector<T> expected = fill_vector(v, max_value);
+
+    using hpx::execution::task;
+
+    auto f = hpx::sort(sort_policy(task), v.begin(), v.end());
+    f.get();
+
+    std::sort(expected.begin(), expected.end());
+    compare_vectors(v, expected);
+}
+
+template <typename T, typename DistPolicy>
+void sort_tests_with_policy(std::size_t size, DistPolicy const& policy)
+{
+    using namespace hpx::execution;
+
+    // many duplicate values make for unevenly sized buckets
+    for (int max_value : {3, 10000})
+    {
+        sort_algo_tests_with_policy<T>(size, policy, seq, max_value);
+        sort_algo_tests_with_policy<T>(size, policy, par, max_value);
+
+        sort_algo_tests_with_policy_async<T>(size, policy, seq, max_value);
+        sort_algo_tests_with_policy_async<T>(size, policy, par, max_value);
+    }
+
+    // sort a subrange only
+    hpx::partitioned_vector<T> v(size, policy);
+    std::vector<T> expected = fill_vector(v, 10000);
+
+    hpx::sort(par, v.begin() + 1, v.end() - 1);
+    std::sort(expected.begin() + 1, expected.end() - 1);
+    compare_vectors(v, expected);
+
+    hpx::sort(v.begin(), v.end());
+    std::sort(expected.begin(), expected.end());
+    compare_vectors(v, expected);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+template <typename T>
+void sort_tests()
+{
+    std::size_t const length = 1000;
+    std::vector<hpx::id_type> localities = hpx::find_all_localities();
+
+    sort_tests_with_policy<T>(length, hpx::container_layout);
+    sort_tests_with_policy<T>(length, hpx::container_layout(3));
+    sort_tests_with_policy<T>(length, hpx::container_layout(3, localities));
+    sort_tests_with_policy<T>(length, hpx::container_layout(localities));
+    sort_tests_with_policy<T>(13, hpx::container_layout(7, localities));
+}
+
+///////////////////////////////////////////////////////////////////////////////
+int main()
+{
+    std::cout << "using seed: " << seed << std::endl;
+
+    sort_tests<double>();
+    sort_tests<int>();
+
+    return 0;
+}
+#endif
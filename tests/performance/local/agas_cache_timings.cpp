@@ -14,6 +14,7 @@
 #include <hpx/hpx.hpp>
 #include <hpx/hpx_init.hpp>
 
+#include <hpx/agas/gva_cache.hpp>
 #include <hpx/cache/entries/lfu_entry.hpp>
 #include <hpx/cache/local_cache.hpp>
 #include <hpx/cache/statistics/local_full_statistics.hpp>
@@ -230,6 +231,63 @@ void test_update(gva_cache_type& cache, hpx::naming::gid_type first_key)
     calculate_histogram("update", timings);
 }
 
+///////////////////////////////////////////////////////////////////////////////
+// Measure the throughput of concurrent lookups in the AGAS cache used by the
+// addressing service for an increasing number of threads
+void test_concurrent_get(std::size_t cache_size, std::size_t num_entries,
+    std::size_t num_lookups)
+{
+    hpx::naming::gid_type locality = hpx::get_locality();
+    std::int32_t ct = hpx::components::component_invalid;
+
+    hpx::agas::detail::gva_cache cache(cache_size);
+
+    std::vector<hpx::naming::gid_type> keys;
+    keys.reserve(num_entries);
+    for (std::size_t i = 0; i != num_entries; ++i)
+    {
+        keys.push_back(hpx::detail::get_next_id());
+
+        hpx::naming::gid_type collision_base;
+        std::uint64_t collision_count = 0;
+        cache.update(keys.back(), 1,
+            hpx::agas::gva(locality, ct, 1, std::uint64_t(0), 0),
+            collision_base, collision_count);
+    }
+
+    std::size_t const max_threads = hpx::get_os_thread_count();
+    for (std::size_t num_threads = 1; num_threads <= max_threads;
+         num_threads *= 2)
+    {
+        cache.contentions(true);
+
+        std::vector<hpx::future<void>> workers;
+        workers.reserve(num_threads);
+
+        hpx::chrono::high_resolution_timer t;
+        for (std::size_t i = 0; i != num_threads; ++i)
+        {
+            workers.push_back(hpx::async([&, i]() {
+                hpx::naming::gid_type idbase;
+                hpx::agas::gva g;
+                for (std::size_t j = 0; j != num_lookups; ++j)
+                {
+                    cache.get(keys[(i * 7919 + j) % keys.size()], idbase, g);
+                }
+            }));
+        }
+        hpx::wait_all(workers);
+
+        double elapsed = t.elapsed();
+        std::cout << "concurrent get, threads: " << std::setw(3)
+                  << num_threads << ", lookups/s: " << std::setw(12)
+                  << std::fixed << std::setprecision(0)
+                  << double(num_threads * num_lookups) / elapsed
+                  << ", contentions: " << cache.contentions(true)
+                  << std::endl;
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 int hpx_main(hpx::program_options::variables_map& vm)
 {
@@ -255,6 +313,16 @@ int hpx_main(hpx::program_options::variables_map& vm)
     double elapsed = t1.elapsed();
     hpx::util::print_cdash_timing("AGASCache", elapsed);
 
+    std::size_t num_lookups = 100000;
+    if (vm.count("num_lookups"))
+        num_lookups = vm["num_lookups"].as<std::size_t>();
+
+    hpx::chrono::high_resolution_timer t2;
+
+    test_concurrent_get(cache_size, num_entries, num_lookups);
+
+    hpx::util::print_cdash_timing("AGASCacheConcurrent", t2.elapsed());
+
     return hpx::finalize();
 }
 
@@ -268,7 +336,10 @@ int main(int argc, char* argv[])
         "initial cache size (default: " HPX_PP_STRINGIZE(
             HPX_AGAS_LOCAL_CACHE_SIZE_PER_THREAD) ")")("num_entries,n",
         value<std::size_t>(),
-        "number of items to insert into cache (default: 1000)");
+        "number of items to insert into cache (default: 1000)")(
+        "num_lookups", value<std::size_t>(),
+        "number of lookups per thread performed while measuring the "
+        "concurrent cache accesses (default: 100000)");
 
     // Initialize and run HPX
     hpx::init_params init_args;